@@ -201,7 +201,7 @@ source %{
         }
         break;
       case Op_ExpandV:
-        if (UseSVE < 2 || is_subword_type(bt)) {
+        if (UseSVE < 2 || bt == T_BYTE) {
           return false;
         }
         break;
@@ -4878,6 +4878,7 @@ instruct vcompressS(vReg dst, vReg src, pReg pg,
 %}
 
 instruct vexpand(vReg dst, vReg src, pRegGov pg) %{
+  predicate(!is_subword_type(Matcher::vector_element_basic_type(n)));
   match(Set dst (ExpandV src pg));
   effect(TEMP_DEF dst);
   format %{ "vexpand $dst, $pg, $src" %}
@@ -4906,6 +4907,19 @@ instruct vexpand(vReg dst, vReg src, pRegGov pg) %{
   ins_pipe(pipe_slow);
 %}
 
+instruct vexpandS(vReg dst, vReg src, pReg pg,
+                  vReg tmp1, vReg tmp2, pRegGov pgtmp) %{
+  predicate(Matcher::vector_element_basic_type(n) == T_SHORT);
+  match(Set dst (ExpandV src pg));
+  effect(TEMP_DEF dst, TEMP tmp1, TEMP tmp2, TEMP pgtmp);
+  format %{ "vexpandS $dst, $pg, $src\t# KILL $tmp1, $tmp2, $pgtmp" %}
+  ins_encode %{
+    __ sve_expand_short($dst$$FloatRegister, $src$$FloatRegister, $pg$$PRegister,
+                        $tmp1$$FloatRegister, $tmp2$$FloatRegister, $pgtmp$$PRegister);
+  %}
+  ins_pipe(pipe_slow);
+%}
+
 // ------------------------------ Vector signum --------------------------------
 
 // Vector Math.signum
@@ -1452,6 +1452,111 @@ void C2_MacroAssembler::string_compare(Register str1, Register str2,
   BLOCK_COMMENT("} string_compare");
 }
 
+// Compute the polynomial hash 31 * h + ary[i] over cnt elements of type eltype, starting from
+// the initial value in result. The main loop handles four elements per iteration:
+//   h' = 31^4 * h + (31^3 * ary[i] + 31^2 * ary[i+1] + 31 * ary[i+2] + ary[i+3])
+// The bracketed sum does not depend on h, so only the final MADD is on the loop-carried
+// dependency chain.
+// Clobbers: ary, cnt, rscratch1, rscratch2 and the rFlagsReg.
+void C2_MacroAssembler::arrays_hashcode(Register ary, Register cnt, Register result,
+                                        Register tmp1, Register tmp2, Register tmp3,
+                                        Register tmp4, Register tmp5, Register tmp6,
+                                        BasicType eltype) {
+  assert_different_registers(ary, cnt, result, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, rscratch1, rscratch2);
+
+  const int elsize = arrays_hashcode_elsize(eltype);
+  const int elsize_shift = exact_log2(elsize);
+
+  switch (eltype) {
+  case T_BOOLEAN: BLOCK_COMMENT("arrays_hashcode(unsigned byte) {"); break;
+  case T_CHAR:    BLOCK_COMMENT("arrays_hashcode(char) {");          break;
+  case T_BYTE:    BLOCK_COMMENT("arrays_hashcode(byte) {");          break;
+  case T_SHORT:   BLOCK_COMMENT("arrays_hashcode(short) {");         break;
+  case T_INT:     BLOCK_COMMENT("arrays_hashcode(int) {");           break;
+  default:
+    ShouldNotReachHere();
+  }
+
+  const int stride = 4;
+  const Register pow31_4 = tmp1;
+  const Register pow31_3 = tmp2;
+  const Register pow31_2 = tmp3;
+  const Register chunks  = tmp4;
+  const Register chunks_end = chunks;
+
+  Label DONE, TAIL, TAIL_LOOP, WIDE_LOOP;
+
+  // result has a value initially
+
+  cbzw(cnt, DONE);
+
+  andw(chunks, cnt, ~(stride - 1));
+  cbzw(chunks, TAIL);
+
+  movw(pow31_4, 923521);             // [31^^4]
+  movw(pow31_3,  29791);             // [31^^3]
+  movw(pow31_2,    961);             // [31^^2]
+
+  add(chunks_end, ary, chunks, ext::uxtw, elsize_shift);
+  andw(cnt, cnt, stride - 1);        // don't forget about tail!
+
+  bind(WIDE_LOOP);
+  arrays_hashcode_elload(rscratch1, Address(ary, 0 * elsize), eltype);
+  arrays_hashcode_elload(rscratch2, Address(ary, 1 * elsize), eltype);
+  arrays_hashcode_elload(tmp5,      Address(ary, 2 * elsize), eltype);
+  arrays_hashcode_elload(tmp6,      Address(ary, 3 * elsize), eltype);
+  mulw(rscratch1, rscratch1, pow31_3);             // 31^^3 * ary[i+0]
+  maddw(rscratch1, rscratch2, pow31_2, rscratch1); // + 31^^2 * ary[i+1]
+  addw(rscratch1, rscratch1, tmp5, LSL, 5);        // + 31^^1 * ary[i+2]
+  subw(rscratch1, rscratch1, tmp5);                //   as (ary[i+2] << 5) - ary[i+2]
+  addw(rscratch1, rscratch1, tmp6);                // + 31^^0 * ary[i+3]
+  maddw(result, result, pow31_4, rscratch1);       // 31^^4 * h + the above
+  add(ary, ary, elsize * stride);
+  cmp(ary, chunks_end);
+  br(NE, WIDE_LOOP);
+  cbzw(cnt, DONE);
+
+  bind(TAIL);
+  add(chunks_end, ary, cnt, ext::uxtw, elsize_shift);
+
+  bind(TAIL_LOOP);
+  arrays_hashcode_elload(rscratch1, Address(post(ary, elsize)), eltype);
+  lslw(rscratch2, result, 5);        // optimize 31 * result
+  subw(result, rscratch2, result);   // with result<<5 - result
+  addw(result, result, rscratch1);
+  cmp(ary, chunks_end);
+  br(NE, TAIL_LOOP);
+
+  bind(DONE);
+  BLOCK_COMMENT("} // arrays_hashcode");
+}
+
+int C2_MacroAssembler::arrays_hashcode_elsize(BasicType eltype) {
+  switch (eltype) {
+  case T_BOOLEAN: return sizeof(jboolean);
+  case T_BYTE:    return sizeof(jbyte);
+  case T_SHORT:   return sizeof(jshort);
+  case T_CHAR:    return sizeof(jchar);
+  case T_INT:     return sizeof(jint);
+  default:
+    ShouldNotReachHere();
+    return -1;
+  }
+}
+
+void C2_MacroAssembler::arrays_hashcode_elload(Register dst, Address src, BasicType eltype) {
+  switch (eltype) {
+  // T_BOOLEAN used as surrogate for unsigned byte
+  case T_BOOLEAN: ldrb(dst, src);   break;
+  case T_BYTE:    ldrsbw(dst, src); break;
+  case T_SHORT:   ldrshw(dst, src); break;
+  case T_CHAR:    ldrh(dst, src);   break;
+  case T_INT:     ldrw(dst, src);   break;
+  default:
+    ShouldNotReachHere();
+  }
+}
+
 void C2_MacroAssembler::neon_compare(FloatRegister dst, BasicType bt, FloatRegister src1,
                                      FloatRegister src2, Condition cond, bool isQ) {
   SIMD_Arrangement size = esize2arrangement((unsigned)type2aelembytes(bt), isQ);
@@ -2418,6 +2523,54 @@ void C2_MacroAssembler::sve_compress_byte(FloatRegister dst, FloatRegister src,
   sve_orr(dst, dst, vtmp1);
 }
 
+// Place the lowest-numbered elements of src, in order, into the active elements
+// of dst, under the control of mask. Inactive elements of dst are set to zero.
+// HISTCNT only supports INT and LONG lanes, so the TBL indices are computed on
+// the two unpacked halves of mask and then narrowed to type SHORT.
+// Clobbers: rscratch1
+// Preserves: src, mask
+void C2_MacroAssembler::sve_expand_short(FloatRegister dst, FloatRegister src, PRegister mask,
+                                         FloatRegister vtmp1, FloatRegister vtmp2,
+                                         PRegister pgtmp) {
+  assert(UseSVE == 2, "must be sve2");
+  assert(pgtmp->is_governing(), "This register has to be a governing predicate register");
+  assert_different_registers(dst, src, vtmp1, vtmp2);
+  assert_different_registers(mask, pgtmp);
+
+  // Example input:   src   = 8888 7777 6666 5555 4444 3333 2222 1111
+  //                  mask  = 0001 0000 0000 0001 0001 0000 0001 0001
+  // Expected result: dst   = 5555 0000 0000 4444 3333 0000 2222 1111
+
+  // Count the active elements up to and including each active element of
+  // the lowest half.
+  // pgtmp = 00000001 00000000 00000001 00000001
+  sve_punpklo(pgtmp, mask);
+  // vtmp1 = 00000003 00000000 00000002 00000001
+  sve_dup(vtmp1, S, 0);
+  sve_histcnt(vtmp1, S, pgtmp, vtmp1, vtmp1);
+  // rscratch1 = 3
+  sve_cntp(rscratch1, S, ptrue, pgtmp);
+
+  // Repeat to the highest half, continuing the count of the lowest half.
+  // pgtmp = 00000001 00000000 00000000 00000001
+  sve_punpkhi(pgtmp, mask);
+  // vtmp2 = 00000002 00000000 00000000 00000001
+  sve_dup(vtmp2, S, 0);
+  sve_histcnt(vtmp2, S, pgtmp, vtmp2, vtmp2);
+  // vtmp2 = 00000005 00000000 00000000 00000004
+  sve_dup(dst, S, rscratch1);
+  sve_add(vtmp2, S, pgtmp, dst);
+
+  // Narrow the counts back to type SHORT and turn them into indices. Inactive
+  // elements become -1, which is out of range for TBL and selects zero.
+  // dst = 0005 0000 0000 0004 0003 0000 0002 0001
+  sve_uzp1(dst, H, vtmp1, vtmp2);
+  // dst = 0004 ffff ffff 0003 0002 ffff 0001 0000
+  sve_sub(dst, H, 1);
+  // dst = 5555 0000 0000 4444 3333 0000 2222 1111
+  sve_tbl(dst, H, src, dst);
+}
+
 void C2_MacroAssembler::neon_reverse_bits(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ) {
   assert(bt == T_BYTE || bt == T_SHORT || bt == T_INT || bt == T_LONG, "unsupported basic type");
   SIMD_Arrangement size = isQ ? T16B : T8B;
@@ -68,6 +68,14 @@
                                FloatRegister ztmp1, FloatRegister ztmp2,
                                PRegister pgtmp, PRegister ptmp, bool isL);
 
+  void arrays_hashcode(Register ary, Register cnt, Register result,
+                       Register tmp1, Register tmp2, Register tmp3,
+                       Register tmp4, Register tmp5, Register tmp6,
+                       BasicType eltype);
+
+  int arrays_hashcode_elsize(BasicType eltype);
+  void arrays_hashcode_elload(Register dst, Address src, BasicType eltype);
+
   // Compress the least significant bit of each byte to the rightmost and clear
   // the higher garbage bits.
   void bytemask_compress(Register dst);
@@ -168,6 +176,13 @@
                           FloatRegister vtmp1, FloatRegister vtmp2,
                           PRegister pgtmp);
 
+  // Place the lowest-numbered elements of src, in order, into the active
+  // elements of dst, under the control of mask. Inactive elements of dst
+  // will be filled with zero.
+  void sve_expand_short(FloatRegister dst, FloatRegister src, PRegister mask,
+                        FloatRegister vtmp1, FloatRegister vtmp2,
+                        PRegister pgtmp);
+
   void neon_reverse_bits(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ);
 
   void neon_reverse_bytes(FloatRegister dst, FloatRegister src, BasicType bt, bool isQ);
@@ -223,12 +223,36 @@ static void generate_post_barrier_fast_path(MacroAssembler* masm,
   __ cmpw(tmp2, (int)G1CardTable::g1_young_card_val());  // tmp2 := card == young_card_val?
 }
 
+static void generate_post_barrier_card_cache_update(MacroAssembler* masm,
+                                                    const Register thread,
+                                                    const Register card_addr,
+                                                    const Register temp) {
+  if (G1UsePostBarrierCardCache) {
+    // Dirty the previously cached card again, see
+    // G1DirtyCardQueueSet::release_last_dirtied_card(), and cache the new card.
+    Address last_dirtied_card(thread, in_bytes(G1ThreadLocalData::dirty_card_queue_last_dirtied_card_offset()));
+    Label no_previous;
+    STATIC_ASSERT(CardTable::dirty_card_val() == 0);
+    __ ldr(temp, last_dirtied_card);  // temp := previously cached card address
+    __ cbz(temp, no_previous);
+    __ strb(zr, Address(temp));       // *(previously cached card address) := dirty_card_val
+    __ bind(no_previous);
+    __ str(card_addr, last_dirtied_card);  // cached card address := card address
+  }
+}
+
 static void generate_post_barrier_slow_path(MacroAssembler* masm,
                                             const Register thread,
                                             const Register tmp1,
                                             const Register tmp2,
                                             Label& done,
                                             Label& runtime) {
+  if (G1UsePostBarrierCardCache) {
+    // Card dirtied last by this thread and not handed off for refinement yet?
+    __ ldr(tmp2, Address(thread, in_bytes(G1ThreadLocalData::dirty_card_queue_last_dirtied_card_offset())));
+    __ cmp(tmp1, tmp2);
+    __ br(Assembler::EQ, done);
+  }
   __ membar(Assembler::StoreLoad);  // StoreLoad membar
   __ ldrb(tmp2, Address(tmp1));     // tmp2 := card
   __ cbzw(tmp2, done);
@@ -241,6 +265,7 @@ static void generate_post_barrier_slow_path(MacroAssembler* masm,
                                     G1ThreadLocalData::dirty_card_queue_buffer_offset(),
                                     runtime,
                                     thread, tmp1, tmp2, rscratch1);
+  generate_post_barrier_card_cache_update(masm, thread, tmp1, tmp2);
   __ b(done);
 }
 
@@ -556,6 +581,14 @@ void G1BarrierSetAssembler::generate_c1_post_barrier_runtime_stub(StubAssembler*
   __ cmpw(rscratch1, (int)G1CardTable::g1_young_card_val());
   __ br(Assembler::EQ, done);
 
+  if (G1UsePostBarrierCardCache) {
+    // Card dirtied last by this thread and not handed off for refinement yet?
+    __ ldr(rscratch1, Address(thread, in_bytes(G1ThreadLocalData::dirty_card_queue_last_dirtied_card_offset())));
+    __ sub(rscratch1, rscratch1, byte_map_base);
+    __ cmp(rscratch1, card_offset);
+    __ br(Assembler::EQ, done);
+  }
+
   assert((int)CardTable::dirty_card_val() == 0, "must be 0");
 
   __ membar(Assembler::StoreLoad);
@@ -580,6 +613,7 @@ void G1BarrierSetAssembler::generate_c1_post_barrier_runtime_stub(StubAssembler*
 
   __ ldr(buffer_addr, buffer);
   __ str(card_addr, Address(buffer_addr, rscratch1));
+  generate_post_barrier_card_cache_update(sasm, thread, card_addr, rscratch1);
   __ b(done);
 
   __ bind(runtime);
@@ -2560,6 +2560,49 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Arguments:
+  //   c_rarg0 - destination address, HeapWord aligned
+  //   c_rarg1 - number of HeapWords to zero
+  //
+  // Zeroes the words with non-temporal store pairs, eight words per
+  // iteration.  Unlike DC ZVA this does not allocate the lines in the
+  // cache, and it does not depend on the ZVA block size.
+  address generate_zero_words_nontemporal() {
+    const Register to    = c_rarg0;  // destination address
+    const Register count = c_rarg1;  // number of words
+
+    __ align(CodeEntryAlignment);
+
+    StubCodeMark mark(this, "StubRoutines", "zero_words_nontemporal");
+
+    Label loop, tail, tail_loop, done;
+    address start = __ pc();
+    __ enter();
+    __ subs(count, count, 8);
+    __ br(Assembler::LT, tail);
+    __ bind(loop);
+    __ stnp(zr, zr, Address(to, 0));
+    __ stnp(zr, zr, Address(to, 2 * wordSize));
+    __ stnp(zr, zr, Address(to, 4 * wordSize));
+    __ stnp(zr, zr, Address(to, 6 * wordSize));
+    __ add(to, to, 8 * wordSize);
+    __ subs(count, count, 8);
+    __ br(Assembler::GE, loop);
+    __ bind(tail);
+    __ adds(count, count, 8);
+    __ br(Assembler::EQ, done);
+    __ bind(tail_loop);
+    __ str(zr, Address(__ post(to, wordSize)));
+    __ subs(count, count, 1);
+    __ br(Assembler::NE, tail_loop);
+    __ bind(done);
+    __ membar(Assembler::StoreStore);
+    __ leave();
+    __ ret(lr);
+
+    return start;
+  }
+
   void generate_arraycopy_stubs() {
     address entry;
     address entry_jbyte_arraycopy;
@@ -8336,6 +8379,9 @@ class StubGenerator: public StubCodeGenerator {
     StubRoutines::_data_cache_writeback = generate_data_cache_writeback();
     StubRoutines::_data_cache_writeback_sync = generate_data_cache_writeback_sync();
 
+    // zeroing of large arrays
+    StubRoutines::_zero_words_nontemporal = generate_zero_words_nontemporal();
+
     if (UseAESIntrinsics) {
       StubRoutines::_aescrypt_encryptBlock = generate_aescrypt_encryptBlock();
       StubRoutines::_aescrypt_decryptBlock = generate_aescrypt_decryptBlock();
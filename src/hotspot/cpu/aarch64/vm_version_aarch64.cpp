@@ -235,6 +235,9 @@ void VM_Version::initialize() {
     if (FLAG_IS_DEFAULT(AlwaysMergeDMB)) {
       FLAG_SET_DEFAULT(AlwaysMergeDMB, false);
     }
+    if (FLAG_IS_DEFAULT(UseVectorizedHashCodeIntrinsic)) {
+      FLAG_SET_DEFAULT(UseVectorizedHashCodeIntrinsic, true);
+    }
   }
 
   if (_cpu == CPU_ARM) {
@@ -15065,6 +15065,13 @@ void Assembler::movslq(Register dst, Register src) {
   emit_int16(0x63, (0xC0 | encode));
 }
 
+void Assembler::movntiq(Address dst, Register src) {
+  InstructionMark im(this);
+  int prefix = get_prefixq(dst, src, true /* is_map1 */);
+  emit_prefix_and_int8(prefix, (unsigned char)0xC3);
+  emit_operand(src, dst, 0);
+}
+
 void Assembler::movswq(Register dst, Address src) {
   InstructionMark im(this);
   int prefix = get_prefixq(src, dst, true /* is_map1 */);
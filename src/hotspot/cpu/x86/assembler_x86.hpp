@@ -1817,6 +1817,9 @@ class Assembler : public AbstractAssembler  {
 
   void movslq(Register dst, Address src);
   void movslq(Register dst, Register src);
+
+  // Non-temporal store of a 64bit register
+  void movntiq(Address dst, Register src);
 #endif
 
   void movswl(Register dst, Address src);
@@ -311,12 +311,42 @@ static void generate_post_barrier_fast_path(MacroAssembler* masm,
   __ cmpb(Address(tmp, 0), G1CardTable::g1_young_card_val());    // *(card address) == young_card_val?
 }
 
+static void generate_post_barrier_card_cache_check(MacroAssembler* masm,
+                                                   const Register thread,
+                                                   const Register card_addr,
+                                                   Label& done) {
+  if (G1UsePostBarrierCardCache) {
+    // Card dirtied last by this thread and not handed off for refinement yet?
+    __ cmpptr(card_addr, Address(thread, in_bytes(G1ThreadLocalData::dirty_card_queue_last_dirtied_card_offset())));
+    __ jcc(Assembler::equal, done);
+  }
+}
+
+static void generate_post_barrier_card_cache_update(MacroAssembler* masm,
+                                                    const Register thread,
+                                                    const Register card_addr,
+                                                    const Register temp) {
+  if (G1UsePostBarrierCardCache) {
+    // Dirty the previously cached card again, see
+    // G1DirtyCardQueueSet::release_last_dirtied_card(), and cache the new card.
+    Address last_dirtied_card(thread, in_bytes(G1ThreadLocalData::dirty_card_queue_last_dirtied_card_offset()));
+    Label no_previous;
+    __ movptr(temp, last_dirtied_card);                          // temp := previously cached card address
+    __ testptr(temp, temp);
+    __ jcc(Assembler::zero, no_previous);
+    __ movb(Address(temp, 0), G1CardTable::dirty_card_val());    // *(previously cached card address) := dirty_card_val
+    __ bind(no_previous);
+    __ movptr(last_dirtied_card, card_addr);                     // cached card address := card address
+  }
+}
+
 static void generate_post_barrier_slow_path(MacroAssembler* masm,
                                             const Register thread,
                                             const Register tmp,
                                             const Register tmp2,
                                             Label& done,
                                             Label& runtime) {
+  generate_post_barrier_card_cache_check(masm, thread, tmp, done);
   __ membar(Assembler::Membar_mask_bits(Assembler::StoreLoad));  // StoreLoad membar
   __ cmpb(Address(tmp, 0), G1CardTable::dirty_card_val());       // *(card address) == dirty_card_val?
   __ jcc(Assembler::equal, done);
@@ -328,6 +358,7 @@ static void generate_post_barrier_slow_path(MacroAssembler* masm,
                            G1ThreadLocalData::dirty_card_queue_buffer_offset(),
                            runtime,
                            thread, tmp, tmp2);
+  generate_post_barrier_card_cache_update(masm, thread, tmp, tmp2);
   __ jmp(done);
 }
 
@@ -665,6 +696,8 @@ void G1BarrierSetAssembler::generate_c1_post_barrier_runtime_stub(StubAssembler*
   __ cmpb(Address(card_addr, 0), G1CardTable::g1_young_card_val());
   __ jcc(Assembler::equal, done);
 
+  generate_post_barrier_card_cache_check(sasm, thread, card_addr, done);
+
   __ membar(Assembler::Membar_mask_bits(Assembler::StoreLoad));
   __ cmpb(Address(card_addr, 0), CardTable::dirty_card_val());
   __ jcc(Assembler::equal, done);
@@ -684,6 +717,7 @@ void G1BarrierSetAssembler::generate_c1_post_barrier_runtime_stub(StubAssembler*
   __ movptr(queue_index, tmp);
   __ addptr(tmp, buffer);
   __ movptr(Address(tmp, 0), card_addr);
+  generate_post_barrier_card_cache_update(sasm, thread, card_addr, tmp);
   __ jmp(enqueued);
 
   __ bind(runtime);
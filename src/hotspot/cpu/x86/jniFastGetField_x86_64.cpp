@@ -220,3 +220,108 @@ address JNI_FastGetField::generate_fast_get_float_field() {
 address JNI_FastGetField::generate_fast_get_double_field() {
   return generate_fast_get_float_field0(T_DOUBLE);
 }
+
+// Register usage for Get<Primitive>ArrayRegion:
+// c_rarg0:    jni env
+// c_rarg1:    array
+// c_rarg2:    start
+// c_rarg3:    len
+// c_rarg4:    buf
+//
+// All argument registers are preserved up to the tail call to the slow case.
+// Windows passes buf on the stack and has too few volatile registers left
+// for the copy loop, so there is no fast version there.
+
+static const Register ridx = r10; // == rscratch1, free until the final counter check
+
+address JNI_FastGetField::generate_fast_get_array_region(BasicType type) {
+#ifdef _WIN64
+  return (address)-1;
+#else
+  const char *name = nullptr;
+  switch (type) {
+    case T_BOOLEAN: name = "jni_fast_GetBooleanArrayRegion"; break;
+    case T_BYTE:    name = "jni_fast_GetByteArrayRegion";    break;
+    case T_CHAR:    name = "jni_fast_GetCharArrayRegion";    break;
+    case T_SHORT:   name = "jni_fast_GetShortArrayRegion";   break;
+    case T_INT:     name = "jni_fast_GetIntArrayRegion";     break;
+    case T_LONG:    name = "jni_fast_GetLongArrayRegion";    break;
+    case T_FLOAT:   name = "jni_fast_GetFloatArrayRegion";   break;
+    case T_DOUBLE:  name = "jni_fast_GetDoubleArrayRegion";  break;
+    default:        ShouldNotReachHere();
+  }
+  ResourceMark rm;
+  BufferBlob* blob = BufferBlob::create(name, 2*BUFFER_SIZE);
+  CodeBuffer cbuf(blob);
+  MacroAssembler* masm = new MacroAssembler(&cbuf);
+  address fast_entry = __ pc();
+
+  const int elem_size = type2aelembytes(type);
+  const Address::ScaleFactor scale = Address::times(elem_size);
+
+  Label slow, loop;
+
+  ExternalAddress counter(SafepointSynchronize::safepoint_counter_addr());
+  __ mov32 (rcounter, counter);
+  __ mov   (robj, c_rarg1);
+  __ testb (rcounter, 1);
+  __ jcc (Assembler::notZero, slow);
+
+  // Leave empty, negative and out of range requests, which may need to
+  // throw, to the slow case. The callee only looks at the low 32 bits of
+  // start and len, so they can be sign-extended in place.
+  __ movslq(c_rarg2, c_rarg2);
+  __ movslq(c_rarg3, c_rarg3);
+  __ testq (c_rarg2, c_rarg2);
+  __ jcc (Assembler::negative, slow);
+  __ testq (c_rarg3, c_rarg3);
+  __ jcc (Assembler::lessEqual, slow);
+
+  // Both robj and rtmp are clobbered by try_resolve_jobject_in_native.
+  BarrierSetAssembler* bs = BarrierSet::barrier_set()->barrier_set_assembler();
+  bs->try_resolve_jobject_in_native(masm, /* jni_env */ c_rarg0, robj, rtmp, slow);
+
+  assert(count + 2 <= LIST_CAPACITY, "LIST_CAPACITY too small");
+  const int length_load = count++;
+  speculative_load_pclist[length_load] = __ pc();
+  __ movslq(rtmp, Address(robj, arrayOopDesc::length_offset_in_bytes()));
+  __ lea   (ridx, Address(c_rarg2, c_rarg3, Address::times_1));
+  __ cmpq  (ridx, rtmp);
+  __ jcc (Assembler::above, slow);
+
+  __ lea   (robj, Address(robj, c_rarg2, scale, arrayOopDesc::base_offset_in_bytes(type)));
+  __ xorl  (ridx, ridx);
+  __ bind (loop);
+  const int element_load = count++;
+  speculative_load_pclist[element_load] = __ pc();
+  switch (elem_size) {
+    case 1: __ movzbl(rtmp, Address(robj, ridx, scale));
+            __ movb  (Address(c_rarg4, ridx, scale), rtmp); break;
+    case 2: __ movzwl(rtmp, Address(robj, ridx, scale));
+            __ movw  (Address(c_rarg4, ridx, scale), rtmp); break;
+    case 4: __ movl  (rtmp, Address(robj, ridx, scale));
+            __ movl  (Address(c_rarg4, ridx, scale), rtmp); break;
+    case 8: __ movq  (rtmp, Address(robj, ridx, scale));
+            __ movq  (Address(c_rarg4, ridx, scale), rtmp); break;
+    default: ShouldNotReachHere();
+  }
+  __ incrementq(ridx);
+  __ cmpq  (ridx, c_rarg3);
+  __ jcc (Assembler::less, loop);
+
+  __ cmp32 (rcounter, counter, rscratch1);
+  __ jcc (Assembler::notEqual, slow);
+
+  __ ret (0);
+
+  slowcase_entry_pclist[length_load] = __ pc();
+  slowcase_entry_pclist[element_load] = __ pc();
+  __ bind (slow);
+  // tail call
+  __ jump (RuntimeAddress(jni_GetArrayRegion_addr(type)), rscratch1);
+
+  __ flush ();
+
+  return fast_entry;
+#endif // _WIN64
+}
@@ -1369,6 +1369,54 @@ address StubGenerator::generate_data_cache_writeback_sync() {
   return start;
 }
 
+// Arguments:
+//   c_rarg0 - destination address, HeapWord aligned
+//   c_rarg1 - number of HeapWords to zero
+//
+// Zeroes the words with movnti, eight words per iteration, and fences the
+// weakly ordered stores before returning.
+address StubGenerator::generate_zero_words_nontemporal() {
+  const Register to    = c_rarg0;  // destination address
+  const Register count = c_rarg1;  // number of words
+
+  __ align(CodeEntryAlignment);
+
+  StubCodeMark mark(this, "StubRoutines", "zero_words_nontemporal");
+
+  Label L_loop, L_tail, L_tail_loop, L_done;
+  address start = __ pc();
+
+  __ enter();
+  __ xorl(rax, rax);
+  __ cmpq(count, 8);
+  __ jccb(Assembler::below, L_tail);
+
+  __ BIND(L_loop);
+  for (int i = 0; i < 8; i++) {
+    __ movntiq(Address(to, i * wordSize), rax);
+  }
+  __ addptr(to, 8 * wordSize);
+  __ subq(count, 8);
+  __ cmpq(count, 8);
+  __ jccb(Assembler::aboveEqual, L_loop);
+
+  __ BIND(L_tail);
+  __ testq(count, count);
+  __ jccb(Assembler::zero, L_done);
+  __ BIND(L_tail_loop);
+  __ movntiq(Address(to, 0), rax);
+  __ addptr(to, wordSize);
+  __ decrementq(count);
+  __ jccb(Assembler::notZero, L_tail_loop);
+
+  __ BIND(L_done);
+  __ sfence();
+  __ leave();
+  __ ret(0);
+
+  return start;
+}
+
 // ofs and limit are use for multi-block byte array.
 // int com.sun.security.provider.MD5.implCompress(byte[] b, int ofs)
 address StubGenerator::generate_md5_implCompress(bool multi_block, const char *name) {
@@ -3965,6 +4013,9 @@ void StubGenerator::generate_final_stubs() {
   StubRoutines::_data_cache_writeback = generate_data_cache_writeback();
   StubRoutines::_data_cache_writeback_sync = generate_data_cache_writeback_sync();
 
+  // zeroing of large arrays
+  StubRoutines::_zero_words_nontemporal = generate_zero_words_nontemporal();
+
   // arraycopy stubs used by compilers
   generate_arraycopy_stubs();
 
@@ -297,6 +297,9 @@ class StubGenerator: public StubCodeGenerator {
 
   address generate_data_cache_writeback_sync();
 
+  // Zeroing with non-temporal stores
+  address generate_zero_words_nontemporal();
+
   void generate_arraycopy_stubs();
 
 
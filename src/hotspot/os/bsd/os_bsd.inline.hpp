@@ -59,4 +59,6 @@ inline void os::map_stack_shadow_pages(address sp) {
 inline bool os::can_trim_native_heap() { return false; }
 inline bool os::trim_native_heap(os::size_change_t* rss_change) { return false; }
 
+inline bool os::memory_pressure(os::memory_pressure_t* info) { return false; }
+
 #endif // OS_BSD_OS_BSD_INLINE_HPP
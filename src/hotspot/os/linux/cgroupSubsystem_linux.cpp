@@ -786,7 +786,23 @@ jlong CgroupSubsystem::memory_soft_limit_in_bytes() {
 }
 
 jlong CgroupSubsystem::memory_usage_in_bytes() {
-  return memory_controller()->controller()->memory_usage_in_bytes();
+  // os::available_memory() and os::free_memory() read the usage, e.g. after
+  // every compilation to size the compiler thread pool. Cache it like the
+  // limits so that frequent callers do not each read the cgroup file.
+  if (!_memory_usage.should_check_metric()) {
+    return _memory_usage.value();
+  }
+  jlong mem_usage = memory_controller()->controller()->memory_usage_in_bytes();
+  _memory_usage.set_value(mem_usage, OSCONTAINER_CACHE_TIMEOUT);
+  return mem_usage;
+}
+
+jlong CgroupSubsystem::memory_throttle_limit_in_bytes() {
+  return memory_controller()->controller()->memory_throttle_limit_in_bytes();
+}
+
+bool CgroupSubsystem::memory_pressure_some_avg10(double* result) {
+  return memory_controller()->controller()->memory_pressure_some_avg10(result);
 }
 
 jlong CgroupSubsystem::memory_max_usage_in_bytes() {
@@ -224,6 +224,8 @@ class CgroupMemoryController: public CHeapObj<mtInternal> {
     virtual jlong memory_and_swap_limit_in_bytes(julong host_mem, julong host_swap) = 0;
     virtual jlong memory_and_swap_usage_in_bytes(julong host_mem, julong host_swap) = 0;
     virtual jlong memory_soft_limit_in_bytes(julong upper_bound) = 0;
+    virtual jlong memory_throttle_limit_in_bytes() = 0;
+    virtual bool memory_pressure_some_avg10(double* result) = 0;
     virtual jlong memory_max_usage_in_bytes() = 0;
     virtual jlong rss_usage_in_bytes() = 0;
     virtual jlong cache_usage_in_bytes() = 0;
@@ -237,6 +239,8 @@ class CgroupMemoryController: public CHeapObj<mtInternal> {
 };
 
 class CgroupSubsystem: public CHeapObj<mtInternal> {
+  private:
+    CachedMetric _memory_usage;
   public:
     jlong memory_limit_in_bytes();
     int active_processor_count();
@@ -259,6 +263,8 @@ class CgroupSubsystem: public CHeapObj<mtInternal> {
     jlong memory_and_swap_limit_in_bytes();
     jlong memory_and_swap_usage_in_bytes();
     jlong memory_soft_limit_in_bytes();
+    jlong memory_throttle_limit_in_bytes();
+    bool memory_pressure_some_avg10(double* result);
     jlong memory_max_usage_in_bytes();
     jlong rss_usage_in_bytes();
     jlong cache_usage_in_bytes();
@@ -254,6 +254,17 @@ jlong CgroupV1MemoryController::memory_max_usage_in_bytes() {
   return (jlong)memmaxusage;
 }
 
+jlong CgroupV1MemoryController::memory_throttle_limit_in_bytes() {
+  // Log this string at trace level so as to make tests happy.
+  log_trace(os, container)("Memory Throttle Limit is not supported.");
+  return OSCONTAINER_ERROR; // not supported
+}
+
+bool CgroupV1MemoryController::memory_pressure_some_avg10(double* result) {
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return false; // not supported
+}
+
 jlong CgroupV1MemoryController::rss_usage_in_bytes() {
   julong rss;
   bool is_ok = reader()->read_numerical_key_value("/memory.stat", "rss", &rss);
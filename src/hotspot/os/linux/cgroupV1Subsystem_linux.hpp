@@ -82,6 +82,8 @@ class CgroupV1MemoryController final : public CgroupMemoryController {
     jlong memory_and_swap_limit_in_bytes(julong host_mem, julong host_swap) override;
     jlong memory_and_swap_usage_in_bytes(julong host_mem, julong host_swap) override;
     jlong memory_soft_limit_in_bytes(julong upper_bound) override;
+    jlong memory_throttle_limit_in_bytes() override;
+    bool memory_pressure_some_avg10(double* result) override;
     jlong memory_max_usage_in_bytes() override;
     jlong rss_usage_in_bytes() override;
     jlong cache_usage_in_bytes() override;
@@ -173,6 +173,54 @@ jlong CgroupV2MemoryController::memory_soft_limit_in_bytes(julong phys_mem) {
   return mem_soft_limit;
 }
 
+/* memory_throttle_limit_in_bytes
+ *
+ * Return the memory usage above which the processes of this cgroup are
+ * throttled and put under heavy reclaim pressure (memory.high).
+ *
+ * return:
+ *    memory throttle limit in bytes or
+ *    -1 for unlimited
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong CgroupV2MemoryController::memory_throttle_limit_in_bytes() {
+  jlong mem_throttle_limit;
+  CONTAINER_READ_NUMBER_CHECKED_MAX(reader(), "/memory.high", "Memory Throttle Limit", mem_throttle_limit);
+  return mem_throttle_limit;
+}
+
+bool CgroupV2MemoryController::parse_memory_pressure_some_avg10(const char* line, double* result) {
+  // Pressure stall information, see Documentation/accounting/psi.rst. The
+  // first line has the format:
+  // some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+  double avg10;
+  if (sscanf(line, "some avg10=%lf", &avg10) != 1 || avg10 < 0.0 || avg10 > 100.0) {
+    return false;
+  }
+  *result = avg10;
+  return true;
+}
+
+/* memory_pressure_some_avg10
+ *
+ * Return the percentage of wall time in the last 10 seconds in which at least
+ * some tasks of this cgroup were stalled on memory (memory.pressure).
+ *
+ * return:
+ *    false if not supported, true and the percentage in result otherwise
+ */
+bool CgroupV2MemoryController::memory_pressure_some_avg10(double* result) {
+  char line[1024];
+  bool is_ok = reader()->read_string("/memory.pressure", line, sizeof(line)) &&
+               parse_memory_pressure_some_avg10(line, result);
+  if (!is_ok) {
+    log_trace(os, container)("Memory Pressure failed: %d", OSCONTAINER_ERROR);
+    return false;
+  }
+  log_trace(os, container)("Memory Pressure is: %.2f", *result);
+  return true;
+}
+
 jlong CgroupV2MemoryController::memory_max_usage_in_bytes() {
   // Log this string at trace level so as to make tests happy.
   log_trace(os, container)("Maximum Memory Usage is not supported.");
@@ -89,6 +89,10 @@ class CgroupV2MemoryController final: public CgroupMemoryController {
     jlong memory_and_swap_limit_in_bytes(julong host_mem, julong host_swp) override;
     jlong memory_and_swap_usage_in_bytes(julong host_mem, julong host_swp) override;
     jlong memory_soft_limit_in_bytes(julong upper_bound) override;
+    jlong memory_throttle_limit_in_bytes() override;
+    bool memory_pressure_some_avg10(double* result) override;
+    // Parse the "some" avg10 value from the first line of memory.pressure.
+    static bool parse_memory_pressure_some_avg10(const char* line, double* result);
     jlong memory_usage_in_bytes() override;
     jlong memory_max_usage_in_bytes() override;
     jlong rss_usage_in_bytes() override;
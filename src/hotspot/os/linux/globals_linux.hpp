@@ -92,6 +92,11 @@
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
           "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
                                                                         \
+  product(bool, UseMadvCollapse, false, DIAGNOSTIC,                     \
+          "Use MADV_COLLAPSE in os::pd_pretouch_memory to back "        \
+          "pretouched transparent huge page memory with huge pages "    \
+          "right away, rather than waiting for khugepaged.")            \
+                                                                        \
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
@@ -122,6 +122,16 @@ jlong OSContainer::memory_soft_limit_in_bytes() {
   return cgroup_subsystem->memory_soft_limit_in_bytes();
 }
 
+jlong OSContainer::memory_throttle_limit_in_bytes() {
+  assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
+  return cgroup_subsystem->memory_throttle_limit_in_bytes();
+}
+
+bool OSContainer::memory_pressure_some_avg10(double* result) {
+  assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
+  return cgroup_subsystem->memory_pressure_some_avg10(result);
+}
+
 jlong OSContainer::memory_usage_in_bytes() {
   assert(cgroup_subsystem != nullptr, "cgroup subsystem not available");
   return cgroup_subsystem->memory_usage_in_bytes();
@@ -54,6 +54,8 @@ class OSContainer: AllStatic {
   static jlong memory_and_swap_limit_in_bytes();
   static jlong memory_and_swap_usage_in_bytes();
   static jlong memory_soft_limit_in_bytes();
+  static jlong memory_throttle_limit_in_bytes();
+  static bool memory_pressure_some_avg10(double* result);
   static jlong memory_usage_in_bytes();
   static jlong memory_max_usage_in_bytes();
   static jlong rss_usage_in_bytes();
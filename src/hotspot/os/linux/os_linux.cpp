@@ -2987,6 +2987,15 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   STATIC_ASSERT(MADV_POPULATE_WRITE == MADV_POPULATE_WRITE_value);
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#define MADV_COLLAPSE_value 25
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE MADV_COLLAPSE_value
+#else
+  // Sanity-check our assumed default value if we build with a new enough libc.
+  STATIC_ASSERT(MADV_COLLAPSE == MADV_COLLAPSE_value);
+#endif
+
 // Note that the value for MAP_FIXED_NOREPLACE differs between architectures, but all architectures
 // supported by OpenJDK share the same flag value.
 #define MAP_FIXED_NOREPLACE_value 0x100000
@@ -3060,6 +3069,17 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
       log_info(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
                        "error='%s' (errno=%d)", p2i(first), len,
                        MADV_POPULATE_WRITE, os::strerror(err), err);
+    } else if (UseMadvCollapse) {
+      // Depending on the THP defrag setting, the populated range may still be
+      // backed by small pages that only khugepaged would collapse, eventually.
+      // Collapse them now, synchronously. This is best-effort: the kernel may
+      // fail to allocate huge pages, which leaves the memory usable as is.
+      if (::madvise(first, len, MADV_COLLAPSE) == -1) {
+        err = errno;
+        log_debug(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
+                          "error='%s' (errno=%d)", p2i(first), len,
+                          MADV_COLLAPSE, os::strerror(err), err);
+      }
     }
     return 0;
   }
@@ -4662,6 +4682,13 @@ jint os::init_2(void) {
     Linux::numa_init();
   }
 
+  // Check the availability of MADV_COLLAPSE if requested. This has to wait
+  // for the command line flags, unlike the MADV_POPULATE_WRITE check in init().
+  if (UseMadvCollapse && ::madvise(nullptr, 0, MADV_COLLAPSE) != 0) {
+    warning("UseMadvCollapse specified, but MADV_COLLAPSE is not supported by the kernel");
+    FLAG_SET_ERGO(UseMadvCollapse, false);
+  }
+
   if (MaxFDLimit) {
     // set the number of file descriptors to max. print out error
     // if getrlimit/setrlimit fails but continue regardless.
@@ -5476,6 +5503,19 @@ int os::Linux::malloc_info(FILE* stream) {
 }
 #endif // __GLIBC__
 
+bool os::memory_pressure(os::memory_pressure_t* info) {
+  if (!OSContainer::is_containerized()) {
+    return false;
+  }
+  double stall_percent;
+  info->stall_percent = OSContainer::memory_pressure_some_avg10(&stall_percent) ? stall_percent : -1.0;
+  jlong throttle_limit = OSContainer::memory_throttle_limit_in_bytes();
+  info->throttle_limit = throttle_limit > 0 ? throttle_limit : -1;
+  jlong usage = OSContainer::memory_usage_in_bytes();
+  info->usage = usage > 0 ? usage : -1;
+  return info->stall_percent >= 0.0 || info->throttle_limit > 0;
+}
+
 bool os::trim_native_heap(os::size_change_t* rss_change) {
 #ifdef __GLIBC__
   os::Linux::meminfo_t info1;
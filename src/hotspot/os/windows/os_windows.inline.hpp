@@ -90,4 +90,6 @@ inline void PlatformMonitor::notify_all() {
 inline bool os::can_trim_native_heap() { return false; }
 inline bool os::trim_native_heap(os::size_change_t* rss_change) { return false; }
 
+inline bool os::memory_pressure(os::memory_pressure_t* info) { return false; }
+
 #endif // OS_WINDOWS_OS_WINDOWS_INLINE_HPP
@@ -4370,11 +4370,30 @@ int Interval::first_usage(IntervalUseKind min_use_kind) const {
   return max_jint;
 }
 
+// Returns the index of the lowest use position that is >= from, or -2 if there
+// is none. The use positions are strictly descending, so a binary search avoids
+// walking all uses of long-lived intervals in huge methods on every query.
+int Interval::use_pos_index_at_or_after(int from) const {
+  int lo = 0;
+  int hi = _use_pos_and_kinds.length() / 2 - 1;
+  int result = -2;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (_use_pos_and_kinds.at(2 * mid) >= from) {
+      result = 2 * mid;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return result;
+}
+
 int Interval::next_usage(IntervalUseKind min_use_kind, int from) const {
   assert(LinearScan::is_virtual_interval(this), "cannot access use positions for fixed intervals");
 
-  for (int i = _use_pos_and_kinds.length() - 2; i >= 0; i -= 2) {
-    if (_use_pos_and_kinds.at(i) >= from && _use_pos_and_kinds.at(i + 1) >= min_use_kind) {
+  for (int i = use_pos_index_at_or_after(from); i >= 0; i -= 2) {
+    if (_use_pos_and_kinds.at(i + 1) >= min_use_kind) {
       return _use_pos_and_kinds.at(i);
     }
   }
@@ -4384,8 +4403,8 @@ int Interval::next_usage(IntervalUseKind min_use_kind, int from) const {
 int Interval::next_usage_exact(IntervalUseKind exact_use_kind, int from) const {
   assert(LinearScan::is_virtual_interval(this), "cannot access use positions for fixed intervals");
 
-  for (int i = _use_pos_and_kinds.length() - 2; i >= 0; i -= 2) {
-    if (_use_pos_and_kinds.at(i) >= from && _use_pos_and_kinds.at(i + 1) == exact_use_kind) {
+  for (int i = use_pos_index_at_or_after(from); i >= 0; i -= 2) {
+    if (_use_pos_and_kinds.at(i + 1) == exact_use_kind) {
       return _use_pos_and_kinds.at(i);
     }
   }
@@ -538,6 +538,7 @@ class Interval : public CompilationResourceObj {
 
   int              calc_to();
   Interval*        new_split_child();
+  int              use_pos_index_at_or_after(int from) const;
  public:
   Interval(int reg_num);
 
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/archiveHeapLoader.inline.hpp"
+#include "cds/archiveUtils.hpp"
 #include "cds/cdsConfig.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
@@ -156,6 +157,33 @@ class PatchUncompressedEmbeddedPointers: public BitMapClosure {
   }
 };
 
+// Runs a stateless patcher over chunks of an oopmap with ArchiveWorkers.
+template <typename PATCHER>
+class PatchEmbeddedPointersTask : public ArchiveWorkerTask {
+  BitMapView _bm;
+  PATCHER* _patcher;
+
+ public:
+  PatchEmbeddedPointersTask(BitMapView bm, PATCHER* patcher) :
+    ArchiveWorkerTask("Patch Embedded Pointers"), _bm(bm), _patcher(patcher) {}
+
+  void work(int chunk, int max_chunks) override {
+    BitMap::idx_t size  = _bm.size();
+    BitMap::idx_t start = size * chunk / max_chunks;
+    BitMap::idx_t end   = size * (chunk + 1) / max_chunks;
+    if (start < end) {
+      _bm.iterate(_patcher, start, end);
+    }
+  }
+};
+
+template <typename PATCHER>
+static void patch_with_workers(BitMapView bm, PATCHER* patcher) {
+  PatchEmbeddedPointersTask<PATCHER> task(bm, patcher);
+  ArchiveWorkers workers;
+  workers.run_task(&task);
+}
+
 void ArchiveHeapLoader::patch_compressed_embedded_pointers(BitMapView bm,
                                                   FileMapInfo* info,
                                                   MemRegion region) {
@@ -174,12 +202,12 @@ void ArchiveHeapLoader::patch_compressed_embedded_pointers(BitMapView bm,
       log_info(cds)("CDS heap data relocation unnecessary, quick_delta = 0");
     } else {
       PatchCompressedEmbeddedPointersQuick patcher(patching_start, quick_delta);
-      bm.iterate(&patcher);
+      patch_with_workers(bm, &patcher);
     }
   } else {
     log_info(cds)("CDS heap data quick relocation not possible");
     PatchCompressedEmbeddedPointers patcher(patching_start);
-    bm.iterate(&patcher);
+    patch_with_workers(bm, &patcher);
   }
 }
 
@@ -193,7 +221,7 @@ void ArchiveHeapLoader::patch_embedded_pointers(FileMapInfo* info,
     patch_compressed_embedded_pointers(bm, info, region);
   } else {
     PatchUncompressedEmbeddedPointers patcher((oop*)region.start() + FileMapInfo::current_info()->heap_oopmap_start_pos());
-    bm.iterate(&patcher);
+    patch_with_workers(bm, &patcher);
   }
 }
 
@@ -40,10 +40,14 @@
 #include "memory/resourceArea.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/nonJavaThread.hpp"
+#include "runtime/os.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 CHeapBitMap* ArchivePtrMarker::_ptrmap = nullptr;
 CHeapBitMap* ArchivePtrMarker::_rw_ptrmap = nullptr;
@@ -390,3 +394,67 @@ size_t HeapRootSegments::segment_offset(size_t seg_idx) {
   return _base_offset + seg_idx * _max_size_in_bytes;
 }
 
+void ArchiveWorkerTask::run() {
+  while (true) {
+    int chunk = Atomic::fetch_then_add(&_chunk, 1);
+    if (chunk >= _max_chunks) {
+      return;
+    }
+    work(chunk, _max_chunks);
+  }
+}
+
+class ArchiveWorkerThread : public NamedThread {
+  ArchiveWorkers* const _pool;
+  ArchiveWorkerTask* const _task;
+
+public:
+  ArchiveWorkerThread(ArchiveWorkers* pool, ArchiveWorkerTask* task, int id) :
+    _pool(pool), _task(task) {
+    set_name("ArchiveWorkerThread#%d", id);
+  }
+
+  const char* type_name() const override { return "ArchiveWorkerThread"; }
+
+  void run() override {
+    _task->run();
+  }
+
+  void post_run() override {
+    ArchiveWorkers* pool = _pool;
+    this->NonJavaThread::post_run();
+    // The pool may go away as soon as it is signalled, so do not touch it
+    // after this point.
+    pool->worker_done();
+    delete this;
+  }
+};
+
+int ArchiveWorkers::max_workers() {
+  // Relocation is memory bound, and a few threads already saturate the
+  // bandwidth. Use a logarithmic number of workers, and none on a single CPU.
+  return MAX2(0, log2i_graceful(os::active_processor_count()));
+}
+
+void ArchiveWorkers::run_task(ArchiveWorkerTask* task) {
+  int workers = ArchiveParallelRelocation ? max_workers() : 0;
+  task->configure_max_chunks((workers + 1) * CHUNKS_PER_WORKER);
+
+  int started = 0;
+  for (int i = 0; i < workers; i++) {
+    ArchiveWorkerThread* thread = new ArchiveWorkerThread(this, task, i);
+    if (!os::create_thread(thread, os::os_thread)) {
+      // Not fatal, the remaining chunks are processed by the other threads.
+      delete thread;
+      break;
+    }
+    os::start_thread(thread);
+    started++;
+  }
+  log_debug(cds)("Running %s with %d worker threads", task->name(), started);
+
+  task->run();
+  for (int i = 0; i < started; i++) {
+    _end_semaphore.wait();
+  }
+}
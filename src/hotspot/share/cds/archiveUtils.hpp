@@ -28,6 +28,7 @@
 #include "cds/serializeClosure.hpp"
 #include "logging/log.hpp"
 #include "memory/virtualspace.hpp"
+#include "runtime/semaphore.hpp"
 #include "utilities/bitMap.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
@@ -290,4 +291,40 @@ class HeapRootSegments {
   HeapRootSegments& operator=(const HeapRootSegments&) = default;
 };
 
+// A task that is split into chunks. The chunks are claimed and processed by
+// the ArchiveWorkers threads and by the thread that runs the task.
+class ArchiveWorkerTask : public StackObj {
+  const char* _name;
+  int _max_chunks;
+  volatile int _chunk;
+
+public:
+  ArchiveWorkerTask(const char* name) : _name(name), _max_chunks(0), _chunk(0) {}
+  const char* name() const { return _name; }
+
+  void configure_max_chunks(int max_chunks) { _max_chunks = max_chunks; }
+  // Process chunks until all of them are claimed.
+  void run();
+
+  virtual void work(int chunk, int max_chunks) = 0;
+};
+
+// Short-lived worker threads that parallelize archive processing early during
+// startup, before the heap and its worker threads are set up. The threads are
+// started for a single task and exit when it is done.
+class ArchiveWorkers : public StackObj {
+  friend class ArchiveWorkerThread;
+
+  static const int CHUNKS_PER_WORKER = 4;
+
+  Semaphore _end_semaphore;
+
+  static int max_workers();
+  void worker_done() { _end_semaphore.signal(); }
+
+public:
+  ArchiveWorkers() : _end_semaphore(0) {}
+  void run_task(ArchiveWorkerTask* task);
+};
+
 #endif // SHARE_CDS_ARCHIVEUTILS_HPP
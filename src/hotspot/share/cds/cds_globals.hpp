@@ -94,6 +94,10 @@
            "(2) always map at preferred address, and if unsuccessful, "     \
            "do not map the archive")                                        \
            range(0, 2)                                                      \
+                                                                            \
+  product(bool, ArchiveParallelRelocation, false, DIAGNOSTIC,               \
+          "Relocate pointers in the mapped CDS archive and archived heap "  \
+          "with multiple short-lived worker threads")                       \
 // end of CDS_FLAGS
 
 DECLARE_FLAGS(CDS_FLAGS)
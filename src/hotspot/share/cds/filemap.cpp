@@ -1946,6 +1946,36 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Patches the pointers marked in the rw and ro bitmaps. Each chunk covers the
+// same fraction of both bitmaps; the bits, and so the patched words, of
+// different chunks are disjoint.
+class SharedDataRelocationTask : public ArchiveWorkerTask {
+  BitMapView* const _rw_bm;
+  SharedDataRelocator* const _rw_reloc;
+  BitMapView* const _ro_bm;
+  SharedDataRelocator* const _ro_reloc;
+
+  static void work_on(int chunk, int max_chunks, BitMapView* bm, SharedDataRelocator* reloc) {
+    BitMap::idx_t size  = bm->size();
+    BitMap::idx_t start = size * chunk / max_chunks;
+    BitMap::idx_t end   = size * (chunk + 1) / max_chunks;
+    if (start < end) {
+      bm->iterate(reloc, start, end);
+    }
+  }
+
+public:
+  SharedDataRelocationTask(BitMapView* rw_bm, SharedDataRelocator* rw_reloc,
+                           BitMapView* ro_bm, SharedDataRelocator* ro_reloc) :
+    ArchiveWorkerTask("Shared Data Relocation"),
+    _rw_bm(rw_bm), _rw_reloc(rw_reloc), _ro_bm(ro_bm), _ro_reloc(ro_reloc) {}
+
+  void work(int chunk, int max_chunks) override {
+    work_on(chunk, max_chunks, _rw_bm, _rw_reloc);
+    work_on(chunk, max_chunks, _ro_bm, _ro_reloc);
+  }
+};
+
 // This is called when we cannot map the archive at the requested[ base address (usually 0x800000000).
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
@@ -1984,8 +2014,9 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
                                 valid_new_base, valid_new_end, addr_delta);
     SharedDataRelocator ro_patcher((address*)ro_patch_base + header()->ro_ptrmap_start_pos(), (address*)ro_patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    rw_ptrmap.iterate(&rw_patcher);
-    ro_ptrmap.iterate(&ro_patcher);
+    SharedDataRelocationTask task(&rw_ptrmap, &rw_patcher, &ro_ptrmap, &ro_patcher);
+    ArchiveWorkers workers;
+    workers.run_task(&task);
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
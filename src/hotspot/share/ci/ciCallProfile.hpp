@@ -27,6 +27,7 @@
 
 #include "ci/ciClassList.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/debug.hpp"
 
 // ciCallProfile
 //
@@ -38,14 +39,18 @@ class ciCallProfile : StackObj {
   friend class ciMethod;
   friend class ciMethodHandle;
 
-  enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  enum { DefaultMorphismLimit = 2, // Max call site's morphism we usually care about
+         MorphismLimit = 8 };       // Max call site's morphism we can record (TypeProfileWidth)
+  int  _morphism_limit;       // max number of receivers to determine
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
   int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
   ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
 
-  ciCallProfile() {
+  ciCallProfile(int morphism_limit) {
+    assert(morphism_limit > 0 && morphism_limit <= MorphismLimit, "out of range: %d", morphism_limit);
+    _morphism_limit = morphism_limit;
     _limit = 0;
     _morphism    = 0;
     _count = -1;
@@ -59,6 +64,7 @@ class ciCallProfile : StackObj {
   // Note:  The following predicates return false for invalid profiles:
   bool      has_receiver(int i) const { return _limit > i; }
   int       morphism() const          { return _morphism; }
+  int       morphism_limit() const    { return _morphism_limit; }
 
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
@@ -242,6 +242,15 @@ static bool trust_final_non_static_fields(ciInstanceKlass* holder) {
   // Trust final fields in String
   if (holder->name() == ciSymbols::java_lang_String())
     return true;
+  // Trust final fields in the immutable collections behind List.of, Set.of and Map.of.
+  // Their state is fixed at construction and they are serialized through a proxy
+  // (CollSer), so deserialization never writes their finals.
+  if (holder->is_in_package("java/util")) {
+    const char* const prefix = "java/util/ImmutableCollections";
+    if (holder->name()->starts_with(prefix, (int)strlen(prefix))) {
+      return true;
+    }
+  }
   // Trust Atomic*FieldUpdaters: they are very important for performance, and make up one
   // more reason not to use Unsafe, if their final fields are trusted. See more in JDK-8140483.
   if (holder->name() == ciSymbols::java_util_concurrent_atomic_AtomicIntegerFieldUpdater_Impl() ||
@@ -461,9 +461,9 @@ int ciMethod::check_overflow(int c, Bytecodes::Code code) {
 //
 // Get the ciCallProfile for the invocation of this method.
 // Also reports receiver types for non-call type checks (if TypeProfileCasts).
-ciCallProfile ciMethod::call_profile_at_bci(int bci) {
+ciCallProfile ciMethod::call_profile_at_bci(int bci, int morphism_limit) {
   ResourceMark rm;
-  ciCallProfile result;
+  ciCallProfile result(morphism_limit);
   if (method_data() != nullptr && method_data()->is_mature()) {
     ciProfileData* data = method_data()->bci_to_data(bci);
     if (data != nullptr && data->is_CounterData()) {
@@ -504,13 +504,15 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
           // we will set result._method also.
         }
         // Determine call site's morphism.
-        // The call site count is 0 with known morphism (only 1 or 2 receivers)
-        // or < 0 in the case of a type check failure for checkcast, aastore, instanceof.
+        // The call site count is 0 with known morphism (only up to morphism_limit
+        // receivers) or < 0 in the case of a type check failure for checkcast,
+        // aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
+        const int limit = MIN2(morphism_limit, (int)call->row_limit());
         if (morphism > 0 && morphism == result._limit) {
-           // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           // The morphism <= limit.
+           if ((morphism <  limit) ||
+               (morphism == limit && count == 0)) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
@@ -550,7 +552,7 @@ void ciCallProfile::add_receiver(ciKlass* receiver, int receiver_count) {
   }
   _receiver[i] = receiver;
   _receiver_count[i] = receiver_count;
-  if (_limit < MorphismLimit) _limit++;
+  if (_limit < _morphism_limit) _limit++;
 }
 
 
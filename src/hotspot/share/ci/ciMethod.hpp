@@ -25,6 +25,7 @@
 #ifndef SHARE_CI_CIMETHOD_HPP
 #define SHARE_CI_CIMETHOD_HPP
 
+#include "ci/ciCallProfile.hpp"
 #include "ci/ciFlags.hpp"
 #include "ci/ciInstanceKlass.hpp"
 #include "ci/ciObject.hpp"
@@ -263,7 +264,7 @@ class ciMethod : public ciMetadata {
 
   ciTypeFlow*   get_flow_analysis();
   ciTypeFlow*   get_osr_flow_analysis(int osr_bci);  // alternate entry point
-  ciCallProfile call_profile_at_bci(int bci);
+  ciCallProfile call_profile_at_bci(int bci, int morphism_limit = ciCallProfile::DefaultMorphismLimit);
 
   // Does type profiling provide any useful information at this point?
   bool          argument_profiled_type(int bci, int i, ciKlass*& type, ProfilePtrKind& ptr_kind);
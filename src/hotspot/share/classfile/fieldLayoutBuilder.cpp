@@ -492,6 +492,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _field_info(field_info),
   _info(info),
   _root_group(nullptr),
+  _hot_group(nullptr),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(nullptr),
   _layout(nullptr),
@@ -525,6 +526,32 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
+}
+
+// Returns true if the field is listed in HotInstanceFields. Entries are
+// <internal class name>.<field name>; field names cannot contain a '.'.
+static bool is_listed_hot_field(const Symbol* classname, const Symbol* fieldname) {
+  const char* p = HotInstanceFields;
+  while (*p != '\0') {
+    while (*p == ',' || *p == ' ' || *p == '\n') {
+      p++;
+    }
+    const char* start = p;
+    const char* dot = nullptr;
+    while (*p != '\0' && *p != ',' && *p != ' ' && *p != '\n') {
+      if (*p == '.') {
+        dot = p;
+      }
+      p++;
+    }
+    if (dot != nullptr &&
+        classname->equals(start, (int)(dot - start)) &&
+        fieldname->equals(dot + 1, (int)(p - dot - 1))) {
+      return true;
+    }
+  }
+  return false;
 }
 
 // Field sorting for regular classes:
@@ -532,7 +559,10 @@ void FieldLayoutBuilder::prologue() {
 //   - non-static fields are also sorted according to their contention group
 //     (support of the @Contended annotation)
 //   - @Contended annotation is ignored for static fields
+//   - non-contended fields listed in HotInstanceFields are put in a group
+//     of their own, which is laid out before the other fields
 void FieldLayoutBuilder::regular_field_sorting() {
+  const bool has_hot_fields = HotInstanceFields != nullptr && HotInstanceFields[0] != '\0';
   int idx = 0;
   for (GrowableArrayIterator<FieldInfo> it = _field_info->begin(); it != _field_info->end(); ++it, ++idx) {
     FieldInfo ctrl = _field_info->at(0);
@@ -550,6 +580,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (has_hot_fields && is_listed_hot_field(_classname, fieldinfo.name(_constant_pool))) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -577,6 +609,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  _hot_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -609,6 +642,8 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -645,6 +680,13 @@ void FieldLayoutBuilder::epilogue() {
     _super_klass->nonstatic_oop_map_count());
   }
 
+  if (_hot_group->oop_fields() != nullptr) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (_root_group->oop_fields() != nullptr) {
     for (int i = 0; i < _root_group->oop_fields()->length(); i++) {
       LayoutRawBlock* b = _root_group->oop_fields()->at(i);
@@ -38,6 +38,8 @@
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -470,7 +472,74 @@ struct StringTableDeleteCheck : StackObj {
   }
 };
 
+// Workers for parallel cleaning, created on first use.
+static WorkerThreads* _clean_workers = nullptr;
+
+class StringTableCleanTask : public WorkerTask {
+  StringTableHash::BulkDeleteTask* _bdt;
+  volatile long _count;
+  volatile long _item;
+  volatile uint _num_workers;
+
+ public:
+  StringTableCleanTask(StringTableHash::BulkDeleteTask* bdt) :
+    WorkerTask("StringTable Clean"), _bdt(bdt), _count(0), _item(0), _num_workers(0) {}
+
+  void work(uint worker_id) {
+    // Join the suspendible thread set so that safepoints wait for a worker to
+    // finish its current range instead of running concurrently with it.
+    SuspendibleThreadSetJoiner sts_join;
+    Thread* thread = Thread::current();
+    StringTableDeleteCheck stdc;
+    StringTableDoDelete stdd;
+    while (_bdt->do_task(thread, stdc, stdd)) {
+      SuspendibleThreadSet::yield();
+    }
+    log_trace(stringtable)("Worker %u cleaned %ld of %ld", worker_id, stdc._count, stdc._item);
+    Atomic::add(&_count, stdc._count);
+    Atomic::add(&_item, stdc._item);
+    Atomic::inc(&_num_workers);
+  }
+
+  long count() const { return _count; }
+  long item() const { return _item; }
+  uint num_workers() const { return _num_workers; }
+};
+
+void StringTable::clean_dead_entries_parallel(JavaThread* jt) {
+  StringTableHash::BulkDeleteTask bdt(_local_table, true /* is_mt */);
+  if (!bdt.prepare(jt)) {
+    return;
+  }
+
+  if (_clean_workers == nullptr) {
+    _clean_workers = new WorkerThreads("StringTable Clean", StringTableCleanupThreads);
+    _clean_workers->initialize_workers();
+  }
+
+  StringTableCleanTask task(&bdt);
+  NativeHeapTrimmer::SuspendMark sm("stringtable");
+  {
+    TraceTime timer("Clean", TRACETIME_LOG(Debug, stringtable, perf));
+    // Let safepoints proceed while the workers run; the workers yield to them.
+    bdt.pause(jt);
+    {
+      ThreadBlockInVM tbivm(jt);
+      _clean_workers->run_task(&task, StringTableCleanupThreads);
+    }
+    bdt.cont(jt);
+    bdt.done(jt);
+  }
+  log_debug(stringtable)("Cleaned %ld of %ld using %u workers",
+                         task.count(), task.item(), task.num_workers());
+}
+
 void StringTable::clean_dead_entries(JavaThread* jt) {
+  if (StringTableCleanupThreads > 1) {
+    clean_dead_entries_parallel(jt);
+    return;
+  }
+
   StringTableHash::BulkDeleteTask bdt(_local_table);
   if (!bdt.prepare(jt)) {
     return;
@@ -52,6 +52,7 @@ class StringTable : AllStatic {
 
   static void grow(JavaThread* jt);
   static void clean_dead_entries(JavaThread* jt);
+  static void clean_dead_entries_parallel(JavaThread* jt);
 
   static double get_load_factor();
   static double get_dead_factor(size_t num_dead);
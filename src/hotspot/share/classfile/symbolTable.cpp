@@ -37,6 +37,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.inline.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "services/diagnosticCommand.hpp"
@@ -326,6 +327,19 @@ Symbol* SymbolTable::lookup_shared(const char* name,
 
 Symbol* SymbolTable::lookup_common(const char* name,
                             int len, unsigned int hash) {
+  // Class file parsing looks up the same descriptors and names over and
+  // over. Try the current thread's cache of permanent symbols first, which
+  // avoids the table's critical section and bucket walk entirely.
+  Thread* thread = Thread::current_or_null();
+  Symbol** cached = nullptr;
+  if (thread != nullptr && thread->is_Java_thread()) {
+    cached = JavaThread::cast(thread)->symbol_cache_at(hash);
+    Symbol* sym = *cached;
+    if (sym != nullptr && sym->equals(name, len)) {
+      return sym;
+    }
+  }
+
   Symbol* sym;
   if (_lookup_shared_first) {
     sym = lookup_shared(name, len, hash);
@@ -342,6 +356,9 @@ Symbol* SymbolTable::lookup_common(const char* name,
       }
     }
   }
+  if (cached != nullptr && sym != nullptr && sym->is_permanent()) {
+    *cached = sym;
+  }
   return sym;
 }
 
@@ -47,6 +47,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/method.inline.hpp"
+#include "oops/methodData.hpp"
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/verifyOopClosure.hpp"
@@ -1778,6 +1779,55 @@ void CodeCache::print_codelist(outputStream* st) {
   }
 }
 
+static int nmethod_hotness(nmethod* nm) {
+  Method* m = nm->method();
+  // Saturate, the counters are ints and their sum could overflow.
+  return (int)MIN2((jlong)m->invocation_count() + m->backedge_count(), (jlong)max_jint);
+}
+
+static int compare_nmethod_hotness(nmethod** a, nmethod** b) {
+  int ha = nmethod_hotness(*a);
+  int hb = nmethod_hotness(*b);
+  return (ha > hb) ? -1 : ((ha < hb) ? 1 : 0);
+}
+
+// Print the count compiled Java methods with the highest invocation and
+// backedge counts. The counters are only updated by the interpreter and
+// by profiled code, so for tier 4 code they show how hot the method was
+// when it was compiled.
+void CodeCache::print_hotspots(outputStream* st, int count) {
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  ResourceMark rm;
+
+  GrowableArray<nmethod*> nmethods;
+  NMethodIterator iter(NMethodIterator::not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    if (nm->is_in_use() && !nm->is_native_method()) {
+      nmethods.append(nm);
+    }
+  }
+  nmethods.sort(compare_nmethod_hotness);
+
+  st->print_cr("%10s %7s %5s %8s %8s %8s  %s", "counters", "id", "level", "size", "traps", "decomp", "method");
+  for (int i = 0; i < nmethods.length() && i < count; i++) {
+    nmethod* nm = nmethods.at(i);
+    MethodData* mdo = nm->method()->method_data();
+    uint traps = 0;
+    uint decompiles = 0;
+    if (mdo != nullptr) {
+      for (uint reason = 0; reason < MethodData::trap_reason_limit(); reason++) {
+        traps += mdo->trap_count(reason);
+      }
+      decompiles = mdo->decompile_count();
+    }
+    st->print_cr("%10d %7d %5d %8d %8u %8u  %s%s",
+                 nmethod_hotness(nm), nm->compile_id(), nm->comp_level(), nm->size(),
+                 traps, decompiles, nm->method()->name_and_sig_as_C_string(),
+                 nm->is_osr_method() ? " (osr)" : "");
+  }
+}
+
 void CodeCache::print_layout(outputStream* st) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   ResourceMark rm;
@@ -233,6 +233,7 @@ class CodeCache : AllStatic {
 
   // Dcmd (Diagnostic commands)
   static void print_codelist(outputStream* st);
+  static void print_hotspots(outputStream* st, int count);
   static void print_layout(outputStream* st);
 
   // The full limits of the codeCache
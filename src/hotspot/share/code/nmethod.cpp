@@ -327,17 +327,6 @@ ExceptionCache::ExceptionCache(Handle exception, address pc, address handler) {
 }
 
 
-address ExceptionCache::match(Handle exception, address pc) {
-  assert(pc != nullptr,"Must be non null");
-  assert(exception.not_null(),"Must be non null");
-  if (exception->klass() == exception_type()) {
-    return (test_address(pc));
-  }
-
-  return nullptr;
-}
-
-
 bool ExceptionCache::match_exception_with_space(Handle exception) {
   assert(exception.not_null(),"Must be non null");
   if (exception->klass() == exception_type() && count() < cache_size) {
@@ -582,11 +571,18 @@ address nmethod::handler_for_exception_and_pc(Handle exception, address pc) {
   // We never grab a lock to read the exception cache, so we may
   // have false negatives. This is okay, as it can only happen during
   // the first few exception lookups for a given nmethod.
+  assert(pc != nullptr, "Must be non null");
+  assert(exception.not_null(), "Must be non null");
+  // Decode the exception klass once rather than for every entry; a type
+  // that is thrown from many sites can have several full entries.
+  Klass* exception_type = exception->klass();
   ExceptionCache* ec = exception_cache_acquire();
   while (ec != nullptr) {
-    address ret_val;
-    if ((ret_val = ec->match(exception,pc)) != nullptr) {
-      return ret_val;
+    if (ec->exception_type() == exception_type) {
+      address ret_val = ec->test_address(pc);
+      if (ret_val != nullptr) {
+        return ret_val;
+      }
     }
     ec = ec->next();
   }
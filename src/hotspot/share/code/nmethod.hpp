@@ -82,7 +82,6 @@ class ExceptionCache : public CHeapObj<mtCode> {
   ExceptionCache* purge_list_next()                 { return _purge_list_next; }
   void      set_purge_list_next(ExceptionCache *ec) { _purge_list_next = ec; }
 
-  address match(Handle exception, address pc);
   bool    match_exception_with_space(Handle exception) ;
   address test_address(address addr);
   bool    add_address_and_handler(address addr, address handler) ;
@@ -64,6 +64,7 @@ void ArenaStatCounter::reset() {
   _hit_limit = false;
   _limit_in_process = false;
   _live_nodes_at_peak = 0;
+  _phase_at_peak = nullptr;
   _active = false;
 }
 
@@ -90,6 +91,7 @@ void ArenaStatCounter::update_c2_node_count() {
     const Compile* const comp = Compile::current();
     if (comp != nullptr) {
       _live_nodes_at_peak = comp->live_nodes();
+      _phase_at_peak = comp->current_phase_name();
     }
   }
 #endif
@@ -132,6 +134,9 @@ void ArenaStatCounter::print_on(outputStream* st) const {
     }
   }
   st->print("]");
+  if (_phase_at_peak != nullptr) {
+    st->print(" peak in phase %s", _phase_at_peak);
+  }
 #ifdef ASSERT
   st->print(" (%zu->%zu)", _peak, _current);
 #endif
@@ -197,6 +202,8 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   ArenaCountersByTag _peak_by_tag;
   // number of nodes (c2 only) when total peaked
   unsigned _live_nodes_at_peak;
+  // c2 phase when total peaked
+  const char* _phase_at_peak;
   const char* _result;
 
 public:
@@ -204,7 +211,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   MemStatEntry(FullMethodName method)
     : _method(method), _comptype(compiler_c1),
       _time(0), _num_recomp(0), _thread(nullptr), _limit(0),
-      _total(0), _live_nodes_at_peak(0),
+      _total(0), _live_nodes_at_peak(0), _phase_at_peak(nullptr),
       _result(nullptr) {
     _peak_by_tag.clear();
   }
@@ -218,6 +225,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
   void set_total(size_t n) { _total = n; }
   void set_peak_by_tag(ArenaCountersByTag peak_by_tag) { _peak_by_tag = peak_by_tag; }
   void set_live_nodes_at_peak(unsigned n) { _live_nodes_at_peak = n; }
+  void set_phase_at_peak(const char* s) { _phase_at_peak = s; }
 
   void set_result(const char* s) { _result = s; }
 
@@ -232,6 +240,7 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     }
     st->print_cr("  " LEGEND_KEY_FMT ": %s", "result", "Result: 'ok' finished successfully, 'oom' hit memory limit, 'err' compilation failed");
     st->print_cr("  " LEGEND_KEY_FMT ": %s", "#nodes", "...how many nodes (c2 only)");
+    st->print_cr("  " LEGEND_KEY_FMT ": %s", "phase", "...in which phase (c2 only)");
     st->print_cr("  " LEGEND_KEY_FMT ": %s", "limit", "memory limit, if set");
     st->print_cr("  " LEGEND_KEY_FMT ": %s", "time", "time taken for last compilation (sec)");
     st->print_cr("  " LEGEND_KEY_FMT ": %s", "type", "compiler type");
@@ -246,10 +255,10 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     for (int tag = 0; tag < Arena::tag_count(); tag++) {
       st->print(SIZE_FMT, Arena::tag_name[tag]);
     }
-#define HDR_FMT1 "%-8s%-8s%-8s%-8s"
+#define HDR_FMT1 "%-8s%-8s%-26s%-8s%-8s"
 #define HDR_FMT2 "%-6s%-4s%-19s%s"
 
-    st->print(HDR_FMT1, "result", "#nodes", "limit", "time");
+    st->print(HDR_FMT1, "result", "#nodes", "phase", "limit", "time");
     st->print(HDR_FMT2, "type", "#rc", "thread", "method");
     st->print_cr("");
   }
@@ -286,6 +295,10 @@ class MemStatEntry : public CHeapObj<mtInternal> {
     }
     col += 8; st->fill_to(col);
 
+    // Phase when memory peaked
+    st->print("%s ", _phase_at_peak != nullptr ? _phase_at_peak : "-");
+    col += 26; st->fill_to(col);
+
     // Limit
     if (_limit > 0) {
       st->print(PROPERFMT " ", PROPERFMTARGS(_limit));
@@ -353,7 +366,8 @@ class MemStatTable :
 
   void add(const FullMethodName& fmn, CompilerType comptype,
            size_t total, ArenaCountersByTag peak_by_tag,
-           unsigned live_nodes_at_peak, size_t limit, const char* result) {
+           unsigned live_nodes_at_peak, const char* phase_at_peak,
+           size_t limit, const char* result) {
     assert_lock_strong(NMTCompilationCostHistory_lock);
     MemStatTableKey key(fmn, comptype);
     MemStatEntry** pe = get(key);
@@ -373,6 +387,7 @@ class MemStatTable :
     e->set_total(total);
     e->set_peak_by_tag(peak_by_tag);
     e->set_live_nodes_at_peak(live_nodes_at_peak);
+    e->set_phase_at_peak(phase_at_peak);
     e->set_limit(limit);
     e->set_result(result);
   }
@@ -460,6 +475,7 @@ void CompilationMemoryStatistic::on_end_compilation() {
                     arena_stat->peak(), // total
                     arena_stat->peak_by_tag(),
                     arena_stat->live_nodes_at_peak(),
+                    arena_stat->phase_at_peak(),
                     arena_stat->limit(),
                     result);
   }
@@ -80,6 +80,8 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
 
   // Number of live nodes when total peaked (c2 only)
   unsigned _live_nodes_at_peak;
+  // C2 phase in effect when total peaked (c2 only, static string)
+  const char* _phase_at_peak;
 
   void update_c2_node_count();
 
@@ -94,6 +96,7 @@ class ArenaStatCounter : public CHeapObj<mtCompiler> {
   // Peak details
   ArenaCountersByTag peak_by_tag() const { return _peak_by_tag; }
   unsigned live_nodes_at_peak() const { return _live_nodes_at_peak; }
+  const char* phase_at_peak() const { return _phase_at_peak; }
 
   // Mark the start and end of a compilation.
   void start(size_t limit);
@@ -41,6 +41,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -621,6 +622,7 @@ void CompilationPolicy::handle_counter_overflow(const methodHandle& method) {
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = nullptr;
   CompileTask *max_task = nullptr;
+  CompileTask *oldest_task = nullptr;
   Method* max_method = nullptr;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
@@ -658,9 +660,21 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       }
     }
 
+    if (oldest_task == nullptr || task->time_queued() < oldest_task->time_queued()) {
+      oldest_task = task;
+    }
+
     task = next_task;
   }
 
+  if (TieredCompileTaskMaxWait > 0 && oldest_task != nullptr && oldest_task != max_task &&
+      TimeHelper::counter_to_millis(os::elapsed_counter() - oldest_task->time_queued()) > TieredCompileTaskMaxWait) {
+    // Age the queue: a task that has waited too long is selected even if other
+    // methods have a higher event rate, so that it cannot starve.
+    max_task = oldest_task;
+    max_method = max_task->method();
+  }
+
   if (max_blocking_task != nullptr) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
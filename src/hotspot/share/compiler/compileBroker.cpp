@@ -553,10 +553,14 @@ void CompileQueue::print(outputStream* st) {
   if (task == nullptr) {
     st->print_cr("Empty");
   } else {
+    jlong now = os::elapsed_counter();
+    jlong max_wait = 0;
     while (task != nullptr) {
       task->print(st, nullptr, true, true);
+      max_wait = MAX2(max_wait, now - task->time_queued());
       task = task->next();
     }
+    st->print_cr("%d tasks, longest wait %.0f ms", size(), TimeHelper::counter_to_millis(max_wait));
   }
   st->cr();
 }
@@ -1021,6 +1025,18 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+// Upper bound for the number of threads of one compiler, given the
+// threads already running for the other compiler.
+static int active_processor_limit(AbstractCompiler* other) {
+  if (!LimitCompilerThreadsToActiveProcessors) {
+    return max_jint;
+  }
+  int other_count = (other != nullptr) ? other->num_compiler_threads() : 0;
+  // os::active_processor_count() takes container CPU quotas into account
+  // and is re-evaluated here, so the limit follows quota changes.
+  return MAX2(1, os::active_processor_count() - other_count);
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
@@ -1037,6 +1053,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, active_processor_limit(_compilers[0]));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1098,6 +1115,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, active_processor_limit(_compilers[1]));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2239,7 +2257,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
         }
         methodHandle method(thread, target_handle);
         runtime = env.runtime();
+        jlong allocated_before = thread->cooked_allocated_bytes();
         runtime->compile_method(&env, jvmci, method, osr_bci);
+        jvmci->add_java_heap_allocated_bytes(thread->cooked_allocated_bytes() - allocated_before);
 
         failure_reason = compile_state.failure_reason();
         failure_reason_on_C_heap = compile_state.failure_reason_on_C_heap();
@@ -247,6 +247,12 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskMaxWait, 0, EXPERIMENTAL,                  \
+          "Select a compile task that has waited in the queue for longer "  \
+          "than the given time in milliseconds ahead of tasks with a "      \
+          "higher event rate. 0 disables aging")                            \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
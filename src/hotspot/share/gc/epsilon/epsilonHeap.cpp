@@ -30,14 +30,19 @@
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/tlab_globals.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
+#include "memory/padded.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -61,6 +66,19 @@ jint EpsilonHeap::initialize() {
   _step_heap_print = (EpsilonPrintHeapSteps == 0) ? SIZE_MAX : (max_byte_size / EpsilonPrintHeapSteps);
   _decay_time_ns = (int64_t) EpsilonTLABDecayTime * NANOSECS_PER_MILLISEC;
 
+  // Prepare chunked TLAB allocation, if enabled
+  if (UseTLAB && EpsilonAllocationChunkSize > 0) {
+    _chunk_size = align_object_size(MAX2(EpsilonAllocationChunkSize / HeapWordSize, 2 * _max_tlab_size));
+    // os::processor_id() is not available on AIX, use a single chunk there
+    _num_chunk_slots = UseNUMA ? (uint) os::numa_get_groups_num() : NOT_AIX((uint) os::processor_count()) AIX_ONLY(1);
+    _num_chunk_slots = MAX2(_num_chunk_slots, 1u);
+    _chunk_slots = PaddedArray<EpsilonChunkSlot, mtGC>::create_unfreeable(_num_chunk_slots);
+    for (uint i = 0; i < _num_chunk_slots; i++) {
+      _chunk_slots[i]._chunk = nullptr;
+      _chunk_slots[i]._lock = new Mutex(Mutex::nosafepoint, "EpsilonChunk_lock");
+    }
+  }
+
   // Enable monitoring
   _monitoring_support = new EpsilonMonitoringSupport(this);
   _last_counter_update = 0;
@@ -150,10 +168,17 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
     }
   }
 
-  size_t used = _space->used();
+  if (verbose) {
+    update_counters_and_print(_space->used());
+  }
+
+  assert(is_object_aligned(res), "Object should be aligned: " PTR_FORMAT, p2i(res));
+  return res;
+}
 
+void EpsilonHeap::update_counters_and_print(size_t used) {
   // Allocation successful, update counters
-  if (verbose) {
+  {
     size_t last = _last_counter_update;
     if ((used - last >= _step_counter_update) && Atomic::cmpxchg(&_last_counter_update, last, used) == last) {
       _monitoring_support->update_counters();
@@ -161,15 +186,101 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
   }
 
   // ...and print the occupancy line, if needed
-  if (verbose) {
+  {
     size_t last = _last_heap_print;
     if ((used - last >= _step_heap_print) && Atomic::cmpxchg(&_last_heap_print, last, used) == last) {
       print_heap_info(used);
       print_metaspace_info();
     }
   }
+}
+
+HeapWord* EpsilonAllocChunk::par_allocate(size_t size) {
+  HeapWord* top = Atomic::load_acquire(&_top);
+  while (true) {
+    size_t available = pointer_delta(_end, top);
+    // Leave either nothing or enough to fit a filler when the chunk is retired
+    if (size > available ||
+        (size < available && available - size < CollectedHeap::min_fill_size())) {
+      return nullptr;
+    }
+    HeapWord* witness = Atomic::cmpxchg(&_top, top, top + size);
+    if (witness == top) {
+      return top;
+    }
+    top = witness;
+  }
+}
+
+void EpsilonAllocChunk::retire() {
+  HeapWord* top = Atomic::xchg(&_top, _end);
+  if (top < _end) {
+    CollectedHeap::fill_with_objects(top, pointer_delta(_end, top));
+  }
+}
+
+HeapWord* EpsilonHeap::allocate_from_chunk(size_t size) {
+  // Large requests would waste most of a chunk, take them from the shared space
+  if (size > _chunk_size / 2) {
+    return allocate_work(size);
+  }
 
-  assert(is_object_aligned(res), "Object should be aligned: " PTR_FORMAT, p2i(res));
+  uint id = UseNUMA ? (uint) os::numa_get_group_id() : NOT_AIX(os::processor_id()) AIX_ONLY(0);
+  EpsilonChunkSlot* slot = &_chunk_slots[id % _num_chunk_slots];
+  Thread* thread = Thread::current();
+
+  {
+    // The chunk may be retired and freed by a concurrent refill
+    GlobalCounter::CriticalSection cs(thread);
+    EpsilonAllocChunk* chunk = Atomic::load_acquire(&slot->_chunk);
+    if (chunk != nullptr) {
+      HeapWord* res = chunk->par_allocate(size);
+      if (res != nullptr) {
+        return res;
+      }
+    }
+  }
+
+  HeapWord* res = nullptr;
+  EpsilonAllocChunk* retired = nullptr;
+  {
+    MutexLocker ml(slot->_lock, Mutex::_no_safepoint_check_flag);
+
+    // Another thread might have installed a fresh chunk already
+    EpsilonAllocChunk* chunk = slot->_chunk;
+    if (chunk != nullptr) {
+      res = chunk->par_allocate(size);
+      if (res != nullptr) {
+        return res;
+      }
+      chunk->retire();
+      Atomic::release_store(&slot->_chunk, (EpsilonAllocChunk*) nullptr);
+      retired = chunk;
+    }
+
+    // Heap_lock cannot be taken here, so only claim from committed space
+    HeapWord* start = _space->par_allocate(_chunk_size);
+    if (start != nullptr) {
+      EpsilonAllocChunk* fresh = new EpsilonAllocChunk(start, start + _chunk_size);
+      res = fresh->par_allocate(size);
+      assert(res == start, "Fresh chunk should fit the allocation");
+      Atomic::release_store(&slot->_chunk, fresh);
+    }
+  }
+
+  if (retired != nullptr) {
+    // Wait for threads that may still be allocating from the retired chunk
+    GlobalCounter::write_synchronize();
+    delete retired;
+  }
+
+  if (res == nullptr) {
+    // No committed space for another chunk, let the shared path expand the heap
+    return allocate_work(size);
+  }
+
+  // Counters and heap printing take other locks, do them outside the slot lock
+  update_counters_and_print(_space->used());
   return res;
 }
 
@@ -239,7 +350,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   }
 
   // All prepared, let's do it!
-  HeapWord* res = allocate_work(size);
+  HeapWord* res = (_chunk_slots != nullptr) ? allocate_from_chunk(size) : allocate_work(size);
 
   if (res != nullptr) {
     // Allocation successful
@@ -294,6 +405,19 @@ void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
   collect(gc_cause());
 }
 
+void EpsilonHeap::ensure_parsability(bool retire_tlabs) {
+  // No thread can be in the middle of allocate_from_chunk at a safepoint.
+  for (uint i = 0; i < _num_chunk_slots; i++) {
+    EpsilonAllocChunk* chunk = _chunk_slots[i]._chunk;
+    if (chunk != nullptr) {
+      chunk->retire();
+      _chunk_slots[i]._chunk = nullptr;
+      delete chunk;
+    }
+  }
+  CollectedHeap::ensure_parsability(retire_tlabs);
+}
+
 void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
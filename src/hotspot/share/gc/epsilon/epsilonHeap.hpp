@@ -31,9 +31,35 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
+#include "memory/padded.hpp"
 #include "memory/virtualspace.hpp"
 #include "services/memoryManager.hpp"
 
+class Mutex;
+
+// A piece of the heap that TLABs for one CPU or NUMA node are carved from,
+// see EpsilonAllocationChunkSize. Threads allocate from the current chunk of
+// a slot in a GlobalCounter critical section, so a retired descriptor is only
+// freed after a write_synchronize.
+class EpsilonAllocChunk : public CHeapObj<mtGC> {
+private:
+  HeapWord* volatile _top;
+  HeapWord* const    _end;
+
+public:
+  EpsilonAllocChunk(HeapWord* start, HeapWord* end) : _top(start), _end(end) {}
+
+  HeapWord* par_allocate(size_t size);
+
+  // Stop further allocations and make the unused tail parsable.
+  void retire();
+};
+
+struct EpsilonChunkSlot {
+  EpsilonAllocChunk* volatile _chunk;
+  Mutex* _lock;
+};
+
 class EpsilonHeap : public CollectedHeap {
   friend class VMStructs;
 private:
@@ -48,13 +74,22 @@ class EpsilonHeap : public CollectedHeap {
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  PaddedEnd<EpsilonChunkSlot>* _chunk_slots;
+  uint _num_chunk_slots;
+  size_t _chunk_size;
+
+  HeapWord* allocate_from_chunk(size_t size);
+  void update_counters_and_print(size_t used);
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap"),
-          _space(nullptr) {};
+          _space(nullptr),
+          _chunk_slots(nullptr),
+          _num_chunk_slots(0),
+          _chunk_size(0) {};
 
   Name kind() const override {
     return CollectedHeap::Epsilon;
@@ -101,6 +136,8 @@ class EpsilonHeap : public CollectedHeap {
   void collect(GCCause::Cause cause) override;
   void do_full_collection(bool clear_all_soft_refs) override;
 
+  void ensure_parsability(bool retire_tlabs) override;
+
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
@@ -54,6 +54,9 @@ void EpsilonInitLogger::print_gc_specific() {
     if (EpsilonElasticTLABDecay) {
       log_info(gc, init)("TLAB Size Decay Time: " SIZE_FORMAT "ms", EpsilonTLABDecayTime);
     }
+    if (EpsilonAllocationChunkSize > 0) {
+      log_info(gc, init)("TLAB Allocation Chunks: %s", UseNUMA ? "per NUMA node" : "per CPU");
+    }
   } else {
     log_info(gc, init)("TLAB: Disabled");
   }
@@ -85,7 +85,15 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(size_t, EpsilonAllocationChunkSize, 0, EXPERIMENTAL,              \
+          "Carve TLABs from chunks of this size, one chunk per CPU, or "    \
+          "per NUMA node with UseNUMA, instead of from the shared space. "  \
+          "This takes refills off the shared CAS. Unused chunk tails "      \
+          "count as used. Rounded up to twice the max TLAB size. "          \
+          "0 turns chunking off.")                                          \
+          range(0, max_intx)
 
 // end of GC_EPSILON_FLAGS
 
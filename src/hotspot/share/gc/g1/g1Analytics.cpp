@@ -82,6 +82,7 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _cost_per_card_merge_ms_seq(TruncatedSeqLength),
     _cost_per_code_root_ms_seq(TruncatedSeqLength),
     _cost_per_byte_copied_ms_seq(TruncatedSeqLength),
+    _cost_per_byte_copied_ms_by_source_seq{{TruncatedSeqLength}, {TruncatedSeqLength}, {TruncatedSeqLength}},
     _pending_cards_seq(TruncatedSeqLength),
     _card_rs_length_seq(TruncatedSeqLength),
     _code_root_rs_length_seq(TruncatedSeqLength),
@@ -201,6 +202,39 @@ void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_youn
   _cost_per_byte_copied_ms_seq.add(cost_per_byte_ms, for_young_only_phase);
 }
 
+void G1Analytics::report_object_copy_time_ms(double copy_time_ms,
+                                             const size_t bytes_copied[NumCopySources],
+                                             bool for_young_only_phase) {
+  size_t total_bytes = 0;
+  uint dominant = 0;
+  for (uint i = 0; i < NumCopySources; i++) {
+    total_bytes += bytes_copied[i];
+    if (bytes_copied[i] > bytes_copied[dominant]) {
+      dominant = i;
+    }
+  }
+  // There is only a single copy time for all sources, so only learn the cost of
+  // the source that contributed most of the bytes. Attribute the time not
+  // explained by the current predictions for the other sources to it; over
+  // pauses with varying mixes this converges to the per-source costs.
+  if (total_bytes == 0 || bytes_copied[dominant] < total_bytes / 2) {
+    return;
+  }
+
+  double other_time_ms = 0.0;
+  for (uint i = 0; i < NumCopySources; i++) {
+    if (i != dominant) {
+      other_time_ms += predict_object_copy_time_ms(bytes_copied[i], static_cast<CopySource>(i), for_young_only_phase);
+    }
+  }
+  double dominant_time_ms = copy_time_ms - other_time_ms;
+  if (dominant_time_ms <= 0.0) {
+    // The predictions for the other sources are off; use their share.
+    dominant_time_ms = copy_time_ms * bytes_copied[dominant] / total_bytes;
+  }
+  _cost_per_byte_copied_ms_by_source_seq[dominant].add(dominant_time_ms / bytes_copied[dominant], for_young_only_phase);
+}
+
 void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
   _young_other_cost_per_region_ms_seq.add(other_cost_per_region_ms);
 }
@@ -265,6 +299,14 @@ double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_y
   return bytes_to_copy * predict_zero_bounded(&_cost_per_byte_copied_ms_seq, for_young_only_phase);
 }
 
+double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, CopySource source, bool for_young_only_phase) const {
+  G1PhaseDependentSeq const* seq = &_cost_per_byte_copied_ms_by_source_seq[source];
+  if (!seq->enough_samples_available(for_young_only_phase)) {
+    return predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase);
+  }
+  return bytes_to_copy * predict_zero_bounded(seq, for_young_only_phase);
+}
+
 double G1Analytics::predict_constant_other_time_ms() const {
   return predict_zero_bounded(&_constant_other_time_ms_seq);
 }
@@ -33,6 +33,17 @@ class TruncatedSeq;
 class G1Predictions;
 
 class G1Analytics: public CHeapObj<mtGC> {
+public:
+  // Kinds of source regions for which the cost of copying a byte is tracked
+  // separately.
+  enum CopySource : uint {
+    CopyFromEden,
+    CopyFromSurvivor,
+    CopyFromOld,
+    NumCopySources
+  };
+
+private:
   const static int TruncatedSeqLength = 10;
   const static int NumPrevPausesForHeuristics = 10;
   const G1Predictions* _predictor;
@@ -61,6 +72,9 @@ class G1Analytics: public CHeapObj<mtGC> {
   G1PhaseDependentSeq _cost_per_code_root_ms_seq;
   // The cost to copy a byte in ms.
   G1PhaseDependentSeq _cost_per_byte_copied_ms_seq;
+  // The cost to copy a byte in ms per kind of source region. Falls back to
+  // _cost_per_byte_copied_ms_seq until there are enough samples.
+  G1PhaseDependentSeq _cost_per_byte_copied_ms_by_source_seq[NumCopySources];
 
   G1PhaseDependentSeq _pending_cards_seq;
   G1PhaseDependentSeq _card_rs_length_seq;
@@ -133,6 +147,11 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase);
   void report_card_scan_to_merge_ratio(double cards_per_entry_ratio, bool for_young_only_phase);
   void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase);
+  // Report the object copy time for the given amount of bytes copied per kind
+  // of source region.
+  void report_object_copy_time_ms(double copy_time_ms,
+                                  const size_t bytes_copied[NumCopySources],
+                                  bool for_young_only_phase);
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
@@ -157,6 +176,7 @@ class G1Analytics: public CHeapObj<mtGC> {
   double predict_code_root_scan_time_ms(size_t code_root_num, bool for_young_only_phase) const;
 
   double predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const;
+  double predict_object_copy_time_ms(size_t bytes_to_copy, CopySource source, bool for_young_only_phase) const;
 
   double predict_constant_other_time_ms() const;
 
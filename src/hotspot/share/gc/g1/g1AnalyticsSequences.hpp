@@ -50,6 +50,9 @@ class G1PhaseDependentSeq {
   void add(double value, bool for_young_only_phase);
 
   double predict(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
+
+  // Returns whether predict() would use a sequence with enough samples.
+  bool enough_samples_available(bool use_young_only_phase_seq) const;
 };
 
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP */
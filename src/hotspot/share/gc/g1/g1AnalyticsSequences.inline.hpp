@@ -57,4 +57,11 @@ double G1PhaseDependentSeq::predict(const G1Predictions* predictor, bool use_you
   }
 }
 
+bool G1PhaseDependentSeq::enough_samples_available(bool use_young_only_phase_seq) const {
+  if (!use_young_only_phase_seq && enough_samples_to_use_mixed_seq()) {
+    return true;
+  }
+  return G1Analytics::enough_samples_available(&_young_only_seq);
+}
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_INLINE_HPP */
@@ -183,6 +183,14 @@ void G1Arguments::initialize() {
     FLAG_SET_ERGO(G1ConcRefinementThreads, ParallelGCThreads);
   }
 
+#if !(defined(AARCH64) || defined(AMD64))
+  if (G1UsePostBarrierCardCache) {
+    log_warning(gc, ergo)("Ignoring -XX:+G1UsePostBarrierCardCache "
+                          "because it is not supported on this platform");
+    FLAG_SET_DEFAULT(G1UsePostBarrierCardCache, false);
+  }
+#endif
+
   if (FLAG_IS_DEFAULT(ConcGCThreads) || ConcGCThreads == 0) {
     // Calculate the number of concurrent worker threads by scaling
     // the number of parallel GC threads.
@@ -30,6 +30,7 @@
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
@@ -37,6 +38,7 @@
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/concurrentHashTableTasks.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 
 G1CardSet::ContainerPtr G1CardSet::FullCardSet = (G1CardSet::ContainerPtr)-1;
 uint G1CardSet::_split_card_shift = 0;
@@ -1016,6 +1018,42 @@ size_t G1CardSet::num_containers() {
   return cl._count;
 }
 
+size_t G1CardSet::coarsen_dense_containers(uint min_occupied) {
+  // Collect candidates first; containers must not be freed while iterating the
+  // table as the scan is done within a critical section.
+  ResourceMark rm;
+  GrowableArray<uint> candidates;
+  auto collect =
+    [&] (G1CardSetHashTableValue* value) {
+      ContainerPtr container = Atomic::load(&value->_container);
+      if (container != FullCardSet &&
+          container_type(container) == ContainerHowl &&
+          Atomic::load(&value->_num_occupied) >= min_occupied) {
+        candidates.append(value->_region_idx);
+      }
+      return true;
+    };
+  _table->iterate(collect);
+
+  size_t num_coarsened = 0;
+  for (int i = 0; i < candidates.length(); i++) {
+    G1CardSetHashTableValue* table_entry = get_container(candidates.at(i));
+    if (table_entry == nullptr) {
+      continue;
+    }
+    ContainerPtr container = acquire_container(&table_entry->_container);
+    if (container != FullCardSet &&
+        container_type(container) == ContainerHowl &&
+        coarsen_container(&table_entry->_container, container, 0 /* card_in_region */)) {
+      _coarsen_stats.record_coarsening(ContainerHowl, false /* collision */);
+      transfer_cards(table_entry, container, candidates.at(i));
+      num_coarsened++;
+    }
+    release_and_maybe_free_container(container);
+  }
+  return num_coarsened;
+}
+
 G1CardSetCoarsenStats G1CardSet::coarsen_stats() {
   return _coarsen_stats;
 }
@@ -366,6 +366,12 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   size_t num_containers();
 
+  // Coarsens all top-level Howl containers with at least min_occupied cards to
+  // FullCardSet, releasing the memory of their sub-containers back to the memory
+  // manager. Safe to call concurrently with card additions.
+  // Returns the number of containers coarsened.
+  size_t coarsen_dense_containers(uint min_occupied);
+
   static G1CardSetCoarsenStats coarsen_stats();
   static void print_coarsen_stats(outputStream* out);
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.hpp"
+#include "gc/g1/g1CardSetCompactionTask.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
+#include "gc/g1/g1HeapRegion.inline.hpp"
+#include "gc/g1/g1HeapRegionRemSet.inline.hpp"
+#include "gc/g1/g1_globals.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
+
+void G1CardSetCompactionStats::clear() {
+  _num_passes = 0;
+  _num_regions = 0;
+  _num_coarsened = 0;
+  _used_mem_before = 0;
+  _used_mem_after = 0;
+}
+
+void G1CardSetCompactionStats::add(const G1CardSetCompactionStats& other) {
+  _num_passes += other._num_passes;
+  _num_regions += other._num_regions;
+  _num_coarsened += other._num_coarsened;
+  _used_mem_before += other._used_mem_before;
+  _used_mem_after += other._used_mem_after;
+}
+
+void G1CardSetCompactionStats::subtract_from(const G1CardSetCompactionStats& other) {
+  _num_passes = other._num_passes - _num_passes;
+  _num_regions = other._num_regions - _num_regions;
+  _num_coarsened = other._num_coarsened - _num_coarsened;
+  _used_mem_before = other._used_mem_before - _used_mem_before;
+  _used_mem_after = other._used_mem_after - _used_mem_after;
+}
+
+void G1CardSetCompactionStats::print_on(outputStream* out) const {
+  out->print_cr("  Card set compaction: passes %zu regions %zu coarsened containers %zu "
+                "used memory before %zu after %zu",
+                _num_passes, _num_regions, _num_coarsened,
+                _used_mem_before, _used_mem_after);
+}
+
+bool G1CardSetCompactionTask::should_compact(G1HeapRegion* hr) {
+  if (hr == nullptr || !(hr->is_old() || hr->is_starts_humongous())) {
+    return false;
+  }
+  G1HeapRegionRemSet* rem_set = hr->rem_set();
+  // Remembered sets that are not complete are going to be rebuilt or cleared
+  // soon, and group card sets are owned by the collection set candidates.
+  return rem_set->is_complete() && !rem_set->has_group_cardset() && !rem_set->cardset_is_empty();
+}
+
+void G1CardSetCompactionTask::compact_region(G1HeapRegion* hr) {
+  G1CardSet* card_set = hr->rem_set()->card_set();
+
+  size_t used_before = card_set->mem_size() - card_set->unused_mem_size();
+  uint min_occupied = (uint)((size_t)card_set->config()->max_cards_in_region() * G1RemSetCompactionDensityPercent / 100);
+  size_t num_coarsened = card_set->coarsen_dense_containers(min_occupied);
+  size_t used_after = card_set->mem_size() - card_set->unused_mem_size();
+
+  _current._num_regions++;
+  _current._num_coarsened += num_coarsened;
+  _current._used_mem_before += used_before;
+  _current._used_mem_after += used_after;
+}
+
+bool G1CardSetCompactionTask::compact_card_sets(jlong deadline) {
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+
+  while (_next_region < g1h->max_regions()) {
+    G1HeapRegion* hr = g1h->region_at_or_null(_next_region++);
+    if (should_compact(hr)) {
+      compact_region(hr);
+    }
+    if (os::elapsed_counter() >= deadline) {
+      return _next_region < g1h->max_regions();
+    }
+  }
+  return false;
+}
+
+G1CardSetCompactionTask::G1CardSetCompactionTask(const char* name) :
+  G1ServiceTask(name), _next_region(0), _current(), _total() { }
+
+void G1CardSetCompactionTask::execute() {
+  SuspendibleThreadSetJoiner sts;
+
+  // Concurrent marking is going to rebuild and clear remembered sets; wait
+  // until it has completed.
+  if (G1CollectedHeap::heap()->concurrent_mark()->cm_thread()->in_progress()) {
+    log_debug(gc, task)("Card Set Compaction: Concurrent cycle in progress. Skipping.");
+    schedule(G1RemSetCompactionIntervalMillis);
+    return;
+  }
+
+  jlong start = os::elapsed_counter();
+  jlong end = start +
+              (os::elapsed_frequency() / 1000) * G1RemSetFreeMemoryStepDurationMillis;
+
+  if (compact_card_sets(end)) {
+    schedule(G1RemSetFreeMemoryRescheduleDelayMillis);
+    return;
+  }
+
+  _current._num_passes = 1;
+  log_debug(gc, task)("Card Set Compaction: Pass done: regions %zu coarsened containers %zu "
+                      "used memory before %zu after %zu",
+                      _current._num_regions, _current._num_coarsened,
+                      _current._used_mem_before, _current._used_mem_after);
+  _total.add(_current);
+  _current.clear();
+  _next_region = 0;
+
+  schedule(G1RemSetCompactionIntervalMillis);
+}
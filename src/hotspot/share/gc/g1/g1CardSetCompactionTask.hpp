@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCOMPACTIONTASK_HPP
+#define SHARE_GC_G1_G1CARDSETCOMPACTIONTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1HeapRegion;
+class outputStream;
+
+// Cumulative statistics of the card set compaction task.
+class G1CardSetCompactionStats {
+public:
+  size_t _num_passes;
+  size_t _num_regions;
+  size_t _num_coarsened;
+  // Used (i.e. not on a free list) card set memory of the processed card sets
+  // before and after compaction.
+  size_t _used_mem_before;
+  size_t _used_mem_after;
+
+  G1CardSetCompactionStats() { clear(); }
+
+  void clear();
+  void add(const G1CardSetCompactionStats& other);
+  void subtract_from(const G1CardSetCompactionStats& other);
+
+  void print_on(outputStream* out) const;
+};
+
+// Task periodically coarsening dense Howl containers of the remembered sets of
+// old and humongous regions to full card set containers. Howl containers retain
+// all their sub-containers until the next GC otherwise, even if the
+// remembered set would be represented just as well by the (memory-less) full card
+// set container. The memory of the sub-containers is returned to the card set
+// memory manager of the region for reuse.
+class G1CardSetCompactionTask : public G1ServiceTask {
+  // Next region to process in the current pass.
+  uint _next_region;
+
+  // Statistics of the current pass.
+  G1CardSetCompactionStats _current;
+  // Statistics of all completed passes.
+  G1CardSetCompactionStats _total;
+
+  static bool should_compact(G1HeapRegion* hr);
+  void compact_region(G1HeapRegion* hr);
+
+  // Process regions until the given deadline. Returns true if there are more
+  // regions to process in this pass.
+  bool compact_card_sets(jlong deadline);
+
+public:
+  explicit G1CardSetCompactionTask(const char* name);
+
+  void execute() override;
+
+  G1CardSetCompactionStats total_stats() const { return _total; }
+};
+
+#endif // SHARE_GC_G1_G1CARDSETCOMPACTIONTASK_HPP
@@ -32,6 +32,7 @@
 #include "gc/g1/g1Arguments.hpp"
 #include "gc/g1/g1BarrierSet.hpp"
 #include "gc/g1/g1BatchedTask.hpp"
+#include "gc/g1/g1CardSetCompactionTask.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
@@ -53,6 +54,8 @@
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1HeapTransition.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
+#include "gc/g1/g1HumongousWasteStats.hpp"
+#include "gc/g1/g1MemoryPressureTask.hpp"
 #include "gc/g1/g1InitLogger.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/g1/g1MonotonicArenaFreeMemoryTask.hpp"
@@ -93,6 +96,7 @@
 #include "gc/shared/tlab_globals.hpp"
 #include "gc/shared/workerPolicy.hpp"
 #include "gc/shared/weakProcessor.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/heapInspection.hpp"
@@ -279,9 +283,10 @@ void G1CollectedHeap::set_humongous_metadata(G1HeapRegion* first_hr,
 HeapWord*
 G1CollectedHeap::humongous_obj_allocate_initialize_regions(G1HeapRegion* first_hr,
                                                            uint num_regions,
-                                                           size_t word_size) {
+                                                           size_t word_size,
+                                                           bool pinnable) {
   assert(first_hr != nullptr, "pre-condition");
-  assert(is_humongous(word_size), "word_size should be humongous");
+  assert(is_humongous(word_size) || pinnable, "word_size should be humongous");
   assert(num_regions * G1HeapRegion::GrainWords >= word_size, "pre-condition");
 
   // Index of last region in the series.
@@ -332,21 +337,28 @@ G1CollectedHeap::humongous_obj_allocate_initialize_regions(G1HeapRegion* first_h
   return new_obj;
 }
 
+size_t G1CollectedHeap::obj_size_in_regions(size_t word_size) {
+  return align_up(word_size, G1HeapRegion::GrainWords) / G1HeapRegion::GrainWords;
+}
+
 size_t G1CollectedHeap::humongous_obj_size_in_regions(size_t word_size) {
   assert(is_humongous(word_size), "Object of size " SIZE_FORMAT " must be humongous here", word_size);
-  return align_up(word_size, G1HeapRegion::GrainWords) / G1HeapRegion::GrainWords;
+  return obj_size_in_regions(word_size);
+}
+
+HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
+  uint obj_regions = (uint) humongous_obj_size_in_regions(word_size);
+  return humongous_obj_allocate(word_size, obj_regions, false /* pinnable */);
 }
 
 // If could fit into free regions w/o expansion, try.
 // Otherwise, if can expand, do so.
 // Otherwise, if using ex regions might help, try with ex given back.
-HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
+HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size, uint obj_regions, bool pinnable) {
   assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
 
   _verifier->verify_region_sets_optional();
 
-  uint obj_regions = (uint) humongous_obj_size_in_regions(word_size);
-
   // Policy: First try to allocate a humongous object in the free list.
   G1HeapRegion* humongous_start = _hrm.allocate_humongous(obj_regions);
   if (humongous_start == nullptr) {
@@ -366,7 +378,7 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
 
   HeapWord* result = nullptr;
   if (humongous_start != nullptr) {
-    result = humongous_obj_allocate_initialize_regions(humongous_start, obj_regions, word_size);
+    result = humongous_obj_allocate_initialize_regions(humongous_start, obj_regions, word_size, pinnable);
     assert(result != nullptr, "it should always return a valid result");
 
     // A successful humongous object allocation changes the used space
@@ -397,6 +409,14 @@ G1CollectedHeap::mem_allocate(size_t word_size,
   if (is_humongous(word_size)) {
     return attempt_allocation_humongous(word_size);
   }
+  // Large arrays likely to be pinned are put into dedicated regions like
+  // humongous objects, so that pinning does not fail evacuation of young regions.
+  if (policy()->should_allocate_pinnable(Thread::current(), word_size)) {
+    HeapWord* result = attempt_allocation_pinnable(word_size);
+    if (result != nullptr) {
+      return result;
+    }
+  }
   size_t dummy = 0;
   return attempt_allocation(word_size, word_size, &dummy);
 }
@@ -691,6 +711,27 @@ HeapWord* G1CollectedHeap::attempt_allocation_humongous(size_t word_size) {
   return nullptr;
 }
 
+HeapWord* G1CollectedHeap::attempt_allocation_pinnable(size_t word_size) {
+  assert_heap_not_locked_and_not_at_safepoint();
+  assert(!is_humongous(word_size), "humongous allocations already get their own regions");
+  assert(G1UsePinnableArrayAllocation, "only for pinnable array allocation");
+
+  // Like humongous objects, these regions are not part of the young gen, so
+  // check whether to start a marking cycle first.
+  if (policy()->need_to_start_conc_mark("concurrent pinnable allocation", word_size)) {
+    collect(GCCause::_g1_humongous_allocation);
+  }
+
+  MutexLocker x(Heap_lock);
+  uint obj_regions = (uint) obj_size_in_regions(word_size);
+  HeapWord* result = humongous_obj_allocate(word_size, obj_regions, true /* pinnable */);
+  if (result != nullptr) {
+    policy()->old_gen_alloc_tracker()->
+      add_allocated_humongous_bytes_since_last_gc(obj_regions * G1HeapRegion::GrainBytes);
+  }
+  return result;
+}
+
 HeapWord* G1CollectedHeap::attempt_allocation_at_safepoint(size_t word_size,
                                                            bool expect_null_mutator_alloc_region) {
   assert_at_safepoint_on_vm_thread();
@@ -877,6 +918,20 @@ void G1CollectedHeap::resize_heap_if_necessary() {
   }
 }
 
+void G1CollectedHeap::shrink_for_memory_pressure() {
+  assert_at_safepoint_on_vm_thread();
+
+  size_t shrink_bytes = _heap_sizing_policy->memory_pressure_shrink_amount();
+  if (shrink_bytes == 0) {
+    return;
+  }
+  size_t capacity_before = capacity();
+  shrink(shrink_bytes);
+  uncommit_regions_if_necessary();
+  log_info(gc, heap)("Memory pressure: shrunk heap " SIZE_FORMAT "M->" SIZE_FORMAT "M",
+                     capacity_before / M, capacity() / M);
+}
+
 HeapWord* G1CollectedHeap::satisfy_failed_allocation_helper(size_t word_size,
                                                             bool do_gc,
                                                             bool maximal_compaction,
@@ -1127,6 +1182,8 @@ G1CollectedHeap::G1CollectedHeap() :
   _service_thread(nullptr),
   _periodic_gc_task(nullptr),
   _free_arena_memory_task(nullptr),
+  _card_set_compaction_task(nullptr),
+  _memory_pressure_task(nullptr),
   _workers(nullptr),
   _card_table(nullptr),
   _collection_pause_end(Ticks::now()),
@@ -1192,6 +1249,7 @@ G1CollectedHeap::G1CollectedHeap() :
 
   uint n_queues = ParallelGCThreads;
   _task_queues = new G1ScannerTasksQueueSet(n_queues);
+  _task_queues->set_steal_batch_size(WorkStealingBatchSize);
 
   for (uint i = 0; i < n_queues; i++) {
     G1ScannerTasksQueue* q = new G1ScannerTasksQueue();
@@ -1405,6 +1463,16 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  if (G1RemSetCompactionIntervalMillis > 0) {
+    _card_set_compaction_task = new G1CardSetCompactionTask("Card Set Compaction Task");
+    _service_thread->register_task(_card_set_compaction_task, G1RemSetCompactionIntervalMillis);
+  }
+
+  if (G1UncommitOnMemoryPressure) {
+    _memory_pressure_task = new G1MemoryPressureTask("Memory Pressure Task");
+    _service_thread->register_task(_memory_pressure_task, G1MemoryPressureCheckIntervalMillis);
+  }
+
   // Here we allocate the dummy G1HeapRegion that is required by the
   // G1AllocRegion class.
   G1HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2161,7 +2229,7 @@ bool G1CollectedHeap::print_location(outputStream* st, void* addr) const {
   return BlockLocationPrinter<G1CollectedHeap>::print_location(st, addr);
 }
 
-G1HeapSummary G1CollectedHeap::create_g1_heap_summary() {
+G1HeapSummary G1CollectedHeap::create_g1_heap_summary(const G1HumongousWasteStats& humongous_stats) {
 
   size_t eden_used_bytes = _monitoring_support->eden_space_used();
   size_t survivor_used_bytes = _monitoring_support->survivor_space_used();
@@ -2173,7 +2241,9 @@ G1HeapSummary G1CollectedHeap::create_g1_heap_summary() {
 
   VirtualSpaceSummary heap_summary = create_heap_space_summary();
   return G1HeapSummary(heap_summary, heap_used, eden_used_bytes, eden_capacity_bytes,
-                       survivor_used_bytes, old_gen_used_bytes, num_regions());
+                       survivor_used_bytes, old_gen_used_bytes, num_regions(),
+                       humongous_stats.used_bytes(), humongous_stats.wasted_bytes(),
+                       humongous_stats.num_regions());
 }
 
 G1EvacSummary G1CollectedHeap::create_g1_evac_summary(G1EvacStats* stats) {
@@ -2185,7 +2255,17 @@ G1EvacSummary G1CollectedHeap::create_g1_evac_summary(G1EvacStats* stats) {
 }
 
 void G1CollectedHeap::trace_heap(GCWhen::Type when, const GCTracer* gc_tracer) {
-  const G1HeapSummary& heap_summary = create_g1_heap_summary();
+  // Walking the heap regions is only worth it if someone looks at the result.
+  bool log_humongous_stats = (when == GCWhen::AfterGC) && log_is_enabled(Debug, gc, heap);
+  G1HumongousWasteStats humongous_stats;
+  if (log_humongous_stats || EventG1HeapSummary::is_enabled()) {
+    humongous_stats.collect(this);
+  }
+  if (log_humongous_stats) {
+    humongous_stats.log();
+  }
+
+  const G1HeapSummary& heap_summary = create_g1_heap_summary(humongous_stats);
   gc_tracer->report_gc_heap_summary(when, heap_summary);
 
   const MetaspaceSummary& metaspace_summary = create_metaspace_summary();
@@ -67,6 +67,7 @@
 // Forward declarations
 class G1Allocator;
 class G1BatchedTask;
+class G1CardSetCompactionTask;
 class G1CardTableEntryClosure;
 class G1ConcurrentMark;
 class G1ConcurrentMarkThread;
@@ -74,6 +75,7 @@ class G1ConcurrentRefine;
 class G1GCCounters;
 class G1GCPhaseTimes;
 class G1HeapSizingPolicy;
+class G1HumongousWasteStats;
 class G1NewTracer;
 class G1RemSet;
 class G1ServiceTask;
@@ -171,6 +173,8 @@ class G1CollectedHeap : public CollectedHeap {
   G1ServiceThread* _service_thread;
   G1ServiceTask* _periodic_gc_task;
   G1MonotonicArenaFreeMemoryTask* _free_arena_memory_task;
+  G1CardSetCompactionTask* _card_set_compaction_task;
+  G1ServiceTask* _memory_pressure_task;
 
   WorkerThreads* _workers;
   G1CardTable* _card_table;
@@ -395,13 +399,19 @@ class G1CollectedHeap : public CollectedHeap {
   // Initialize a contiguous set of free regions of length num_regions
   // and starting at index first so that they appear as a single
   // humongous region.
+  // pinnable is set for arrays below the humongous threshold that are
+  // allocated into their own regions because they are likely to be pinned.
   HeapWord* humongous_obj_allocate_initialize_regions(G1HeapRegion* first_hr,
                                                       uint num_regions,
-                                                      size_t word_size);
+                                                      size_t word_size,
+                                                      bool pinnable);
 
   // Attempt to allocate a humongous object of the given size. Return
   // null if unsuccessful.
   HeapWord* humongous_obj_allocate(size_t word_size);
+  // Attempt to allocate an object of the given size into obj_regions free
+  // regions set up as a humongous object. Return null if unsuccessful.
+  HeapWord* humongous_obj_allocate(size_t word_size, uint obj_regions, bool pinnable);
 
   // The following two methods, allocate_new_tlab() and
   // mem_allocate(), are the two main entry points from the runtime
@@ -455,6 +465,12 @@ class G1CollectedHeap : public CollectedHeap {
   // potentially schedule a GC pause.
   HeapWord* attempt_allocation_humongous(size_t word_size);
 
+  // Takes the Heap_lock and attempts to allocate a non-humongous array that
+  // is likely to be pinned into regions of its own. Does not schedule a GC
+  // pause; returns null if there are no free regions, and the caller falls
+  // back to a regular allocation.
+  HeapWord* attempt_allocation_pinnable(size_t word_size);
+
   // Allocation attempt that should be called during safepoints (e.g.,
   // at the end of a successful GC). expect_null_mutator_alloc_region
   // specifies whether the mutator alloc region is expected to be null
@@ -527,6 +543,8 @@ class G1CollectedHeap : public CollectedHeap {
   void make_pending_list_reachable();
 
   G1ServiceThread* service_thread() const { return _service_thread; }
+  // The card set compaction task, or null if disabled.
+  G1CardSetCompactionTask* card_set_compaction_task() const { return _card_set_compaction_task; }
 
   WorkerThreads* workers() const { return _workers; }
 
@@ -560,6 +578,9 @@ class G1CollectedHeap : public CollectedHeap {
   void unpin_object(JavaThread* thread, oop obj) override;
 
   void resize_heap_if_necessary();
+  // Shrink the heap in response to memory pressure of the environment and
+  // schedule uncommit of the removed regions.
+  void shrink_for_memory_pressure();
 
   // Check if there is memory to uncommit and if so schedule a task to do it.
   void uncommit_regions_if_necessary();
@@ -1192,6 +1213,10 @@ class G1CollectedHeap : public CollectedHeap {
   // Returns the number of regions the humongous object of the given word size
   // requires.
   static size_t humongous_obj_size_in_regions(size_t word_size);
+  // Returns the number of regions an object of the given word size occupies
+  // if it is allocated into regions of its own. Unlike the above, this also
+  // covers pinnable arrays below the humongous threshold.
+  static size_t obj_size_in_regions(size_t word_size);
 
   // Print the maximum heap capacity.
   size_t max_capacity() const override;
@@ -1299,7 +1324,7 @@ class G1CollectedHeap : public CollectedHeap {
   bool is_obj_dead_cond(const oop obj,
                         const VerifyOption vo) const;
 
-  G1HeapSummary create_g1_heap_summary();
+  G1HeapSummary create_g1_heap_summary(const G1HumongousWasteStats& humongous_stats);
   G1EvacSummary create_g1_evac_summary(G1EvacStats* stats);
 
   // Printing
@@ -269,8 +269,13 @@ inline void G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
   assert(!is_stw_gc_active(), "must not pin objects during a GC pause");
   assert(obj->is_typeArray(), "must be typeArray");
 
-  uint obj_region_idx = heap_region_containing(obj)->hrm_index();
-  G1ThreadLocalData::pin_count_cache(thread).inc_count(obj_region_idx);
+  G1HeapRegion* r = heap_region_containing(obj);
+  // Only record the first pin in a region until the thread's pin cache is
+  // flushed or switches regions. That keeps the object size and JFR work off
+  // the common pin/unpin loop, and still sees every region once per GC.
+  if (G1ThreadLocalData::pin_count_cache(thread).inc_count(r->hrm_index())) {
+    _policy->record_object_pinned(thread, obj, r);
+  }
 }
 
 inline void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
@@ -300,8 +300,9 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
   double predicted_base_time_ms = _policy->predict_base_time_ms(pending_cards, _g1h->young_regions_cardset()->occupied());
   // Base time already includes the whole remembered set related time, so do not add that here
   // again.
+  double predicted_eden_copy_time = _policy->predict_eden_copy_time_ms(eden_region_length);
   double predicted_eden_time = _policy->predict_young_region_other_time_ms(eden_region_length) +
-                               _policy->predict_eden_copy_time_ms(eden_region_length);
+                               predicted_eden_copy_time;
   double remaining_time_ms = MAX2(target_pause_time_ms - (predicted_base_time_ms + predicted_eden_time), 0.0);
 
   log_trace(gc, ergo, cset)("Added young regions to CSet. Eden: %u regions, Survivors: %u regions, "
@@ -309,6 +310,14 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
                             eden_region_length, survivor_region_length,
                             predicted_eden_time, predicted_base_time_ms, target_pause_time_ms, remaining_time_ms);
 
+  _policy->record_predicted_copy_time_ms(predicted_eden_copy_time);
+  const GrowableArray<G1HeapRegion*>* survivor_regions = survivors->regions();
+  for (GrowableArrayIterator<G1HeapRegion*> it = survivor_regions->begin();
+       it != survivor_regions->end();
+       ++it) {
+    _policy->record_predicted_copy_time_ms(*it);
+  }
+
   // Clear the fields that point to the survivor list - they are all young now.
   survivors->convert_to_eden();
 
@@ -390,6 +399,7 @@ void G1CollectionSet::move_candidates_to_collection_set(G1CollectionCandidateReg
   for (G1HeapRegion* r : *regions) {
     _g1h->clear_region_attr(r);
     add_old_region(r);
+    _policy->record_predicted_copy_time_ms(r);
   }
   candidates()->remove(regions);
 }
@@ -1390,6 +1390,9 @@ void G1ConcurrentMark::remark() {
   G1Policy* policy = _g1h->policy();
   policy->record_concurrent_mark_remark_start();
 
+  // Remark may free regions, so threads must stop caching cards in them.
+  G1BarrierSet::dirty_card_queue_set().release_all_last_dirtied_cards();
+
   double start = os::elapsedTime();
 
   verify_during_pause(G1HeapVerifier::G1VerifyRemark, VerifyLocation::RemarkBefore);
@@ -2210,6 +2213,8 @@ void G1CMTask::reset(G1CMBitMap* mark_bitmap) {
   _calls                         = 0;
   _elapsed_time_ms               = 0.0;
   _termination_time_ms           = 0.0;
+  _prefetched_entries            = 0;
+  _prefetched_entries_returned   = 0;
 
   _mark_stats_cache.reset();
 }
@@ -2373,7 +2378,9 @@ void G1CMTask::drain_local_queue(bool partially) {
     target_size = 0;
   }
 
-  if (_task_queue->size() > target_size) {
+  if (G1ConcMarkPrefetchDistance > 0) {
+    drain_local_queue_prefetching(target_size);
+  } else if (_task_queue->size() > target_size) {
     G1TaskQueueEntry entry;
     bool ret = _task_queue->pop_local(entry);
     while (ret) {
@@ -2477,6 +2484,10 @@ void G1CMTask::print_stats() {
   size_t const misses = _mark_stats_cache.misses();
   log_debug(gc, stats)("  Mark Stats Cache: hits " SIZE_FORMAT " misses " SIZE_FORMAT " ratio %.3f",
                        hits, misses, percent_of(hits, hits + misses));
+  if (G1ConcMarkPrefetchDistance > 0) {
+    log_debug(gc, stats)("  Prefetching: distance %u scanned " SIZE_FORMAT " returned " SIZE_FORMAT,
+                         G1ConcMarkPrefetchDistance, _prefetched_entries, _prefetched_entries_returned);
+  }
 }
 
 bool G1ConcurrentMark::try_stealing(uint worker_id, G1TaskQueueEntry& task_entry) {
@@ -2933,7 +2944,9 @@ G1CMTask::G1CMTask(uint worker_id,
   _step_times_ms(),
   _elapsed_time_ms(0.0),
   _termination_time_ms(0.0),
-  _marking_step_diff_ms()
+  _marking_step_diff_ms(),
+  _prefetched_entries(0),
+  _prefetched_entries_returned(0)
 {
   guarantee(task_queue != nullptr, "invariant");
 
@@ -734,6 +734,8 @@ class G1CMTask : public TerminatorTerminator {
     // The regular clock call is called once the number of visited
     // references reaches this limit
     refs_reached_period           = 1024,
+    // Maximum value of G1ConcMarkPrefetchDistance.
+    max_prefetch_distance         = 16,
   };
 
   G1CMObjArrayProcessor       _objArray_processor;
@@ -804,6 +806,11 @@ class G1CMTask : public TerminatorTerminator {
 
   TruncatedSeq                _marking_step_diff_ms;
 
+  // Number of local queue entries scanned after being prefetched, and number
+  // of prefetched entries pushed back to the local queue because of an abort.
+  size_t                      _prefetched_entries;
+  size_t                      _prefetched_entries_returned;
+
   // Updates the local fields after this task has claimed
   // a new region to scan
   void setup_for_region(G1HeapRegion* hr);
@@ -911,6 +918,17 @@ class G1CMTask : public TerminatorTerminator {
   // Move entries from the global stack, return true if we were successful to do so.
   bool get_entries_from_global_stack();
 
+  // Issue prefetches for the memory needed to scan the given entry: the
+  // header of the object or the start of the array slice, and later the
+  // klass of the object.
+  inline void prefetch_task_entry(G1TaskQueueEntry task_entry);
+  inline void prefetch_task_entry_klass(G1TaskQueueEntry task_entry);
+  // Pops and scans objects from the local queue until its size is at most
+  // target_size. Keeps up to G1ConcMarkPrefetchDistance popped entries in a
+  // ring, prefetching their memory before scanning them, to hide some of the
+  // memory latency of marking large heaps.
+  inline void drain_local_queue_prefetching(uint target_size);
+
   // Pops and scans objects from the local queue. If partially is
   // true, then it stops when the queue size is of a given limit. If
   // partially is false, then it stops when the queue is empty.
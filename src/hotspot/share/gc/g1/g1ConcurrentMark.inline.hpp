@@ -38,6 +38,7 @@
 #include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 inline bool G1CMIsAliveClosure::do_object_b(oop obj) {
@@ -109,6 +110,72 @@ inline void G1CMMarkStack::iterate(Fn fn) const {
 // It scans an object and visits its children.
 inline void G1CMTask::scan_task_entry(G1TaskQueueEntry task_entry) { process_grey_task_entry<true>(task_entry); }
 
+inline void G1CMTask::prefetch_task_entry(G1TaskQueueEntry task_entry) {
+  if (task_entry.is_array_slice()) {
+    Prefetch::read(task_entry.slice(), 0);
+  } else {
+    Prefetch::read(cast_from_oop<HeapWord*>(task_entry.obj()), 0);
+  }
+}
+
+inline void G1CMTask::prefetch_task_entry_klass(G1TaskQueueEntry task_entry) {
+  // The klass of array slices has already been accessed when slicing.
+  if (task_entry.is_oop()) {
+    Prefetch::read(task_entry.obj()->klass(), 0);
+  }
+}
+
+inline void G1CMTask::drain_local_queue_prefetching(uint target_size) {
+  uint const distance = G1ConcMarkPrefetchDistance;
+  assert(distance > 0 && distance <= max_prefetch_distance, "invalid prefetch distance %u", distance);
+  // Prefetch the klass once the header of an entry had some time to arrive.
+  uint const klass_distance = distance / 2;
+
+  G1TaskQueueEntry ring[max_prefetch_distance];
+  uint head = 0;         // Index of the oldest entry in the ring.
+  uint num_entries = 0;
+
+  auto ring_index = [&] (uint i) {
+    uint idx = head + i;
+    return idx < distance ? idx : idx - distance;
+  };
+
+  G1TaskQueueEntry entry;
+  while (!has_aborted() &&
+         _task_queue->size() > target_size &&
+         _task_queue->pop_local(entry)) {
+    prefetch_task_entry(entry);
+    ring[ring_index(num_entries)] = entry;
+    num_entries++;
+
+    if (klass_distance > 0 && num_entries > klass_distance) {
+      prefetch_task_entry_klass(ring[ring_index(num_entries - 1 - klass_distance)]);
+    }
+
+    if (num_entries == distance) {
+      G1TaskQueueEntry oldest = ring[head];
+      head = ring_index(1);
+      num_entries--;
+      scan_task_entry(oldest);
+      _prefetched_entries++;
+    }
+  }
+
+  // Scan the remaining entries, or return them to the local queue if the
+  // task aborted, so that they are processed later.
+  for (; num_entries > 0; num_entries--) {
+    G1TaskQueueEntry oldest = ring[head];
+    head = ring_index(1);
+    if (has_aborted()) {
+      push(oldest);
+      _prefetched_entries_returned++;
+    } else {
+      scan_task_entry(oldest);
+      _prefetched_entries++;
+    }
+  }
+}
+
 inline void G1CMTask::push(G1TaskQueueEntry task_entry) {
   assert(task_entry.is_array_slice() || _g1h->is_in_reserved(task_entry.obj()), "invariant");
   assert(task_entry.is_array_slice() || !_g1h->is_on_master_free_list(
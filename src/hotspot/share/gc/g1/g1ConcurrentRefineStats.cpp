@@ -28,6 +28,7 @@
 G1ConcurrentRefineStats::G1ConcurrentRefineStats() :
   _refinement_time(),
   _refined_cards(0),
+  _refined_runs(0),
   _precleaned_cards(0),
   _dirtied_cards(0)
 {}
@@ -38,10 +39,22 @@ double G1ConcurrentRefineStats::refinement_rate_ms() const {
   return (secs > 0) ? (refined_cards() / (secs * MILLIUNITS)) : 0.0;
 }
 
+double G1ConcurrentRefineStats::refinement_rate_us() const {
+  double secs = refinement_time().seconds();
+  return (secs > 0) ? (refined_cards() / (secs * MICROUNITS)) : 0.0;
+}
+
+double G1ConcurrentRefineStats::avg_run_length() const {
+  // Precleaned cards are counted as refined, but were never scanned.
+  size_t scanned_cards = refined_cards() - MIN2(precleaned_cards(), refined_cards());
+  return (refined_runs() > 0) ? ((double)scanned_cards / refined_runs()) : 0.0;
+}
+
 G1ConcurrentRefineStats&
 G1ConcurrentRefineStats::operator+=(const G1ConcurrentRefineStats& other) {
   _refinement_time += other._refinement_time;
   _refined_cards += other._refined_cards;
+  _refined_runs += other._refined_runs;
   _precleaned_cards += other._precleaned_cards;
   _dirtied_cards += other._dirtied_cards;
   return *this;
@@ -56,6 +69,7 @@ G1ConcurrentRefineStats&
 G1ConcurrentRefineStats::operator-=(const G1ConcurrentRefineStats& other) {
   _refinement_time = clipped_sub(_refinement_time, other._refinement_time);
   _refined_cards = clipped_sub(_refined_cards, other._refined_cards);
+  _refined_runs = clipped_sub(_refined_runs, other._refined_runs);
   _precleaned_cards = clipped_sub(_precleaned_cards, other._precleaned_cards);
   _dirtied_cards = clipped_sub(_dirtied_cards, other._dirtied_cards);
   return *this;
@@ -35,6 +35,7 @@
 class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   Tickspan _refinement_time;
   size_t _refined_cards;
+  size_t _refined_runs;
   size_t _precleaned_cards;
   size_t _dirtied_cards;
 
@@ -47,9 +48,18 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   // Number of refined cards.
   size_t refined_cards() const { return _refined_cards; }
 
+  // Number of runs of consecutive cards scanned during refinement.
+  size_t refined_runs() const { return _refined_runs; }
+
   // Refinement rate, in cards per ms.
   double refinement_rate_ms() const;
 
+  // Refinement rate, in cards per us.
+  double refinement_rate_us() const;
+
+  // Average number of scanned cards per run.
+  double avg_run_length() const;
+
   // Number of cards for which refinement was skipped because some other
   // thread had already refined them.
   size_t precleaned_cards() const { return _precleaned_cards; }
@@ -59,6 +69,7 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
 
   void inc_refinement_time(Tickspan t) { _refinement_time += t; }
   void inc_refined_cards(size_t cards) { _refined_cards += cards; }
+  void inc_refined_runs(size_t runs) { _refined_runs += runs; }
   void inc_precleaned_cards(size_t cards) { _precleaned_cards += cards; }
   void inc_dirtied_cards(size_t cards) { _dirtied_cards += cards; }
 
@@ -91,12 +91,14 @@ void G1ConcurrentRefineThread::report_active(const char* reason) const {
 void G1ConcurrentRefineThread::report_inactive(const char* reason,
                                                const G1ConcurrentRefineStats& stats) const {
   log_trace(gc, refine)
-           ("%s worker %u, cards: %zu, refined %zu, rate %1.2fc/ms",
+           ("%s worker %u, cards: %zu, refined %zu, runs %zu, rate %1.2fc/ms (%1.3fc/us)",
             reason,
             _worker_id,
             G1BarrierSet::dirty_card_queue_set().num_cards(),
             stats.refined_cards(),
-            stats.refinement_rate_ms());
+            stats.refined_runs(),
+            stats.refinement_rate_ms(),
+            stats.refinement_rate_us());
 }
 
 void G1ConcurrentRefineThread::activate() {
@@ -46,6 +46,7 @@
 #include "runtime/safepoint.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/align.hpp"
 #include "utilities/globalCounter.inline.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/nonblockingQueue.inline.hpp"
@@ -55,7 +56,8 @@
 
 G1DirtyCardQueue::G1DirtyCardQueue(G1DirtyCardQueueSet* qset) :
   PtrQueue(qset),
-  _refinement_stats(new G1ConcurrentRefineStats())
+  _refinement_stats(new G1ConcurrentRefineStats()),
+  _last_dirtied_card(nullptr)
 { }
 
 G1DirtyCardQueue::~G1DirtyCardQueue() {
@@ -85,6 +87,7 @@ uint G1DirtyCardQueueSet::num_par_ids() {
 }
 
 void G1DirtyCardQueueSet::flush_queue(G1DirtyCardQueue& queue) {
+  release_last_dirtied_card(queue);
   if (queue.buffer() != nullptr) {
     G1ConcurrentRefineStats* stats = queue.refinement_stats();
     stats->inc_dirtied_cards(queue.size());
@@ -99,10 +102,39 @@ void G1DirtyCardQueueSet::enqueue(G1DirtyCardQueue& queue,
     handle_zero_index(queue);
     retry_enqueue(queue, value);
   }
+  if (G1UsePostBarrierCardCache && queue.last_dirtied_card() != value) {
+    release_last_dirtied_card(queue);
+    queue.set_last_dirtied_card(value);
+  }
+}
+
+void G1DirtyCardQueueSet::release_last_dirtied_card(G1DirtyCardQueue& queue) {
+  CardValue* card_ptr = queue.last_dirtied_card();
+  if (card_ptr != nullptr) {
+    Atomic::release_store(card_ptr, G1CardTable::dirty_card_val());
+    queue.set_last_dirtied_card(nullptr);
+  }
+}
+
+void G1DirtyCardQueueSet::release_all_last_dirtied_cards() {
+  assert_at_safepoint();
+  if (!G1UsePostBarrierCardCache) {
+    return;
+  }
+
+  struct ReleaseLastDirtiedCardClosure : public ThreadClosure {
+    G1DirtyCardQueueSet& _qset;
+    ReleaseLastDirtiedCardClosure(G1DirtyCardQueueSet& qset) : _qset(qset) {}
+    virtual void do_thread(Thread* t) {
+      _qset.release_last_dirtied_card(G1ThreadLocalData::dirty_card_queue(t));
+    }
+  } closure(*this);
+  Threads::threads_do(&closure);
 }
 
 void G1DirtyCardQueueSet::handle_zero_index(G1DirtyCardQueue& queue) {
   assert(queue.index() == 0, "precondition");
+  release_last_dirtied_card(queue);
   BufferNode* old_node = exchange_buffer_with_new(queue);
   if (old_node != nullptr) {
     assert(old_node->index() == 0, "invariant");
@@ -347,6 +379,7 @@ class G1RefineBufferedCards : public StackObj {
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
   G1RemSet* const _g1rs;
+  G1CardTable* const _ct;
 
   static inline ptrdiff_t compare_cards(const CardTable::CardValue* p1,
                                         const CardTable::CardValue* p2) {
@@ -399,19 +432,46 @@ class G1RefineBufferedCards : public StackObj {
     return first_clean;
   }
 
+  // Maximum number of cards refined as a single run. Limits the time between
+  // checks for yield requests.
+  static const size_t MaxCardRunLength = 128;
+
+  // Returns the number of cards starting at index that form a run of
+  // consecutive cards within the same region. Cards are sorted in decreasing
+  // address order, so a run extends towards lower addresses and ends at the
+  // first card of a region.
+  size_t card_run_length(size_t index) const {
+    size_t limit = MIN2(_node_buffer_capacity, index + MaxCardRunLength);
+    size_t end = index + 1;
+    for ( ; end < limit; ++end) {
+      CardTable::CardValue* prev = _node_buffer[end - 1];
+      if ((_node_buffer[end] != prev - 1) ||
+          is_aligned(_ct->addr_for(prev), G1HeapRegion::GrainBytes)) {
+        break;
+      }
+    }
+    return end - index;
+  }
+
   bool refine_cleaned_cards(size_t start_index) {
     bool result = true;
     size_t i = start_index;
-    for ( ; i < _node_buffer_capacity; ++i) {
+    size_t num_runs = 0;
+    while (i < _node_buffer_capacity) {
       if (SuspendibleThreadSet::should_yield()) {
         redirty_unrefined_cards(i);
         result = false;
         break;
       }
-      _g1rs->refine_card_concurrently(_node_buffer[i], _worker_id);
+      size_t run_length = card_run_length(i);
+      // The lowest address card of the run is at the end.
+      _g1rs->refine_cards_concurrently(_node_buffer[i + run_length - 1], run_length, _worker_id);
+      i += run_length;
+      num_runs++;
     }
     _node->set_index(i);
     _stats->inc_refined_cards(i - start_index);
+    _stats->inc_refined_runs(num_runs);
     return result;
   }
 
@@ -430,7 +490,8 @@ class G1RefineBufferedCards : public StackObj {
     _node_buffer_capacity(node->capacity()),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1rs(G1CollectedHeap::heap()->rem_set()),
+    _ct(G1CollectedHeap::heap()->card_table()) {}
 
   bool refine() {
     size_t first_clean_index = clean_cards();
@@ -537,6 +598,7 @@ void G1DirtyCardQueueSet::abandon_logs_and_stats() {
     AbandonThreadLogClosure(G1DirtyCardQueueSet& qset) : _qset(qset) {}
     virtual void do_thread(Thread* t) {
       G1DirtyCardQueue& queue = G1ThreadLocalData::dirty_card_queue(t);
+      queue.set_last_dirtied_card(nullptr);
       _qset.reset_queue(queue);
       queue.refinement_stats()->reset();
     }
@@ -43,6 +43,12 @@ class Thread;
 // A ptrQueue whose elements are "oops", pointers to object heads.
 class G1DirtyCardQueue: public PtrQueue {
   G1ConcurrentRefineStats* _refinement_stats;
+  // The card last dirtied and enqueued into the current buffer if
+  // G1UsePostBarrierCardCache is enabled, or null. As long as the buffer
+  // has not been handed off, the card can not be refined concurrently, so
+  // the post-write barrier may skip stores into it without any further
+  // checks. See G1DirtyCardQueueSet::release_last_dirtied_card().
+  G1CardTable::CardValue* _last_dirtied_card;
 
 public:
   G1DirtyCardQueue(G1DirtyCardQueueSet* qset);
@@ -55,6 +61,9 @@ class G1DirtyCardQueue: public PtrQueue {
     return _refinement_stats;
   }
 
+  G1CardTable::CardValue* last_dirtied_card() const { return _last_dirtied_card; }
+  void set_last_dirtied_card(G1CardTable::CardValue* card_ptr) { _last_dirtied_card = card_ptr; }
+
   // Compiler support.
   static ByteSize byte_offset_of_index() {
     return PtrQueue::byte_offset_of_index<G1DirtyCardQueue>();
@@ -66,6 +75,9 @@ class G1DirtyCardQueue: public PtrQueue {
   }
   using PtrQueue::byte_width_of_buf;
 
+  static ByteSize byte_offset_of_last_dirtied_card() {
+    return byte_offset_of(G1DirtyCardQueue, _last_dirtied_card);
+  }
 };
 
 class G1DirtyCardQueueSet: public PtrQueueSet {
@@ -222,6 +234,15 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Called when queue is full or has no buffer.
   void handle_zero_index(G1DirtyCardQueue& queue);
 
+  // Stop caching the queue's last dirtied card. Stores into that card may have
+  // skipped the post-write barrier in the meantime, while an enqueue of the
+  // same card by another thread may have caused it to be refined and cleaned.
+  // Dirtying it again makes sure that the refinement of the entry in the
+  // buffer of this queue takes these stores into account.
+  // Must be called before the buffer the card has been enqueued into is handed
+  // off for refinement, and before the region containing it may be freed.
+  void release_last_dirtied_card(G1DirtyCardQueue& queue);
+
   // Enqueue the buffer, and optionally perform refinement by the mutator.
   // Mutator refinement is only done by Java threads, and only if there
   // are more than mutator_refinement_threshold cards in the completed buffers.
@@ -275,6 +296,10 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // precondition: at safepoint.
   void abandon_logs_and_stats();
 
+  // Release the last dirtied card of all threads as regions may be freed.
+  // precondition: at safepoint.
+  void release_all_last_dirtied_cards();
+
   // Update global refinement statistics with the ones given and the ones from
   // detached threads.
   // precondition: at safepoint.
@@ -120,7 +120,7 @@ void G1FullGCCompactTask::compact_humongous_obj(G1HeapRegion* src_hr) {
   oop obj = cast_to_oop(src_hr->bottom());
   size_t word_size = obj->size();
 
-  uint num_regions = (uint)G1CollectedHeap::humongous_obj_size_in_regions(word_size);
+  uint num_regions = (uint)G1CollectedHeap::obj_size_in_regions(word_size);
   HeapWord* destination = cast_from_oop<HeapWord*>(obj->forwardee());
 
   assert(collector()->mark_bitmap()->is_marked(obj), "Should only compact marked objects");
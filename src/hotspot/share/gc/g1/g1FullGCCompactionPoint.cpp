@@ -154,7 +154,7 @@ void G1FullGCCompactionPoint::forward_humongous(G1HeapRegion* hr) {
 
   oop obj = cast_to_oop(hr->bottom());
   size_t obj_size = obj->size();
-  uint num_regions = (uint)G1CollectedHeap::humongous_obj_size_in_regions(obj_size);
+  uint num_regions = (uint)G1CollectedHeap::obj_size_in_regions(obj_size);
 
   if (!has_regions()) {
     return;
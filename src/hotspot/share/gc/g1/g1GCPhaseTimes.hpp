@@ -143,7 +143,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     MergePSSLABSize,
     MergePSSLABWasteBytes,
     MergePSSLABUndoWasteBytes,
-    MergePSSEvacFailExtra
+    MergePSSEvacFailExtra,
+    MergePSSCrossNodeCopiedBytes
   };
 
   enum RestoreEvacFailureRegionsWorkItems {
@@ -26,6 +26,7 @@
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapSizingPolicy.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
@@ -273,3 +274,29 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   expand = true; // Does not matter.
   return 0;
 }
+
+size_t G1HeapSizingPolicy::memory_pressure_shrink_amount() {
+  // Keep the free regions the young generation may still allocate into until
+  // the next GC, so that shrinking does not cause premature GCs.
+  uint young_target = _g1h->policy()->young_list_target_length();
+  uint remaining_young = young_target - MIN2(young_target, _g1h->young_regions_count());
+  uint num_free = _g1h->num_free_regions();
+  if (num_free <= remaining_young) {
+    return 0;
+  }
+  size_t shrinkable_bytes = (size_t)(num_free - remaining_young) * G1HeapRegion::GrainBytes;
+  size_t shrink_bytes = shrinkable_bytes * G1MemoryPressureShrinkPercent / 100;
+
+  size_t capacity = _g1h->capacity();
+  size_t min_capacity = MinHeapSize;
+  shrink_bytes = MIN2(shrink_bytes, capacity - MIN2(capacity, min_capacity));
+  // Shrink by at least one region if possible.
+  if (shrink_bytes < G1HeapRegion::GrainBytes && capacity >= min_capacity + G1HeapRegion::GrainBytes) {
+    shrink_bytes = G1HeapRegion::GrainBytes;
+  }
+
+  log_debug(gc, ergo, heap)("Memory pressure shrink amount: " SIZE_FORMAT "B (capacity: " SIZE_FORMAT "B "
+                            "free regions: %u remaining young regions: %u)",
+                            shrink_bytes, capacity, num_free, remaining_young);
+  return shrink_bytes;
+}
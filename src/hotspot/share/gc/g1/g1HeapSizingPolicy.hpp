@@ -59,6 +59,9 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // Returns the amount of bytes to resize the heap; if expand is set, the heap
   // should by expanded by that amount, shrunk otherwise.
   size_t full_collection_resize_amount(bool& expand);
+  // Returns the amount of bytes to shrink the heap by without a GC because
+  // the environment is under memory pressure.
+  size_t memory_pressure_shrink_amount();
   // Clear ratio tracking data used by expansion_amount().
   void clear_ratio_check_data();
 
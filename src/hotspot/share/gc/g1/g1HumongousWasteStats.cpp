@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1HeapRegion.inline.hpp"
+#include "gc/g1/g1HeapRegionBounds.inline.hpp"
+#include "gc/g1/g1HumongousWasteStats.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "utilities/align.hpp"
+
+G1HumongousWasteStats::G1HumongousWasteStats() :
+  _num_objects(0),
+  _used_bytes(0) {
+  for (uint i = 0; i < NumRegionSizes; i++) {
+    _wasted_bytes[i] = 0;
+    _humongous_regions[i] = 0;
+  }
+}
+
+size_t G1HumongousWasteStats::region_size_at(uint i) {
+  assert(i < NumRegionSizes, "index %u out of bounds", i);
+  return G1HeapRegion::GrainBytes << i;
+}
+
+size_t G1HumongousWasteStats::wasted_bytes_at(uint i) const {
+  assert(i < NumRegionSizes, "index %u out of bounds", i);
+  return _wasted_bytes[i];
+}
+
+uint G1HumongousWasteStats::humongous_regions_at(uint i) const {
+  assert(i < NumRegionSizes, "index %u out of bounds", i);
+  return _humongous_regions[i];
+}
+
+void G1HumongousWasteStats::add_object(size_t obj_bytes) {
+  _num_objects++;
+  _used_bytes += obj_bytes;
+
+  for (uint i = 0; i < NumRegionSizes; i++) {
+    size_t region_size = region_size_at(i);
+    if (obj_bytes <= G1CollectedHeap::humongous_threshold_for(region_size)) {
+      // Regular object at this and all larger region sizes.
+      break;
+    }
+    size_t covered_bytes = align_up(obj_bytes, region_size);
+    _wasted_bytes[i] += covered_bytes - obj_bytes;
+    _humongous_regions[i] += checked_cast<uint>(covered_bytes / region_size);
+  }
+}
+
+class G1CollectHumongousWasteClosure : public G1HeapRegionClosure {
+  G1HumongousWasteStats* _stats;
+
+public:
+  G1CollectHumongousWasteClosure(G1HumongousWasteStats* stats) : _stats(stats) { }
+
+  bool do_heap_region(G1HeapRegion* r) override {
+    if (r->is_starts_humongous()) {
+      oop obj = cast_to_oop(r->bottom());
+      _stats->add_object(obj->size() * HeapWordSize);
+    }
+    return false;
+  }
+};
+
+void G1HumongousWasteStats::collect(G1CollectedHeap* g1h) {
+  G1CollectHumongousWasteClosure cl(this);
+  g1h->heap_region_iterate(&cl);
+}
+
+void G1HumongousWasteStats::log() const {
+  LogTarget(Debug, gc, heap) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  LogStream ls(lt);
+  ls.print("Humongous objects: %u regions: %u used: " SIZE_FORMAT "B wasted: " SIZE_FORMAT "B",
+           num_objects(), num_regions(), used_bytes(), wasted_bytes());
+  if (num_objects() == 0) {
+    ls.cr();
+    return;
+  }
+
+  uint best = 0;
+  for (uint i = 1; i < NumRegionSizes; i++) {
+    if (region_size_at(i) > G1HeapRegionBounds::max_size()) {
+      break;
+    }
+    ls.print(" (" SIZE_FORMAT "M: regions: %u wasted: " SIZE_FORMAT "B)",
+             region_size_at(i) / M, humongous_regions_at(i), wasted_bytes_at(i));
+    if (wasted_bytes_at(i) < wasted_bytes_at(best)) {
+      best = i;
+    }
+  }
+  ls.cr();
+
+  if (best != 0) {
+    log_debug(gc, ergo, heap)("Humongous objects would waste " SIZE_FORMAT "B less with G1HeapRegionSize=" SIZE_FORMAT "M",
+                              wasted_bytes() - wasted_bytes_at(best), region_size_at(best) / M);
+  }
+}
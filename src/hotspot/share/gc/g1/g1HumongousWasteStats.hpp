@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1HUMONGOUSWASTESTATS_HPP
+#define SHARE_GC_G1_G1HUMONGOUSWASTESTATS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1CollectedHeap;
+
+// Statistics about the space wasted at the end of the last region of humongous
+// objects. Also estimates that waste for larger region sizes, to guide the
+// selection of G1HeapRegionSize for applications allocating many humongous
+// objects.
+class G1HumongousWasteStats : public StackObj {
+public:
+  // Number of region sizes the waste is estimated for. The region size of the
+  // estimate with index i is the current region size shifted left by i.
+  static const uint NumRegionSizes = 4;
+
+private:
+  uint _num_objects;
+  size_t _used_bytes;
+  // Bytes wasted, and number of regions needed, if all humongous objects were
+  // allocated with the respective region size. Objects that are not humongous
+  // at a larger region size do not waste any space nor use humongous regions.
+  size_t _wasted_bytes[NumRegionSizes];
+  uint _humongous_regions[NumRegionSizes];
+
+  static size_t region_size_at(uint i);
+
+public:
+  G1HumongousWasteStats();
+
+  void add_object(size_t obj_bytes);
+  // Collect the statistics for all humongous objects in the heap.
+  void collect(G1CollectedHeap* g1h);
+
+  uint num_objects() const { return _num_objects; }
+  uint num_regions() const { return _humongous_regions[0]; }
+  size_t used_bytes() const { return _used_bytes; }
+  size_t wasted_bytes() const { return _wasted_bytes[0]; }
+
+  size_t wasted_bytes_at(uint i) const;
+  uint humongous_regions_at(uint i) const;
+
+  // Log the statistics, and the largest reduction of waste achievable with a
+  // larger valid region size.
+  void log() const;
+};
+
+#endif // SHARE_GC_G1_G1HUMONGOUSWASTESTATS_HPP
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1MemoryPressureTask.hpp"
+#include "gc/g1/g1VMOperations.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/vmThread.hpp"
+
+G1MemoryPressureTask::G1MemoryPressureTask(const char* name) :
+  G1ServiceTask(name) { }
+
+bool G1MemoryPressureTask::is_under_memory_pressure(const os::memory_pressure_t& info) {
+  if (info.stall_percent >= 0.0 && info.stall_percent >= G1MemoryPressureStallThreshold) {
+    return true;
+  }
+  return info.throttle_limit > 0 && info.usage > 0 &&
+         (double)info.usage >= (double)info.throttle_limit * ThrottleLimitUsageFraction;
+}
+
+void G1MemoryPressureTask::check_for_memory_pressure() {
+  os::memory_pressure_t info;
+  if (!os::memory_pressure(&info)) {
+    log_trace(gc, heap)("Memory pressure information not available.");
+    return;
+  }
+
+  bool under_pressure = is_under_memory_pressure(info);
+  log_debug(gc, heap)("Memory pressure: stall %1.2f%% usage " JLONG_FORMAT "B throttle limit " JLONG_FORMAT "B%s",
+                      info.stall_percent, info.usage, info.throttle_limit,
+                      under_pressure ? ", shrinking heap" : "");
+  if (under_pressure) {
+    VM_G1ShrinkHeap op;
+    VMThread::execute(&op);
+  }
+}
+
+void G1MemoryPressureTask::execute() {
+  check_for_memory_pressure();
+  schedule(G1MemoryPressureCheckIntervalMillis);
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1MEMORYPRESSURETASK_HPP
+#define SHARE_GC_G1_G1MEMORYPRESSURETASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "runtime/os.hpp"
+
+// Task that periodically checks the memory pressure of the environment, e.g.
+// the cgroup of a container, and shrinks the heap in steps while it is under
+// pressure. The regions removed from the heap are uncommitted concurrently by
+// the G1UncommitRegionTask.
+class G1MemoryPressureTask : public G1ServiceTask {
+  // Memory usage relative to the throttle limit above which the environment is
+  // considered to be under memory pressure.
+  static constexpr double ThrottleLimitUsageFraction = 0.95;
+
+  static bool is_under_memory_pressure(const os::memory_pressure_t& info);
+  void check_for_memory_pressure();
+
+public:
+  G1MemoryPressureTask(const char* name);
+  void execute() override;
+};
+
+#endif // SHARE_GC_G1_G1MEMORYPRESSURETASK_HPP
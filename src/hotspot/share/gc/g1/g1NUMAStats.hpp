@@ -87,6 +87,9 @@ class G1NUMAStats : public CHeapObj<mtGC> {
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of bytes copied during evacuation, by worker node and
+    // source region node.
+    LocalBytesCopied,
     NodeDataItemsSentinel
   };
 
@@ -88,7 +88,10 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _string_dedup_requests(),
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
+    _numa_worker_node_index(0),
     _obj_alloc_stat(nullptr),
+    _obj_copy_words_stat(nullptr),
+    _numa_cross_node_copied_words(0),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
     _evacuation_failed_info(),
@@ -142,6 +145,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _obj_copy_words_stat);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -532,6 +536,8 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
       _surviving_young_words[young_index] += word_sz;
     }
 
+    update_numa_copy_stats(node_index, word_sz);
+
     if (dest_attr.is_young()) {
       if (age < markWord::max_age) {
         age++;
@@ -624,16 +630,22 @@ void G1ParScanThreadStateSet::flush_stats() {
     size_t lab_undo_waste_bytes = pss->lab_undo_waste_words() * HeapWordSize;
     size_t copied_bytes = pss->flush_stats(_surviving_young_words_total, _num_workers, &_rdc_buffers[worker_id]) * HeapWordSize;
     size_t evac_fail_enqueued_cards = pss->evac_failure_enqueued_cards();
+    size_t cross_node_copied_bytes = pss->numa_cross_node_copied_words() * HeapWordSize;
 
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_undo_waste_bytes, G1GCPhaseTimes::MergePSSLABUndoWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, evac_fail_enqueued_cards, G1GCPhaseTimes::MergePSSEvacFailExtra);
+    if (_g1h->numa()->is_enabled()) {
+      p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, cross_node_copied_bytes, G1GCPhaseTimes::MergePSSCrossNodeCopiedBytes);
+    }
 
     delete pss;
     _states[worker_id] = nullptr;
   }
 
+  record_copied_bytes_by_source();
+
   G1DirtyCardQueueSet& dcq = G1BarrierSet::dirty_card_queue_set();
   dcq.merge_bufferlists(rdcqs());
   rdcqs()->verify_empty();
@@ -641,6 +653,28 @@ void G1ParScanThreadStateSet::flush_stats() {
   _flushed = true;
 }
 
+void G1ParScanThreadStateSet::record_copied_bytes_by_source() {
+  // Survivor regions from the previous pause are the first regions added to the
+  // young collection set, i.e. they have the lowest young indexes.
+  uint const survivor_length = _collection_set->survivor_region_length();
+  uint const young_length = _collection_set->young_region_length();
+
+  size_t survivor_words = 0;
+  size_t eden_words = 0;
+  for (uint i = 1; i <= young_length; i++) {
+    if (i <= survivor_length) {
+      survivor_words += _surviving_young_words_total[i];
+    } else {
+      eden_words += _surviving_young_words_total[i];
+    }
+  }
+
+  G1Policy* policy = _g1h->policy();
+  policy->record_copied_bytes(G1Analytics::CopyFromEden, eden_words * HeapWordSize);
+  policy->record_copied_bytes(G1Analytics::CopyFromSurvivor, survivor_words * HeapWordSize);
+  policy->record_copied_bytes(G1Analytics::CopyFromOld, _surviving_young_words_total[0] * HeapWordSize);
+}
+
 void G1ParScanThreadStateSet::record_unused_optional_region(G1HeapRegion* hr) {
   for (uint worker_index = 0; worker_index < _num_workers; ++worker_index) {
     G1ParScanThreadState* pss = _states[worker_index];
@@ -696,6 +730,10 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, siz
 
 void G1ParScanThreadState::initialize_numa_stats() {
   if (_numa->is_enabled()) {
+    // The thread states are lazily created by the worker threads that use
+    // them, so this is the node the owning worker runs on.
+    _numa_worker_node_index = _numa->index_of_current_thread();
+
     LogTarget(Info, gc, heap, numa) lt;
 
     if (lt.is_enabled()) {
@@ -703,6 +741,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_copy_words_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
+      memset(_obj_copy_words_stat, 0, sizeof(size_t) * num_nodes);
     }
   }
 }
@@ -712,6 +752,13 @@ void G1ParScanThreadState::flush_numa_stats() {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_obj_copy_words_stat != nullptr) {
+    // Convert to bytes before handing out the data.
+    for (uint i = 0; i < _numa->num_active_nodes(); i++) {
+      _obj_copy_words_stat[i] *= HeapWordSize;
+    }
+    _numa->copy_statistics(G1NUMAStats::LocalBytesCopied, _numa_worker_node_index, _obj_copy_words_stat);
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
@@ -720,6 +767,16 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_numa_copy_stats(uint node_index, size_t word_sz) {
+  // Without NUMA all regions and workers are on node 0, so this never counts.
+  if (node_index != _numa_worker_node_index) {
+    _numa_cross_node_copied_words += word_sz;
+  }
+  if (_obj_copy_words_stat != nullptr) {
+    _obj_copy_words_stat[node_index] += word_sz;
+  }
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
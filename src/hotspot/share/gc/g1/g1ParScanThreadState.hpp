@@ -98,10 +98,18 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   G1OopStarChunkedList* _oops_into_optional_regions;
 
   G1NUMA* _numa;
+  // Node index of the worker thread owning this state. Copies from regions
+  // on other nodes are accounted as cross-node copies.
+  uint _numa_worker_node_index;
   // Records how many object allocations happened at each node during copy to survivor.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Records how many words were copied from regions of each node. Recorded
+  // under the same conditions as _obj_alloc_stat.
+  size_t* _obj_copy_words_stat;
+  // Number of words copied from regions not on the worker's node.
+  size_t _numa_cross_node_copied_words;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -169,6 +177,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // HeapWords copied.
   size_t flush_stats(size_t* surviving_young_words, uint num_workers, BufferNodeList* buffer_log);
 
+  size_t numa_cross_node_copied_words() const { return _numa_cross_node_copied_words; }
+
 private:
   void do_partial_array(PartialArrayState* state);
   void start_partial_objarray(G1HeapRegionAttr dest_dir, oop from, oop to);
@@ -220,6 +230,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  inline void update_numa_copy_stats(uint node_index, size_t word_sz);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -255,6 +266,9 @@ class G1ParScanThreadStateSet : public StackObj {
   G1EvacFailureRegions* _evac_failure_regions;
   PartialArrayStateAllocator _partial_array_state_allocator;
 
+  // Report the copied bytes per kind of source region to the policy.
+  void record_copied_bytes_by_source();
+
  public:
   G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                           uint num_workers,
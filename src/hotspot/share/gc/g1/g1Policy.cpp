@@ -40,6 +40,8 @@
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1ThreadLocalData.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
@@ -71,6 +73,10 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _free_regions_at_end_of_collection(0),
   _card_rs_length(0),
   _pending_cards_at_gc_start(0),
+  _copied_bytes(),
+  _predicted_copy_time_ms(0.0),
+  _last_pinned_evac_failure_gc(NoPinnedEvacFailure),
+  _pinned_region_cost_ms_seq(),
   _concurrent_start_to_mixed(),
   _collection_set(nullptr),
   _g1h(nullptr),
@@ -607,12 +613,16 @@ void G1Policy::record_full_collection_end() {
 static void log_refinement_stats(const char* kind, const G1ConcurrentRefineStats& stats) {
   log_debug(gc, refine, stats)
            ("%s refinement: %.2fms, refined: " SIZE_FORMAT
-            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT,
+            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT
+            ", runs: " SIZE_FORMAT " (avg %.2f cards), rate: %.3f cards/us",
             kind,
             stats.refinement_time().seconds() * MILLIUNITS,
             stats.refined_cards(),
             stats.precleaned_cards(),
-            stats.dirtied_cards());
+            stats.dirtied_cards(),
+            stats.refined_runs(),
+            stats.avg_run_length(),
+            stats.refinement_rate_us());
 }
 
 void G1Policy::record_concurrent_refinement_stats(size_t pending_cards,
@@ -686,6 +696,11 @@ void G1Policy::record_young_collection_start() {
 
   phase_times()->record_cur_collection_start_sec(now.seconds());
 
+  for (uint i = 0; i < G1Analytics::NumCopySources; i++) {
+    _copied_bytes[i] = 0;
+  }
+  _predicted_copy_time_ms = 0.0;
+
   // do that for any other surv rate groups
   _eden_surv_rate_group->stop_adding_regions();
   _survivors_age_table.clear();
@@ -839,6 +854,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
   record_pause(this_pause, start_time_sec, end_time_sec, allocation_failure);
 
+  update_pinning_history();
+
   if (G1GCPauseTypeHelper::is_last_young_pause(this_pause)) {
     assert(!G1GCPauseTypeHelper::is_concurrent_start_pause(this_pause),
            "The young GC before mixed is not allowed to be concurrent start GC");
@@ -918,11 +935,15 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
 
     // Update prediction for copy cost per byte
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
+    double copy_time_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
 
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
+      double cost_per_byte_ms = copy_time_ms / copied_bytes;
       _analytics->report_cost_per_byte_ms(cost_per_byte_ms, is_young_only_pause);
     }
+    _analytics->report_object_copy_time_ms(copy_time_ms, _copied_bytes, is_young_only_pause);
+
+    report_copy_cost_prediction(copy_time_ms);
 
     if (_collection_set->young_region_length() > 0) {
       _analytics->report_young_other_cost_per_region_ms(young_other_time_ms() /
@@ -1120,12 +1141,99 @@ double G1Policy::predict_eden_copy_time_ms(uint count, size_t* bytes_to_copy) co
   if (bytes_to_copy != nullptr) {
     *bytes_to_copy = expected_bytes;
   }
-  return _analytics->predict_object_copy_time_ms(expected_bytes, collector_state()->in_young_only_phase());
+  return _analytics->predict_object_copy_time_ms(expected_bytes,
+                                                 G1Analytics::CopyFromEden,
+                                                 collector_state()->in_young_only_phase());
+}
+
+static G1Analytics::CopySource copy_source_for(G1HeapRegion* hr) {
+  if (hr->is_eden()) {
+    return G1Analytics::CopyFromEden;
+  } else if (hr->is_survivor()) {
+    return G1Analytics::CopyFromSurvivor;
+  }
+  return G1Analytics::CopyFromOld;
 }
 
 double G1Policy::predict_region_copy_time_ms(G1HeapRegion* hr, bool for_young_only_phase) const {
   size_t const bytes_to_copy = predict_bytes_to_copy(hr);
-  return _analytics->predict_object_copy_time_ms(bytes_to_copy, for_young_only_phase);
+  return _analytics->predict_object_copy_time_ms(bytes_to_copy, copy_source_for(hr), for_young_only_phase);
+}
+
+void G1Policy::record_predicted_copy_time_ms(G1HeapRegion* hr) {
+  record_predicted_copy_time_ms(predict_region_copy_time_ms(hr, collector_state()->in_young_only_phase()));
+}
+
+void G1Policy::report_copy_cost_prediction(double copy_time_ms) const {
+  double prediction_error = _predicted_copy_time_ms > 0.0 ? (copy_time_ms - _predicted_copy_time_ms) / _predicted_copy_time_ms : 0.0;
+
+  log_debug(gc, ergo, cset)("Object copy time predicted: %1.2fms actual: %1.2fms error: %1.2f%% "
+                            "copied eden: %zuB survivor: %zuB old: %zuB",
+                            _predicted_copy_time_ms, copy_time_ms, prediction_error * 100.0,
+                            _copied_bytes[G1Analytics::CopyFromEden],
+                            _copied_bytes[G1Analytics::CopyFromSurvivor],
+                            _copied_bytes[G1Analytics::CopyFromOld]);
+
+  _g1h->gc_tracer_stw()->report_copy_cost_prediction(_predicted_copy_time_ms,
+                                                     copy_time_ms,
+                                                     _copied_bytes[G1Analytics::CopyFromEden],
+                                                     _copied_bytes[G1Analytics::CopyFromSurvivor],
+                                                     _copied_bytes[G1Analytics::CopyFromOld]);
+}
+
+void G1Policy::update_pinning_history() {
+  G1GCPhaseTimes* p = phase_times();
+  size_t num_pinned = p->sum_thread_work_items(G1GCPhaseTimes::RestoreEvacuationFailedRegions,
+                                               G1GCPhaseTimes::RestoreEvacFailureRegionsPinnedNum);
+  if (num_pinned == 0) {
+    return;
+  }
+  _last_pinned_evac_failure_gc = _g1h->total_collections();
+
+  size_t num_failed = p->sum_thread_work_items(G1GCPhaseTimes::RestoreEvacuationFailedRegions,
+                                               G1GCPhaseTimes::RestoreEvacFailureRegionsEvacFailedNum);
+  double evac_failure_time_ms = average_time_ms(G1GCPhaseTimes::RestoreEvacuationFailedRegions) +
+                                average_time_ms(G1GCPhaseTimes::RemoveSelfForwards);
+  double cost_per_region_ms = evac_failure_time_ms / MAX2(num_failed, num_pinned);
+  _pinned_region_cost_ms_seq.add(cost_per_region_ms);
+
+  log_debug(gc, ergo)("Pinned regions: %zu evacuation failed regions: %zu cost per region: %1.3fms",
+                      num_pinned, num_failed, cost_per_region_ms);
+}
+
+size_t G1Policy::pinnable_array_min_word_size() {
+  return G1HeapRegion::GrainWords * G1PinnableArrayMinRegionPercent / 100;
+}
+
+bool G1Policy::should_allocate_pinnable(Thread* thread, size_t word_size) const {
+  if (!G1UsePinnableArrayAllocation || word_size < pinnable_array_min_word_size()) {
+    return false;
+  }
+  // Only spend space on dedicated regions while pinning hurts.
+  uint gc_count = _g1h->total_collections();
+  if (_last_pinned_evac_failure_gc == NoPinnedEvacFailure ||
+      gc_count - _last_pinned_evac_failure_gc > G1NumCollectionsKeepPinned) {
+    return false;
+  }
+  uint last_pin_gc = G1ThreadLocalData::last_large_array_pin_gc(thread);
+  return last_pin_gc != G1ThreadLocalData::NoLargeArrayPinned &&
+         gc_count - last_pin_gc <= G1NumCollectionsKeepPinned;
+}
+
+void G1Policy::record_object_pinned(JavaThread* thread, oop obj, G1HeapRegion* r) {
+  if (G1UsePinnableArrayAllocation && obj->size() >= pinnable_array_min_word_size()) {
+    G1ThreadLocalData::set_last_large_array_pin_gc(thread, _g1h->total_collections());
+  }
+  // Only pinning objects in young regions causes evacuation failures.
+  double predicted_cost_ms = r->is_young() ? predict_pinned_region_cost_ms() : 0.0;
+  G1PinningTracer::report_object_pinning(obj, r->hrm_index(), r->is_young(), predicted_cost_ms);
+}
+
+double G1Policy::predict_pinned_region_cost_ms() const {
+  if (_pinned_region_cost_ms_seq.num() == 0) {
+    return 0.0;
+  }
+  return _predictor.predict_zero_bounded(&_pinned_region_cost_ms_seq);
 }
 
 double G1Policy::predict_region_merge_scan_time(G1HeapRegion* hr, bool for_young_only_phase) const {
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1POLICY_HPP
 #define SHARE_GC_G1_G1POLICY_HPP
 
+#include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1ConcurrentStartToMixedTimeTracker.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
@@ -36,6 +37,7 @@
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/gcCause.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/numberSeq.hpp"
 #include "utilities/pair.hpp"
 #include "utilities/ticks.hpp"
 
@@ -51,9 +53,9 @@ class G1CollectionSetCandidates;
 class G1CollectionSetChooser;
 class G1CollectionCandidateRegionList;
 class G1IHOPControl;
-class G1Analytics;
 class G1SurvivorRegions;
 class GCPolicyCounters;
+class JavaThread;
 class STWGCTimer;
 
 class G1Policy: public CHeapObj<mtGC> {
@@ -107,6 +109,17 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Bytes copied per kind of source region during the current pause.
+  size_t _copied_bytes[G1Analytics::NumCopySources];
+  // Object copy time predicted for the collection set of the current pause.
+  double _predicted_copy_time_ms;
+
+  // Number of total collections at the last young collection where regions
+  // failed evacuation because of pinned objects, or NoPinnedEvacFailure.
+  uint _last_pinned_evac_failure_gc;
+  // Pause time spent handling a region that failed evacuation due to pinning.
+  TruncatedSeq _pinned_region_cost_ms_seq;
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -114,7 +127,16 @@ class G1Policy: public CHeapObj<mtGC> {
   }
 
   double logged_cards_processing_time() const;
+
+  // Log and send a trace event comparing the predicted with the actual object
+  // copy time of the current pause.
+  void report_copy_cost_prediction(double copy_time_ms) const;
+
+  // Update the history of evacuation failures caused by pinned regions.
+  void update_pinning_history();
 public:
+  static const uint NoPinnedEvacFailure = UINT_MAX;
+
   const G1Predictions& predictor() const { return _predictor; }
   const G1Analytics* analytics()   const { return const_cast<const G1Analytics*>(_analytics); }
 
@@ -136,6 +158,28 @@ class G1Policy: public CHeapObj<mtGC> {
     _card_rs_length = card_rs_length;
   }
 
+  void record_copied_bytes(G1Analytics::CopySource source, size_t bytes) {
+    _copied_bytes[source] += bytes;
+  }
+
+  // Record the predicted object copy time of (parts of) the collection set.
+  void record_predicted_copy_time_ms(double copy_time_ms) {
+    _predicted_copy_time_ms += copy_time_ms;
+  }
+  void record_predicted_copy_time_ms(G1HeapRegion* hr);
+
+  // Minimum size of arrays to be allocated into dedicated pinnable regions.
+  static size_t pinnable_array_min_word_size();
+  // Returns whether a mutator allocation of word_size by thread should be put
+  // into a dedicated (humongous) region because the object is likely to be
+  // pinned. Predicted from the thread's pinning history, and only if pinning
+  // recently caused evacuation failures.
+  bool should_allocate_pinnable(Thread* thread, size_t word_size) const;
+  // Record that thread pinned obj located in region r.
+  void record_object_pinned(JavaThread* thread, oop obj, G1HeapRegion* r);
+  // Predicted pause time cost of a young region failing evacuation due to pinning.
+  double predict_pinned_region_cost_ms() const;
+
   double predict_base_time_ms(size_t pending_cards) const;
 
   double predict_base_time_ms(size_t pending_cards, size_t card_rs_length) const;
@@ -48,7 +48,9 @@ class G1RegionPinCache : public StackObj {
   size_t count() const { return _count; }
 #endif
 
-  void inc_count(uint region_idx);
+  // Returns whether the pin started caching a different region, i.e. it is
+  // the thread's first pin in region_idx since the last flush or switch.
+  bool inc_count(uint region_idx);
   void dec_count(uint region_idx);
 
   void flush();
@@ -29,11 +29,13 @@
 
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 
-inline void G1RegionPinCache::inc_count(uint region_idx) {
+inline bool G1RegionPinCache::inc_count(uint region_idx) {
   if (region_idx == _region_idx) {
     ++_count;
+    return false;
   } else {
     flush_and_set(region_idx, (size_t)1);
+    return true;
   }
 }
 
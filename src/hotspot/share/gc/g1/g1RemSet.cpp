@@ -1568,11 +1568,18 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
 
 void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
                                         const uint worker_id) {
+  refine_cards_concurrently(card_ptr, 1, worker_id);
+}
+
+void G1RemSet::refine_cards_concurrently(CardValue* const first_card_ptr,
+                                         const size_t num_cards,
+                                         const uint worker_id) {
   assert(!_g1h->is_stw_gc_active(), "Only call concurrently");
-  check_card_ptr(card_ptr, _ct);
+  assert(num_cards > 0, "must refine at least one card");
+  check_card_ptr(first_card_ptr, _ct);
 
-  // Construct the MemRegion representing the card.
-  HeapWord* start = _ct->addr_for(card_ptr);
+  // Construct the MemRegion representing the cards.
+  HeapWord* start = _ct->addr_for(first_card_ptr);
   // And find the region containing it.
   G1HeapRegion* r = _g1h->heap_region_containing(start);
   // This reload of the top is safe even though it happens after the full
@@ -1584,9 +1591,10 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   HeapWord* scan_limit = r->top();
   assert(scan_limit > start, "sanity");
 
-  // Don't use addr_for(card_ptr + 1) which can ask for
+  // Don't use addr_for(first_card_ptr + num_cards) which can ask for
   // a card beyond the heap.
-  HeapWord* end = start + G1CardTable::card_size_in_words();
+  HeapWord* end = start + num_cards * G1CardTable::card_size_in_words();
+  assert(end <= r->end(), "Card run must not span regions");
   MemRegion dirty_region(start, MIN2(scan_limit, end));
   assert(!dirty_region.is_empty(), "sanity");
 
@@ -1595,20 +1603,21 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
     return;
   }
 
-  // If unable to process the card then we encountered an unparsable
+  // If unable to process the cards then we encountered an unparsable
   // part of the heap (e.g. a partially allocated object, so only
-  // temporarily a problem) while processing a stale card.  Despite
-  // the card being stale, we can't simply ignore it, because we've
-  // already marked the card cleaned, so taken responsibility for
-  // ensuring the card gets scanned.
+  // temporarily a problem) while processing stale cards.  Despite
+  // the cards being stale, we can't simply ignore them, because we've
+  // already marked the cards cleaned, so taken responsibility for
+  // ensuring the cards get scanned.
   //
-  // However, the card might have gotten re-dirtied and re-enqueued
+  // However, a card might have gotten re-dirtied and re-enqueued
   // while we worked.  (In fact, it's pretty likely.)
-  if (*card_ptr == G1CardTable::dirty_card_val()) {
-    return;
+  for (size_t i = 0; i < num_cards; i++) {
+    CardValue* card_ptr = first_card_ptr + i;
+    if (*card_ptr != G1CardTable::dirty_card_val()) {
+      enqueue_for_reprocessing(card_ptr);
+    }
   }
-
-  enqueue_for_reprocessing(card_ptr);
 }
 
 // Re-dirty and re-enqueue the card to retry refinement later.
@@ -128,6 +128,12 @@ class G1RemSet: public CHeapObj<mtGC> {
   // fence/synchronization.
   void refine_card_concurrently(CardValue* const card_ptr,
                                 const uint worker_id);
+  // Refine the "num_cards" consecutive cards starting at "first_card_ptr"
+  // with a single scan of the covered heap area. All cards must be in the
+  // same region, and must have been filtered as for refine_card_concurrently().
+  void refine_cards_concurrently(CardValue* const first_card_ptr,
+                                 const size_t num_cards,
+                                 const uint worker_id);
 
   // Print accumulated summary info from the start of the VM.
   void print_summary_info();
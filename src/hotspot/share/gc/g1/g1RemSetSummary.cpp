@@ -52,6 +52,10 @@ void G1RemSetSummary::update() {
 
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   g1h->concurrent_refine()->threads_do(&collector);
+
+  if (g1h->card_set_compaction_task() != nullptr) {
+    _compaction_stats = g1h->card_set_compaction_task()->total_stats();
+  }
 }
 
 void G1RemSetSummary::set_rs_thread_vtime(uint thread, double value) {
@@ -68,7 +72,8 @@ double G1RemSetSummary::rs_thread_vtime(uint thread) const {
 
 G1RemSetSummary::G1RemSetSummary(bool should_update) :
   _num_vtimes(G1ConcRefinementThreads),
-  _rs_threads_vtimes(NEW_C_HEAP_ARRAY(double, _num_vtimes, mtGC)) {
+  _rs_threads_vtimes(NEW_C_HEAP_ARRAY(double, _num_vtimes, mtGC)),
+  _compaction_stats() {
 
   memset(_rs_threads_vtimes, 0, sizeof(double) * _num_vtimes);
 
@@ -86,6 +91,7 @@ void G1RemSetSummary::set(G1RemSetSummary* other) {
   assert(_num_vtimes == other->_num_vtimes, "just checking");
 
   memcpy(_rs_threads_vtimes, other->_rs_threads_vtimes, sizeof(double) * _num_vtimes);
+  _compaction_stats = other->_compaction_stats;
 }
 
 void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
@@ -95,6 +101,7 @@ void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
   for (uint i = 0; i < _num_vtimes; i++) {
     set_rs_thread_vtime(i, other->rs_thread_vtime(i) - rs_thread_vtime(i));
   }
+  _compaction_stats.subtract_from(other->_compaction_stats);
 }
 
 class RegionTypeCounter {
@@ -334,4 +341,8 @@ void G1RemSetSummary::print_on(outputStream* out, bool show_thread_times) {
   HRRSStatsIter blk;
   G1CollectedHeap::heap()->heap_region_iterate(&blk);
   blk.print_summary_on(out);
+
+  if (G1CollectedHeap::heap()->card_set_compaction_task() != nullptr) {
+    _compaction_stats.print_on(out);
+  }
 }
@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1REMSETSUMMARY_HPP
 
 #include "gc/g1/g1CardSet.hpp"
+#include "gc/g1/g1CardSetCompactionTask.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
 
@@ -37,6 +38,8 @@ class G1RemSetSummary {
   size_t _num_vtimes;
   double* _rs_threads_vtimes;
 
+  G1CardSetCompactionStats _compaction_stats;
+
   void set_rs_thread_vtime(uint thread, double value);
 
   // update this summary with current data from various places
@@ -43,10 +43,16 @@ class G1ThreadLocalData {
   // object and the number of pin operations since the last change of the region.
   G1RegionPinCache _pin_cache;
 
+  // Number of total collections at the time this thread last pinned an array
+  // large enough to be allocated into a pinnable region, or NoLargeArrayPinned.
+  // Used to predict that large arrays allocated by this thread will be pinned.
+  uint _last_large_array_pin_gc;
+
   G1ThreadLocalData() :
       _satb_mark_queue(&G1BarrierSet::satb_mark_queue_set()),
       _dirty_card_queue(&G1BarrierSet::dirty_card_queue_set()),
-      _pin_cache() {}
+      _pin_cache(),
+      _last_large_array_pin_gc(NoLargeArrayPinned) {}
 
   static G1ThreadLocalData* data(Thread* thread) {
     assert(UseG1GC, "Sanity");
@@ -62,6 +68,8 @@ class G1ThreadLocalData {
   }
 
 public:
+  static const uint NoLargeArrayPinned = UINT_MAX;
+
   static void create(Thread* thread) {
     new (data(thread)) G1ThreadLocalData();
   }
@@ -98,9 +106,21 @@ class G1ThreadLocalData {
     return dirty_card_queue_offset() + G1DirtyCardQueue::byte_offset_of_buf();
   }
 
+  static ByteSize dirty_card_queue_last_dirtied_card_offset() {
+    return dirty_card_queue_offset() + G1DirtyCardQueue::byte_offset_of_last_dirtied_card();
+  }
+
   static G1RegionPinCache& pin_count_cache(Thread* thread) {
     return data(thread)->_pin_cache;
   }
+
+  static uint last_large_array_pin_gc(Thread* thread) {
+    return data(thread)->_last_large_array_pin_gc;
+  }
+
+  static void set_last_large_array_pin_gc(Thread* thread, uint gc_count) {
+    data(thread)->_last_large_array_pin_gc = gc_count;
+  }
 };
 
 #endif // SHARE_GC_G1_G1THREADLOCALDATA_HPP
@@ -127,6 +127,18 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_copy_cost_prediction(double predicted_copy_time_ms,
+                                              double copy_time_ms,
+                                              size_t eden_copied_bytes,
+                                              size_t survivor_copied_bytes,
+                                              size_t old_copied_bytes) {
+  send_copy_cost_prediction(predicted_copy_time_ms,
+                            copy_time_ms,
+                            eden_copied_bytes,
+                            survivor_copied_bytes,
+                            old_copied_bytes);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -248,6 +260,24 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_copy_cost_prediction(double predicted_copy_time_ms,
+                                            double copy_time_ms,
+                                            size_t eden_copied_bytes,
+                                            size_t survivor_copied_bytes,
+                                            size_t old_copied_bytes) {
+  EventG1CopyCostPrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_predictedCopyTime(predicted_copy_time_ms * NANOSECS_PER_MILLISEC);
+    evt.set_copyTime(copy_time_ms * NANOSECS_PER_MILLISEC);
+    evt.set_predictionError(predicted_copy_time_ms > 0.0 ? (copy_time_ms - predicted_copy_time_ms) / predicted_copy_time_ms : 0.0);
+    evt.set_edenCopiedBytes(eden_copied_bytes);
+    evt.set_survivorCopiedBytes(survivor_copied_bytes);
+    evt.set_oldCopiedBytes(old_copied_bytes);
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
@@ -272,3 +302,19 @@ void G1MMUTracer::send_g1_mmu_event(double time_slice_ms, double gc_time_ms, dou
     e.commit();
   }
 }
+
+void G1PinningTracer::report_object_pinning(oop obj, uint region_idx, bool young, double predicted_cost_ms) {
+  send_object_pinning_event(obj, region_idx, young, predicted_cost_ms);
+}
+
+void G1PinningTracer::send_object_pinning_event(oop obj, uint region_idx, bool young, double predicted_cost_ms) {
+  EventG1ObjectPinning e;
+  if (e.should_commit()) {
+    e.set_objectClass(obj->klass());
+    e.set_objectSize(obj->size() * HeapWordSize);
+    e.set_regionIndex(region_idx);
+    e.set_youngRegion(young);
+    e.set_predictedPauseCost((s8)(predicted_cost_ms * NANOSECS_PER_MILLISEC));
+    e.commit();
+  }
+}
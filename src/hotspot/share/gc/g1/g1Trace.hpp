@@ -63,6 +63,11 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_copy_cost_prediction(double predicted_copy_time_ms,
+                                   double copy_time_ms,
+                                   size_t eden_copied_bytes,
+                                   size_t survivor_copied_bytes,
+                                   size_t old_copied_bytes);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +89,11 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_copy_cost_prediction(double predicted_copy_time_ms,
+                                 double copy_time_ms,
+                                 size_t eden_copied_bytes,
+                                 size_t survivor_copied_bytes,
+                                 size_t old_copied_bytes);
 };
 
 class G1OldTracer : public OldGCTracer, public CHeapObj<mtGC> {
@@ -106,4 +116,11 @@ class G1MMUTracer : public AllStatic {
   static void report_mmu(double time_slice_sec, double gc_time_sec, double max_time_sec);
 };
 
+class G1PinningTracer : public AllStatic {
+  static void send_object_pinning_event(oop obj, uint region_idx, bool young, double predicted_cost_ms);
+
+public:
+  static void report_object_pinning(oop obj, uint region_idx, bool young, double predicted_cost_ms);
+};
+
 #endif
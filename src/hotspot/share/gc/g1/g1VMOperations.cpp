@@ -172,3 +172,16 @@ void VM_G1PauseCleanup::work() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   g1h->concurrent_mark()->cleanup();
 }
+
+bool VM_G1ShrinkHeap::doit_prologue() {
+  Heap_lock->lock();
+  return true;
+}
+
+void VM_G1ShrinkHeap::doit_epilogue() {
+  Heap_lock->unlock();
+}
+
+void VM_G1ShrinkHeap::doit() {
+  G1CollectedHeap::heap()->shrink_for_memory_pressure();
+}
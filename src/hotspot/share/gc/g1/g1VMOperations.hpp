@@ -109,4 +109,15 @@ class VM_G1PauseCleanup : public VM_G1PauseConcurrent {
   void work() override;
 };
 
+// Shrinks the heap outside of a GC because of memory pressure of the
+// environment.
+class VM_G1ShrinkHeap : public VM_Operation {
+public:
+  VM_G1ShrinkHeap() { }
+  VMOp_Type type() const override { return VMOp_G1ShrinkHeap; }
+  bool doit_prologue() override;
+  void doit_epilogue() override;
+  void doit() override;
+};
+
 #endif // SHARE_GC_G1_G1VMOPERATIONS_HPP
@@ -343,12 +343,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -357,9 +352,27 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
+      //
+      // With G1EagerReclaimHumongousObjArrays we also nominate
+      // is_objArray() objects, but only if they are not subject to the
+      // constraints above, i.e. no marking or rebuild is in progress, or
+      // they were allocated after the start of marking. Their remembered
+      // set entries on other regions are left stale, see
+      // G1FreeHumongousRegionClosure.
+      //
+      // As a cheap conservative liveness check, both kinds of objects must
+      // have only few remembered set entries.
 
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      if (!_g1h->is_potential_eager_reclaim_candidate(region)) {
+        return false;
+      }
+      if (obj->is_typeArray()) {
+        return true;
+      }
+      return G1EagerReclaimHumongousObjArrays &&
+             obj->is_objArray() &&
+             (!_g1h->collector_state()->mark_or_rebuild_in_progress() ||
+              _g1h->concurrent_mark()->obj_allocated_since_mark_start(obj));
     }
 
   public:
@@ -395,7 +408,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
         _g1h->register_region_with_region_attr(hr);
       }
       log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu "
-                               "marked %d pinned count %zu reclaim candidate %d type array %d",
+                               "marked %d pinned count %zu reclaim candidate %d type array %d obj array %d",
                                index,
                                cast_to_oop(hr->bottom())->size() * HeapWordSize,
                                p2i(hr->bottom()),
@@ -404,7 +417,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
                                _g1h->concurrent_mark()->mark_bitmap()->is_marked(hr->bottom()),
                                hr->pinned_count(),
                                _g1h->is_humongous_reclaim_candidate(index),
-                               cast_to_oop(hr->bottom())->is_typeArray()
+                               cast_to_oop(hr->bottom())->is_typeArray(),
+                               cast_to_oop(hr->bottom())->is_objArray()
                               );
       _worker_humongous_total++;
 
@@ -51,6 +51,7 @@
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/ticks.hpp"
 
 class G1PostEvacuateCollectionSetCleanupTask1::MergePssTask : public G1AbstractSubTask {
@@ -338,6 +339,8 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
   uint _humongous_regions_reclaimed;
   size_t _freed_bytes;
   G1CollectedHeap* _g1h;
+  // Regions of reclaimed object arrays, whose card table must be cleared.
+  GrowableArrayCHeap<uint, mtGC>* _obj_array_regions;
 
   // Returns whether the given humongous object defined by the start region index
   // is reclaimable.
@@ -351,7 +354,8 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
   // references will set the candidate state to false.
   // - there can be no references from within humongous starts regions referencing
   // the object because we never allocate other objects into them.
-  // (I.e. there can be no intra-region references)
+  // (I.e. there can be no intra-region references other than an object array
+  // referencing itself, which does not keep it alive)
   //
   // It is not required to check whether the object has been found dead by marking
   // or not, in fact it would prevent reclamation within a concurrent cycle, as
@@ -366,20 +370,25 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - remembered sets of other regions may keep stale entries for cards of a
+  // reclaimed object array. These are harmless, as scanning cards is limited to
+  // the allocated part of a region at the start of a collection, and any later
+  // allocation into the region is parsable.
+  // - cards of a reclaimed object array may have been logged for redirtying
+  // during this collection. The card table of its regions is cleared after
+  // redirtying so that no dirty cards without a corresponding refinement
+  // buffer entry remain.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
 
 public:
-  G1FreeHumongousRegionClosure() :
+  G1FreeHumongousRegionClosure(GrowableArrayCHeap<uint, mtGC>* obj_array_regions) :
     _humongous_objects_reclaimed(0),
     _humongous_regions_reclaimed(0),
     _freed_bytes(0),
-    _g1h(G1CollectedHeap::heap())
+    _g1h(G1CollectedHeap::heap()),
+    _obj_array_regions(obj_array_regions)
   {}
 
   bool do_heap_region_index(uint region_index) override {
@@ -390,14 +399,16 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
     G1HeapRegion* r = _g1h->region_at(region_index);
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray()),
+              "Only eagerly reclaiming type arrays and object arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
+    bool is_obj_array = obj->is_objArray();
 
-    log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
+    log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")%s",
                              region_index,
                              obj->size() * HeapWordSize,
-                             p2i(r->bottom())
+                             p2i(r->bottom()),
+                             is_obj_array ? " object array" : ""
                             );
 
     G1ConcurrentMark* const cm = _g1h->concurrent_mark();
@@ -412,6 +423,9 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
       _freed_bytes += r->used();
       r->set_containing_set(nullptr);
       _humongous_regions_reclaimed++;
+      if (is_obj_array) {
+        _obj_array_regions->append(r->hrm_index());
+      }
       G1HeapRegionPrinter::eager_reclaim(r);
       _g1h->free_humongous_region(r, nullptr);
     };
@@ -445,35 +459,73 @@ class G1PostEvacuateCollectionSetCleanupTask2::UpdateDerivedPointersTask : publi
 #endif
 
 class G1PostEvacuateCollectionSetCleanupTask2::EagerlyReclaimHumongousObjectsTask : public G1AbstractSubTask {
-  uint _humongous_regions_reclaimed;
-  size_t _bytes_freed;
+  // Number of region indices claimed at once by a worker.
+  static const uint RegionsPerChunk = 256;
+  // Number of reclaim candidates a worker is expected to handle.
+  static const uint CandidatesPerWorker = 8;
+
+  volatile uint _next_region_idx;
+  volatile uint _humongous_regions_reclaimed;
+  volatile size_t _bytes_freed;
+
+  // Regions of reclaimed object arrays, protected by G1RareEvent_lock.
+  GrowableArrayCHeap<uint, mtGC> _obj_array_regions;
 
 public:
   EagerlyReclaimHumongousObjectsTask() :
     G1AbstractSubTask(G1GCPhaseTimes::EagerlyReclaimHumongousObjects),
+    _next_region_idx(0),
     _humongous_regions_reclaimed(0),
-    _bytes_freed(0) { }
+    _bytes_freed(0),
+    _obj_array_regions() { }
 
   virtual ~EagerlyReclaimHumongousObjectsTask() {
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     g1h->remove_from_old_gen_sets(0, _humongous_regions_reclaimed);
     g1h->decrement_summary_bytes(_bytes_freed);
+
+    // All tasks of this batch, including redirtying of logged cards, have
+    // completed. Clean up the cards they may have dirtied in the regions of
+    // reclaimed object arrays.
+    for (GrowableArrayIterator<uint> it = _obj_array_regions.begin(); it != _obj_array_regions.end(); ++it) {
+      g1h->region_at(*it)->clear_cardtable();
+    }
+  }
+
+  double worker_cost() const override {
+    return (double)G1CollectedHeap::heap()->num_humongous_reclaim_candidates() / CandidatesPerWorker;
   }
 
-  double worker_cost() const override { return 1.0; }
   void do_work(uint worker_id) override {
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    const uint max_regions = g1h->max_reserved_regions();
 
-    G1FreeHumongousRegionClosure cl;
-    g1h->heap_region_iterate(&cl);
+    GrowableArrayCHeap<uint, mtGC> obj_array_regions;
+    G1FreeHumongousRegionClosure cl(&obj_array_regions);
+
+    for (uint start = Atomic::fetch_then_add(&_next_region_idx, RegionsPerChunk);
+         start < max_regions;
+         start = Atomic::fetch_then_add(&_next_region_idx, RegionsPerChunk)) {
+      if (start == 0) {
+        record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumTotal, g1h->num_humongous_objects());
+        record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumCandidates, g1h->num_humongous_reclaim_candidates());
+      }
+      uint end = MIN2(start + RegionsPerChunk, max_regions);
+      for (uint i = start; i < end; i++) {
+        cl.do_heap_region_index(i);
+      }
+    }
 
-    record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumTotal, g1h->num_humongous_objects());
-    record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumCandidates, g1h->num_humongous_reclaim_candidates());
     record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumReclaimed, cl.humongous_objects_reclaimed());
 
-    _humongous_regions_reclaimed = cl.humongous_regions_reclaimed();
-    _bytes_freed = cl.bytes_freed();
+    Atomic::add(&_humongous_regions_reclaimed, cl.humongous_regions_reclaimed());
+    Atomic::add(&_bytes_freed, cl.bytes_freed());
+
+    if (obj_array_regions.is_nonempty()) {
+      MutexLocker x(G1RareEvent_lock, Mutex::_no_safepoint_check_flag);
+      _obj_array_regions.appendAll(&obj_array_regions);
+    }
   }
 };
 
@@ -975,7 +1027,7 @@ G1PostEvacuateCollectionSetCleanupTask2::G1PostEvacuateCollectionSetCleanupTask2
   add_serial_task(new UpdateDerivedPointersTask());
 #endif
   if (G1CollectedHeap::heap()->has_humongous_reclaim_candidates()) {
-    add_serial_task(new EagerlyReclaimHumongousObjectsTask());
+    add_parallel_task(new EagerlyReclaimHumongousObjectsTask());
   }
 
   if (evac_failure_regions->has_regions_evac_failed()) {
@@ -52,8 +52,8 @@ class G1PostEvacuateCollectionSetCleanupTask1 : public G1BatchedTask {
 };
 
 // Second set of post evacuate collection set tasks containing (s means serial):
-// - Eagerly Reclaim Humongous Objects (s)
 // - Update Derived Pointers (s)
+// - Eagerly Reclaim Humongous Objects
 // - Clear Retained Region Data (on evacuation failure)
 // - Redirty Logged Cards
 // - Restore Preserved Marks (on evacuation failure)
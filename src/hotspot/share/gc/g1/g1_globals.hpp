@@ -127,6 +127,12 @@
           "in milliseconds.")                                               \
           range(1.0, DBL_MAX)                                               \
                                                                             \
+  product(uint, G1ConcMarkPrefetchDistance, 0, EXPERIMENTAL,                \
+          "Number of entries popped from the local mark queue that are "    \
+          "kept in flight while prefetching their headers and klasses "     \
+          "before scanning them. 0 scans entries right after popping.")     \
+          range(0, 16)                                                      \
+                                                                            \
   product(uint, G1RefProcDrainInterval, 1000,                               \
           "The number of discovered reference objects to process before "   \
           "draining concurrent marking work queues.")                       \
@@ -164,6 +170,11 @@
           "Size of an update buffer")                                       \
           constraint(G1UpdateBufferSizeConstraintFunc, AtParse)             \
                                                                             \
+  product(bool, G1UsePostBarrierCardCache, false, EXPERIMENTAL,            \
+          "Let the post-write barrier skip stores into the card the "       \
+          "thread dirtied last while that card is still in the thread's "   \
+          "dirty card queue buffer. Only supported on x86_64 and AArch64.") \
+                                                                            \
   product(uint, G1RSetUpdatingPauseTimePercent, 10,                         \
           "A target percentage of time that is allowed to be spend on "     \
           "processing remembered set update buffers during the collection " \
@@ -267,6 +278,10 @@
           "otherwise eligible for eager reclaim may have to be a candidate "\
           "for eager reclaim. Will be selected ergonomically by default.")  \
                                                                             \
+  product(bool, G1EagerReclaimHumongousObjArrays, false, EXPERIMENTAL,      \
+          "Also try to reclaim humongous object arrays during young "       \
+          "collections, not only humongous primitive arrays.")              \
+                                                                            \
   product(size_t, G1RebuildRemSetChunkSize, 256 * K, EXPERIMENTAL,          \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
@@ -299,6 +314,28 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(bool, G1UncommitOnMemoryPressure, false, EXPERIMENTAL,            \
+          "Periodically check the memory pressure of the container the VM " \
+          "runs in, and shrink the heap in steps while under pressure, "    \
+          "uncommitting free regions without a GC.")                        \
+                                                                            \
+  product(uint, G1MemoryPressureCheckIntervalMillis, 1000, EXPERIMENTAL,    \
+          "Time in milliseconds between checks for memory pressure if "     \
+          "G1UncommitOnMemoryPressure is enabled.")                         \
+          range(10, UINT_MAX)                                               \
+                                                                            \
+  product(double, G1MemoryPressureStallThreshold, 10.0, EXPERIMENTAL,       \
+          "Percentage of the recent wall time in which some tasks of the "  \
+          "container stalled waiting for memory above which G1 considers "  \
+          "the container to be under memory pressure.")                     \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  product(uint, G1MemoryPressureShrinkPercent, 10, EXPERIMENTAL,            \
+          "Percentage of the free committed regions not needed for the "    \
+          "current young generation the heap is shrunk by per check under " \
+          "memory pressure.")                                               \
+          range(1, 100)                                                     \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
@@ -315,6 +352,17 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(uint, G1RemSetCompactionIntervalMillis, 0, EXPERIMENTAL,          \
+          "Time between two passes of the card set compaction task over "   \
+          "the remembered sets of old and humongous regions. A value of "   \
+          "0 disables the task.")                                           \
+                                                                            \
+  product(uint, G1RemSetCompactionDensityPercent, 50, EXPERIMENTAL,         \
+          "Occupancy of a region's cards, in percent, at which the card "   \
+          "set compaction task coarsens a Howl container to a full card "   \
+          "set container.")                                                 \
+          range(1, 100)                                                     \
+                                                                            \
   product(uint, G1RestoreRetainedRegionChunksPerWorker, 16, DIAGNOSTIC,     \
           "The number of chunks assigned per worker thread for "            \
           "retained region restore purposes.")                              \
@@ -324,6 +372,17 @@
           "After how many GCs a region has been found pinned G1 should "    \
           "give up reclaiming it.")                                         \
                                                                             \
+  product(bool, G1UsePinnableArrayAllocation, false, EXPERIMENTAL,         \
+          "Allocate large arrays of threads that recently pinned large "    \
+          "arrays into dedicated humongous regions, so that pinning them "  \
+          "does not cause evacuation failures of young regions. Only "      \
+          "active if pinning caused evacuation failures recently.")         \
+                                                                            \
+  product(uint, G1PinnableArrayMinRegionPercent, 25, EXPERIMENTAL,          \
+          "Minimum size of an array, in percent of the region size, to be " \
+          "considered for allocation into a dedicated pinnable region.")    \
+          range(1, 50)                                                      \
+                                                                            \
   product(uint, G1NumCardsCostSampleThreshold, 1000, DIAGNOSTIC,            \
           "Threshold for the number of cards when reporting remembered set "\
           "card cost related prediction samples. A sample must involve "    \
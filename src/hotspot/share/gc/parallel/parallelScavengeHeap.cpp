@@ -160,13 +160,13 @@ void ParallelScavengeHeap::initialize_serviceability() {
 }
 
 void ParallelScavengeHeap::safepoint_synchronize_begin() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || StringTableCleanupThreads > 1) {
     SuspendibleThreadSet::synchronize();
   }
 }
 
 void ParallelScavengeHeap::safepoint_synchronize_end() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || StringTableCleanupThreads > 1) {
     SuspendibleThreadSet::desynchronize();
   }
 }
@@ -153,18 +153,22 @@ void ParCompactionManager::follow_marking_stacks() {
   assert(marking_stacks_empty(), "Sanity");
 }
 
-void ParCompactionManager::drain_region_stacks() {
+size_t ParCompactionManager::drain_region_stacks() {
+  size_t drained = 0;
   do {
     // Drain overflow stack first so other threads can steal.
     size_t region_index;
     while (region_stack()->pop_overflow(region_index)) {
       PSParallelCompact::fill_and_update_region(this, region_index);
+      drained++;
     }
 
     while (region_stack()->pop_local(region_index)) {
       PSParallelCompact::fill_and_update_region(this, region_index);
+      drained++;
     }
   } while (!region_stack()->is_empty());
+  return drained;
 }
 
 size_t ParCompactionManager::pop_shadow_region_mt_safe(PSParallelCompact::RegionData* region_ptr) {
@@ -206,8 +206,8 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   void follow_marking_stacks();
   inline bool marking_stacks_empty() const;
 
-  // Process tasks remaining on any stack
-  void drain_region_stacks();
+  // Process tasks remaining on any stack; returns the number of regions filled.
+  size_t drain_region_stacks();
 
   void follow_contents(oop obj);
   void follow_array(objArrayOop array, int index);
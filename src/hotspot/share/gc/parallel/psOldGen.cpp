@@ -32,12 +32,18 @@
 #include "gc/shared/cardTableBarrierSet.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "runtime/perfData.hpp"
 #include "utilities/align.hpp"
 
 PSOldGen::PSOldGen(ReservedSpace rs, size_t initial_size, size_t min_size,
                    size_t max_size, const char* perf_data_name, int level):
+  _numa_nodes(0),
+  _numa_lgrp_ids(nullptr),
+  _numa_used(nullptr),
   _min_gen_size(min_size),
   _max_gen_size(max_size)
 {
@@ -118,6 +124,82 @@ void PSOldGen::initialize_performance_counters(const char* perf_data_name, int l
   _space_counters = new SpaceCounters(perf_data_name, 0,
                                       virtual_space()->reserved_size(),
                                       _object_space, _gen_counters);
+  if (UseNUMA) {
+    initialize_numa_counters();
+  }
+}
+
+void PSOldGen::initialize_numa_counters() {
+  size_t lgrp_limit = os::numa_get_groups_num();
+  _numa_lgrp_ids = NEW_C_HEAP_ARRAY(uint, lgrp_limit, mtGC);
+  _numa_nodes = checked_cast<uint>(os::numa_get_leaf_groups(_numa_lgrp_ids, lgrp_limit));
+
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+
+    _numa_used = NEW_C_HEAP_ARRAY(PerfVariable*, _numa_nodes, mtGC);
+    for (uint i = 0; i < _numa_nodes; i++) {
+      const char* ns = PerfDataManager::name_space(_space_counters->name_space(), "node", i);
+      const char* cname = PerfDataManager::counter_name(ns, "id");
+      PerfDataManager::create_constant(SUN_GC, cname, PerfData::U_None,
+                                       (jlong)_numa_lgrp_ids[i], CHECK);
+      cname = PerfDataManager::counter_name(ns, "used");
+      _numa_used[i] = PerfDataManager::create_variable(SUN_GC, cname,
+                                                       PerfData::U_Bytes, (jlong)0, CHECK);
+    }
+  }
+}
+
+void PSOldGen::update_numa_counters() {
+  static const size_t MaxSampledPages = 1024;
+  static const size_t PagesPerIteration = 128;
+
+  const size_t page_size = os::vm_page_size();
+  char* const start = (char*)align_up(object_space()->bottom(), page_size);
+  char* const end = (char*)align_up(object_space()->top(), page_size);
+  if (end <= start) {
+    return;
+  }
+
+  // Sample at most MaxSampledPages pages and scale the counts up.
+  const size_t pages = pointer_delta(end, start, page_size);
+  const size_t stride = page_size * MAX2(pages / MaxSampledPages, (size_t)1);
+
+  size_t* node_bytes = NEW_C_HEAP_ARRAY(size_t, _numa_nodes, mtGC);
+  for (uint i = 0; i < _numa_nodes; i++) {
+    node_bytes[i] = 0;
+  }
+
+  for (char* p = start; p < end; ) {
+    const void* addrs[PagesPerIteration];
+    int lgrp_ids[PagesPerIteration];
+
+    size_t npages = 0;
+    for (; npages < PagesPerIteration && p < end; p += stride) {
+      addrs[npages++] = p;
+    }
+
+    if (!os::numa_get_group_ids_for_range(addrs, lgrp_ids, npages)) {
+      break;
+    }
+    for (size_t i = 0; i < npages; i++) {
+      for (uint n = 0; n < _numa_nodes; n++) {
+        if (lgrp_ids[i] >= 0 && checked_cast<uint>(lgrp_ids[i]) == _numa_lgrp_ids[n]) {
+          node_bytes[n] += stride;
+          break;
+        }
+      }
+    }
+  }
+
+  for (uint i = 0; i < _numa_nodes; i++) {
+    if (_numa_used != nullptr) {
+      _numa_used[i]->set_value((jlong)node_bytes[i]);
+    }
+    log_debug(gc, heap, numa)("Old gen node %u: " SIZE_FORMAT "K", _numa_lgrp_ids[i], node_bytes[i] / K);
+  }
+  FREE_C_HEAP_ARRAY(size_t, node_bytes);
 }
 
 HeapWord* PSOldGen::expand_and_allocate(size_t word_size) {
@@ -381,6 +463,9 @@ void PSOldGen::update_counters() {
     _space_counters->update_all();
     _gen_counters->update_all();
   }
+  if (_numa_nodes > 0 && (_numa_used != nullptr || log_is_enabled(Debug, gc, heap, numa))) {
+    update_numa_counters();
+  }
 }
 
 void PSOldGen::verify() {
@@ -44,6 +44,11 @@ class PSOldGen : public CHeapObj<mtGC> {
   PSGenerationCounters*    _gen_counters;
   SpaceCounters*           _space_counters;
 
+  // Sampled occupancy per NUMA node (UseNUMA only)
+  uint                     _numa_nodes;
+  uint*                    _numa_lgrp_ids;
+  PerfVariable**           _numa_used;
+
   // Sizing information, in bytes, set in constructor
   const size_t _min_gen_size;
   const size_t _max_gen_size;
@@ -74,6 +79,11 @@ class PSOldGen : public CHeapObj<mtGC> {
   void initialize_virtual_space(ReservedSpace rs, size_t initial_size, size_t alignment);
   void initialize_work(const char* perf_data_name, int level);
   void initialize_performance_counters(const char* perf_data_name, int level);
+  void initialize_numa_counters();
+
+  // Estimate how the used part of the generation is spread over the NUMA
+  // nodes by sampling the placement of its pages.
+  void update_numa_counters();
 
  public:
   // Initialize the generation.
@@ -63,10 +63,12 @@
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/weakProcessor.inline.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "gc/shared/workerPolicy.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "gc/shared/workerUtils.hpp"
 #include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
@@ -1519,6 +1521,44 @@ void PSParallelCompact::adjust_pointers() {
   ParallelScavengeHeap::heap()->workers().run_task(&task);
 }
 
+// Per-worker busy time and processed region count of a parallel phase. The
+// utilization is the summed busy time relative to the wall time of the phase
+// times the number of workers; it is logged with gc+phases=debug.
+class PSWorkerUtilization : public StackObj {
+  const char* const _title;
+  const uint _num_workers;
+  const Ticks _start;
+  WorkerDataArray<double> _busy;
+
+public:
+  PSWorkerUtilization(const char* title, uint num_workers) :
+    _title(title),
+    _num_workers(num_workers),
+    _start(Ticks::now()),
+    _busy(nullptr, title, num_workers) {
+    _busy.create_thread_work_items("Regions:");
+  }
+
+  void record(uint worker_id, Tickspan busy, size_t regions) {
+    _busy.set(worker_id, busy.seconds());
+    _busy.set_thread_work_item(worker_id, regions);
+  }
+
+  ~PSWorkerUtilization() {
+    LogTarget(Debug, gc, phases) lt;
+    if (!lt.is_enabled()) {
+      return;
+    }
+    double wall = (Ticks::now() - _start).seconds();
+    double utilization = wall > 0.0 ? _busy.sum() / (wall * _num_workers) : 1.0;
+    LogStream ls(lt);
+    ls.print_cr("%s: Utilization %.1f%% (%u workers, %.3fms)",
+                _title, utilization * 100.0, _num_workers, wall * MILLIUNITS);
+    _busy.print_summary_on(&ls);
+    _busy.thread_work_items()->print_summary_on(&ls);
+  }
+};
+
 // Split [start, end) evenly for a number of workers and return the
 // range for worker_id.
 static void split_regions_for_worker(size_t start, size_t end,
@@ -1538,72 +1578,99 @@ static void split_regions_for_worker(size_t start, size_t end,
                 + (worker_id < remainder ? 1 : 0);
 }
 
+// Regions are forwarded in small strides claimed by the workers rather than
+// split up front, so that workers finishing sparse parts of the heap help
+// with the dense ones.
+static const size_t ForwardClaimStride = 4;
+
 void PSParallelCompact::forward_to_new_addr() {
   GCTraceTime(Info, gc, phases) tm("Forward", &_gc_timer);
   uint nworkers = ParallelScavengeHeap::heap()->workers().active_workers();
 
   struct ForwardTask final : public WorkerTask {
-    uint _num_workers;
+    volatile size_t _next_region[last_space_id];
+    size_t _end_region[last_space_id];
+    PSWorkerUtilization* _utilization;
 
-    explicit ForwardTask(uint num_workers) :
+    ForwardTask(PSWorkerUtilization* utilization) :
       WorkerTask("PSForward task"),
-      _num_workers(num_workers) {}
+      _utilization(utilization) {
+      for (uint id = old_space_id; id < last_space_id; ++id) {
+        HeapWord* dense_prefix_addr = dense_prefix(SpaceId(id));
+        HeapWord* top = PSParallelCompact::space(SpaceId(id))->top();
+        _next_region[id] = _summary_data.addr_to_region_idx(dense_prefix_addr);
+        _end_region[id] = _summary_data.addr_to_region_idx(_summary_data.region_align_up(top));
+      }
+    }
+
+    bool claim(uint id, size_t& start_region, size_t& end_region) {
+      if (Atomic::load(&_next_region[id]) >= _end_region[id]) {
+        return false;
+      }
+      start_region = Atomic::fetch_then_add(&_next_region[id], ForwardClaimStride);
+      if (start_region >= _end_region[id]) {
+        return false;
+      }
+      end_region = MIN2(start_region + ForwardClaimStride, _end_region[id]);
+      return true;
+    }
 
     void work(uint worker_id) override {
+      Ticks start = Ticks::now();
+      size_t processed = 0;
       ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
       for (uint id = old_space_id; id < last_space_id; ++id) {
-        MutableSpace* sp = PSParallelCompact::space(SpaceId(id));
-        HeapWord* dense_prefix_addr = dense_prefix(SpaceId(id));
-        HeapWord* top = sp->top();
+        size_t start_region;
+        size_t end_region;
+        while (claim(id, start_region, end_region)) {
+          processed += end_region - start_region;
+          forward_regions(cm, start_region, end_region);
+        }
+      }
+      _utilization->record(worker_id, Ticks::now() - start, processed);
+    }
+
+    static void forward_regions(ParCompactionManager* cm, size_t start_region, size_t end_region) {
+      for (size_t cur_region = start_region; cur_region < end_region; ++cur_region) {
+        RegionData* region_ptr = _summary_data.region(cur_region);
+        size_t live_words = region_ptr->partial_obj_size();
 
-        if (dense_prefix_addr == top) {
+        if (live_words == ParallelCompactData::RegionSize) {
+          // No obj-start
           continue;
         }
 
-        size_t dense_prefix_region = _summary_data.addr_to_region_idx(dense_prefix_addr);
-        size_t top_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(top));
-        size_t start_region;
-        size_t end_region;
-        split_regions_for_worker(dense_prefix_region, top_region,
-                                 worker_id, _num_workers,
-                                 &start_region, &end_region);
-        for (size_t cur_region = start_region; cur_region < end_region; ++cur_region) {
-          RegionData* region_ptr = _summary_data.region(cur_region);
-          size_t live_words = region_ptr->partial_obj_size();
-
-          if (live_words == ParallelCompactData::RegionSize) {
-            // No obj-start
-            continue;
-          }
+        HeapWord* region_start = _summary_data.region_to_addr(cur_region);
+        HeapWord* region_end = region_start + ParallelCompactData::RegionSize;
 
-          HeapWord* region_start = _summary_data.region_to_addr(cur_region);
-          HeapWord* region_end = region_start + ParallelCompactData::RegionSize;
-
-          HeapWord* cur_addr = region_start + live_words;
-
-          HeapWord* destination = region_ptr->destination();
-          while (cur_addr < region_end) {
-            cur_addr = mark_bitmap()->find_obj_beg(cur_addr, region_end);
-            if (cur_addr >= region_end) {
-              break;
-            }
-            assert(mark_bitmap()->is_marked(cur_addr), "inv");
-            HeapWord* new_addr = destination + live_words;
-            oop obj = cast_to_oop(cur_addr);
-            if (new_addr != cur_addr) {
-              cm->preserved_marks()->push_if_necessary(obj, obj->mark());
-              obj->forward_to(cast_to_oop(new_addr));
-            }
-            size_t obj_size = obj->size();
-            live_words += obj_size;
-            cur_addr += obj_size;
+        HeapWord* cur_addr = region_start + live_words;
+
+        HeapWord* destination = region_ptr->destination();
+        while (cur_addr < region_end) {
+          cur_addr = mark_bitmap()->find_obj_beg(cur_addr, region_end);
+          if (cur_addr >= region_end) {
+            break;
+          }
+          assert(mark_bitmap()->is_marked(cur_addr), "inv");
+          HeapWord* new_addr = destination + live_words;
+          oop obj = cast_to_oop(cur_addr);
+          if (new_addr != cur_addr) {
+            cm->preserved_marks()->push_if_necessary(obj, obj->mark());
+            obj->forward_to(cast_to_oop(new_addr));
           }
+          size_t obj_size = obj->size();
+          live_words += obj_size;
+          cur_addr += obj_size;
         }
       }
     }
-  } task(nworkers);
+  };
 
-  ParallelScavengeHeap::heap()->workers().run_task(&task);
+  {
+    PSWorkerUtilization utilization("Forward", nworkers);
+    ForwardTask task(&utilization);
+    ParallelScavengeHeap::heap()->workers().run_task(&task);
+  }
   debug_only(verify_forward();)
 }
 
@@ -1724,7 +1791,10 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
   }
 }
 
-static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id) {
+// Returns the number of regions filled by this worker; time spent offering
+// termination is accumulated in termination_time.
+static size_t compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id,
+                                            Tickspan& termination_time) {
   assert(ParallelScavengeHeap::heap()->is_stw_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
@@ -1733,7 +1803,7 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
   // Drain the stacks that have been preloaded with regions
   // that are ready to fill.
 
-  cm->drain_region_stacks();
+  size_t filled = cm->drain_region_stacks();
 
   guarantee(cm->region_stack()->is_empty(), "Not empty");
 
@@ -1742,38 +1812,46 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
   while (true) {
     if (ParCompactionManager::steal(worker_id, region_index)) {
       PSParallelCompact::fill_and_update_region(cm, region_index);
-      cm->drain_region_stacks();
+      filled += 1 + cm->drain_region_stacks();
     } else if (PSParallelCompact::steal_unavailable_region(cm, region_index)) {
       // Fill and update an unavailable region with the help of a shadow region
       PSParallelCompact::fill_and_update_shadow_region(cm, region_index);
-      cm->drain_region_stacks();
+      filled += 1 + cm->drain_region_stacks();
     } else {
-      if (terminator->offer_termination()) {
+      Ticks offer_start = Ticks::now();
+      bool terminated = terminator->offer_termination();
+      termination_time += Ticks::now() - offer_start;
+      if (terminated) {
         break;
       }
       // Go around again.
     }
   }
+  return filled;
 }
 
 class FillDensePrefixAndCompactionTask: public WorkerTask {
   uint _num_workers;
   TaskTerminator _terminator;
+  PSWorkerUtilization* _utilization;
 
 public:
-  FillDensePrefixAndCompactionTask(uint active_workers) :
+  FillDensePrefixAndCompactionTask(uint active_workers, PSWorkerUtilization* utilization) :
       WorkerTask("FillDensePrefixAndCompactionTask"),
       _num_workers(active_workers),
-      _terminator(active_workers, ParCompactionManager::region_task_queues()) {
+      _terminator(active_workers, ParCompactionManager::region_task_queues()),
+      _utilization(utilization) {
   }
 
   virtual void work(uint worker_id) {
+    auto start = Ticks::now();
     {
-      auto start = Ticks::now();
       PSParallelCompact::fill_dead_objs_in_dense_prefix(worker_id, _num_workers);
       log_trace(gc, phases)("Fill dense prefix by worker %u: %.3f ms", worker_id, (Ticks::now() - start).seconds() * 1000);
     }
-    compaction_with_stealing_work(&_terminator, worker_id);
+    Tickspan termination_time;
+    size_t filled = compaction_with_stealing_work(&_terminator, worker_id, termination_time);
+    _utilization->record(worker_id, (Ticks::now() - start) - termination_time, filled);
   }
 };
 
@@ -1866,8 +1944,11 @@ void PSParallelCompact::compact() {
   {
     GCTraceTime(Trace, gc, phases) tm("Par Compact", &_gc_timer);
 
-    FillDensePrefixAndCompactionTask task(active_gc_threads);
-    ParallelScavengeHeap::heap()->workers().run_task(&task);
+    {
+      PSWorkerUtilization utilization("Compaction", active_gc_threads);
+      FillDensePrefixAndCompactionTask task(active_gc_threads, &utilization);
+      ParallelScavengeHeap::heap()->workers().run_task(&task);
+    }
 
 #ifdef  ASSERT
     verify_filler_in_dense_prefix();
@@ -71,6 +71,7 @@ void PSPromotionManager::initialize() {
     = new PartialArrayStateAllocator(ParallelGCThreads);
 
   _stack_array_depth = new PSScannerTasksQueueSet(ParallelGCThreads);
+  _stack_array_depth->set_steal_batch_size(WorkStealingBatchSize);
 
   // Create and register the PSPromotionManager(s) for the worker threads.
   for(uint i=0; i<ParallelGCThreads; i++) {
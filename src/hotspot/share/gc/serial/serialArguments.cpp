@@ -26,6 +26,15 @@
 #include "gc/shared/genArguments.hpp"
 #include "gc/serial/serialArguments.hpp"
 #include "gc/serial/serialHeap.hpp"
+#include "runtime/globals_extension.hpp"
+
+void SerialArguments::initialize() {
+  GenArguments::initialize();
+
+  if (SerialFootprintMode && FLAG_IS_DEFAULT(ShrinkHeapInSteps)) {
+    FLAG_SET_ERGO(ShrinkHeapInSteps, false);
+  }
+}
 
 CollectedHeap* SerialArguments::create_heap() {
   return new SerialHeap();
@@ -31,6 +31,7 @@ class CollectedHeap;
 
 class SerialArguments : public GenArguments {
 private:
+  virtual void initialize();
   virtual CollectedHeap* create_heap();
 };
 
@@ -69,10 +69,12 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/vmThread.hpp"
 #include "services/memoryManager.hpp"
 #include "services/memoryService.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
@@ -143,13 +145,13 @@ GrowableArray<MemoryPool*> SerialHeap::memory_pools() {
 }
 
 void SerialHeap::safepoint_synchronize_begin() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || StringTableCleanupThreads > 1) {
     SuspendibleThreadSet::synchronize();
   }
 }
 
 void SerialHeap::safepoint_synchronize_end() {
-  if (UseStringDeduplication) {
+  if (UseStringDeduplication || StringTableCleanupThreads > 1) {
     SuspendibleThreadSet::desynchronize();
   }
 }
@@ -701,6 +703,29 @@ void SerialHeap::collect(GCCause::Cause cause) {
   }
 }
 
+static size_t release_free_memory_in(ContiguousSpace* space) {
+  char* start = align_up((char*)space->top(), os::vm_page_size());
+  char* end = align_down((char*)space->end(), os::vm_page_size());
+  if (start >= end) {
+    return 0;
+  }
+  size_t size = pointer_delta(end, start, sizeof(char));
+  os::disclaim_memory(start, size);
+  return size;
+}
+
+void SerialHeap::release_free_memory() {
+  // The unused area is expected to stay mangled.
+  if (ZapUnusedHeapArea) {
+    return;
+  }
+  size_t released = release_free_memory_in(_young_gen->eden()) +
+                    release_free_memory_in(_young_gen->from()) +
+                    release_free_memory_in(_young_gen->to()) +
+                    release_free_memory_in(_old_gen->space());
+  log_debug(gc, heap)("Released " SIZE_FORMAT "K of free heap memory", released / K);
+}
+
 void SerialHeap::do_full_collection(bool clear_all_soft_refs) {
   if (GCLocker::check_active_before_gc()) {
     return;
@@ -756,6 +781,10 @@ void SerialHeap::do_full_collection_no_gc_locker(bool clear_all_soft_refs) {
   _old_gen->compute_new_size();
   _young_gen->compute_new_size();
 
+  if (SerialFootprintMode) {
+    release_free_memory();
+  }
+
   // Delete metaspaces for unloaded class loaders and clean up loader_data graph
   ClassLoaderDataGraph::purge(/*at_safepoint*/true);
   DEBUG_ONLY(MetaspaceUtils::verify();)
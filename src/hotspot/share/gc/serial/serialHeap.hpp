@@ -251,6 +251,10 @@ class SerialHeap : public CollectedHeap {
   // Try to allocate space by expanding the heap.
   HeapWord* expand_heap_and_allocate(size_t size, bool is_tlab);
 
+  // Return the physical memory backing the unused parts of the spaces to
+  // the OS (SerialFootprintMode). The memory stays committed.
+  void release_free_memory();
+
   HeapWord* mem_allocate_work(size_t size,
                               bool is_tlab);
 
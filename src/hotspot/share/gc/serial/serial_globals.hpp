@@ -35,6 +35,11 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, SerialFootprintMode, false, EXPERIMENTAL,                   \
+          "Minimize the resident size of the heap: shrink directly to the"  \
+          " target size and return the physical memory backing free heap"   \
+          " space to the OS after full GCs.")                               \
 
 // end of GC_SERIAL_FLAGS
 
@@ -119,14 +119,22 @@ class G1HeapSummary : public GCHeapSummary {
   size_t  _survivorUsed;
   size_t  _oldGenUsed;
   uint    _numberOfRegions;
+  size_t  _humongousUsed;
+  size_t  _humongousWasted;
+  uint    _numberOfHumongousRegions;
  public:
-   G1HeapSummary(VirtualSpaceSummary& heap_space, size_t heap_used, size_t edenUsed, size_t edenCapacity, size_t survivorUsed, size_t oldGenUsed, uint numberOfRegions) :
-      GCHeapSummary(heap_space, heap_used), _edenUsed(edenUsed), _edenCapacity(edenCapacity), _survivorUsed(survivorUsed), _oldGenUsed(oldGenUsed), _numberOfRegions(numberOfRegions) { }
+   G1HeapSummary(VirtualSpaceSummary& heap_space, size_t heap_used, size_t edenUsed, size_t edenCapacity, size_t survivorUsed, size_t oldGenUsed, uint numberOfRegions,
+                 size_t humongousUsed, size_t humongousWasted, uint numberOfHumongousRegions) :
+      GCHeapSummary(heap_space, heap_used), _edenUsed(edenUsed), _edenCapacity(edenCapacity), _survivorUsed(survivorUsed), _oldGenUsed(oldGenUsed), _numberOfRegions(numberOfRegions),
+      _humongousUsed(humongousUsed), _humongousWasted(humongousWasted), _numberOfHumongousRegions(numberOfHumongousRegions) { }
    size_t edenUsed() const { return _edenUsed; }
    size_t edenCapacity() const { return _edenCapacity; }
    size_t survivorUsed() const { return _survivorUsed; }
    size_t oldGenUsed() const { return _oldGenUsed; }
    uint   numberOfRegions() const { return _numberOfRegions; }
+   size_t humongousUsed() const { return _humongousUsed; }
+   size_t humongousWasted() const { return _humongousWasted; }
+   uint   numberOfHumongousRegions() const { return _numberOfHumongousRegions; }
 
    virtual void accept(GCHeapSummaryVisitor* visitor) const {
      visitor->visit(this);
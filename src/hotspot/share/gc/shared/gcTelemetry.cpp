@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gcTelemetry.hpp"
+#include "gc/shared/gcTimer.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+uint GCLatencyHistogram::bucket_for(uint64_t us) {
+  if (us < SubBuckets) {
+    return (uint)us;
+  }
+  uint msb = (uint)log2i(us);
+  uint sub = (uint)(us >> (msb - SubBucketBits)) & (SubBuckets - 1);
+  return (msb - SubBucketBits + 1) * SubBuckets + sub;
+}
+
+uint64_t GCLatencyHistogram::bucket_lower_bound(uint bucket) {
+  assert(bucket < NumBuckets, "bucket out of range: %u", bucket);
+  if (bucket < SubBuckets) {
+    return bucket;
+  }
+  uint msb = bucket / SubBuckets + SubBucketBits - 1;
+  uint64_t sub = bucket % SubBuckets;
+  return (SubBuckets + sub) << (msb - SubBucketBits);
+}
+
+void GCLatencyHistogram::record(uint64_t us) {
+  Atomic::inc(&_counts[bucket_for(us)]);
+  Atomic::inc(&_total_count);
+  Atomic::add(&_total_us, us);
+  uint64_t max = Atomic::load(&_max_us);
+  while (us > max) {
+    uint64_t witness = Atomic::cmpxchg(&_max_us, max, us);
+    if (witness == max) {
+      break;
+    }
+    max = witness;
+  }
+}
+
+void GCLatencyHistogram::reset() {
+  for (uint i = 0; i < NumBuckets; i++) {
+    Atomic::store(&_counts[i], (uint64_t)0);
+  }
+  Atomic::store(&_total_count, (uint64_t)0);
+  Atomic::store(&_total_us, (uint64_t)0);
+  Atomic::store(&_max_us, (uint64_t)0);
+}
+
+uint64_t GCLatencyHistogram::percentile(double p) const {
+  uint64_t total = total_count();
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t target = MAX2((uint64_t)1, (uint64_t)(total * p / 100.0 + 0.5));
+  uint64_t seen = 0;
+  for (uint i = 0; i < NumBuckets - 1; i++) {
+    seen += count(i);
+    if (seen >= target) {
+      // Report the top of the bucket, but never more than the observed max
+      return MIN2(bucket_lower_bound(i + 1) - 1, max_us());
+    }
+  }
+  return max_us();
+}
+
+GCTelemetry::Entry GCTelemetry::_entries[GCTelemetry::MaxPhases];
+volatile uint GCTelemetry::_dropped = 0;
+
+GCTelemetry::Entry* GCTelemetry::find_or_add(const char* name, GCPhase::PhaseType type) {
+  char* copy = nullptr;
+  for (uint i = 0; i < MaxPhases; i++) {
+    Entry* e = &_entries[i];
+    const char* entry_name = Atomic::load_acquire(&e->_name);
+    if (entry_name == nullptr) {
+      if (copy == nullptr) {
+        copy = os::strdup(name, mtGC);
+        if (copy == nullptr) {
+          return nullptr;
+        }
+      }
+      entry_name = Atomic::cmpxchg(&e->_name, (const char*)nullptr, (const char*)copy);
+      if (entry_name == nullptr) {
+        // Only used for printing, a briefly stale type is harmless
+        e->_type = type;
+        return e;
+      }
+      // Lost the race for this slot, check what was installed instead
+    }
+    if (strcmp(entry_name, name) == 0) {
+      os::free(copy);
+      return e;
+    }
+  }
+  os::free(copy);
+  return nullptr;
+}
+
+void GCTelemetry::record(const char* name, GCPhase::PhaseType type, uint64_t us) {
+  Entry* e = find_or_add(name, type);
+  if (e == nullptr) {
+    Atomic::inc(&_dropped);
+    return;
+  }
+  e->_histogram.record(us);
+}
+
+void GCTelemetry::report(TimePartitions* time_partitions) {
+  TimePartitionPhasesIterator iter(time_partitions);
+  while (iter.has_next()) {
+    GCPhase* phase = iter.next();
+    if (phase->level() <= MaxLevel) {
+      record(phase->name(), phase->type(), (phase->end() - phase->start()).microseconds());
+    }
+  }
+}
+
+void GCTelemetry::reset() {
+  // Keep the registered names, concurrent recorders may still be using them.
+  for (uint i = 0; i < MaxPhases; i++) {
+    _entries[i]._histogram.reset();
+  }
+  Atomic::store(&_dropped, 0u);
+}
+
+static double us_to_ms(uint64_t us) {
+  return (double)us / MILLIUNITS;
+}
+
+static uint64_t us_to_ns(uint64_t us) {
+  return us * (NANOUNITS / MICROUNITS);
+}
+
+void GCTelemetry::print_on(outputStream* st, bool print_histograms) {
+  st->print_cr("%-48s %-10s %8s %9s %9s %9s %9s %9s %9s",
+               "Phase", "Type", "Count", "Avg(ms)", "p50(ms)", "p90(ms)", "p99(ms)", "p99.9(ms)", "Max(ms)");
+  for (uint i = 0; i < MaxPhases; i++) {
+    const Entry* e = &_entries[i];
+    const char* name = Atomic::load_acquire(&e->_name);
+    if (name == nullptr) {
+      break;
+    }
+    const GCLatencyHistogram* h = &e->_histogram;
+    uint64_t count = h->total_count();
+    if (count == 0) {
+      continue;
+    }
+    st->print_cr("%-48s %-10s " UINT64_FORMAT_W(8) " %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f",
+                 name,
+                 e->_type == GCPhase::PausePhaseType ? "pause" : "concurrent",
+                 count,
+                 us_to_ms(h->total_us()) / count,
+                 us_to_ms(h->percentile(50.0)),
+                 us_to_ms(h->percentile(90.0)),
+                 us_to_ms(h->percentile(99.0)),
+                 us_to_ms(h->percentile(99.9)),
+                 us_to_ms(h->max_us()));
+    if (print_histograms) {
+      for (uint b = 0; b < GCLatencyHistogram::NumBuckets; b++) {
+        uint64_t n = h->count(b);
+        if (n != 0) {
+          st->print_cr("  [" UINT64_FORMAT ", " UINT64_FORMAT ") us: " UINT64_FORMAT,
+                       GCLatencyHistogram::bucket_lower_bound(b),
+                       b + 1 < GCLatencyHistogram::NumBuckets ? GCLatencyHistogram::bucket_lower_bound(b + 1) : h->max_us() + 1,
+                       n);
+        }
+      }
+    }
+  }
+  uint dropped = Atomic::load(&_dropped);
+  if (dropped > 0) {
+    st->print_cr("%u phase samples dropped, registry full", dropped);
+  }
+}
+
+void GCTelemetry::send_events() {
+  for (uint i = 0; i < MaxPhases; i++) {
+    const Entry* e = &_entries[i];
+    const char* name = Atomic::load_acquire(&e->_name);
+    if (name == nullptr) {
+      break;
+    }
+    const GCLatencyHistogram* h = &e->_histogram;
+    uint64_t count = h->total_count();
+    if (count == 0) {
+      continue;
+    }
+    EventGCPhaseLatency event;
+    event.set_name(name);
+    event.set_concurrent(e->_type == GCPhase::ConcurrentPhaseType);
+    event.set_count(count);
+    event.set_average(us_to_ns(h->total_us()) / count);
+    event.set_p50(us_to_ns(h->percentile(50.0)));
+    event.set_p90(us_to_ns(h->percentile(90.0)));
+    event.set_p99(us_to_ns(h->percentile(99.0)));
+    event.set_p999(us_to_ns(h->percentile(99.9)));
+    event.set_max(us_to_ns(h->max_us()));
+    event.commit();
+  }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_GCTELEMETRY_HPP
+#define SHARE_GC_SHARED_GCTELEMETRY_HPP
+
+#include "gc/shared/gcTimer.hpp"
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// Log-linear latency histogram in microseconds. Each power of two is split
+// into four sub-buckets, giving a relative error below 25% over the whole
+// range. Recording is lock-free and readers see a racy but consistent
+// enough snapshot for reporting. Static instances start out zeroed, others
+// need a reset() before use.
+class GCLatencyHistogram {
+public:
+  static const uint SubBucketBits = 2;
+  static const uint SubBuckets = 1 << SubBucketBits;
+  // Values below SubBuckets map to themselves, then one group per power of two.
+  static const uint NumBuckets = (64 - SubBucketBits + 1) * SubBuckets;
+
+private:
+  volatile uint64_t _counts[NumBuckets];
+  volatile uint64_t _total_count;
+  volatile uint64_t _total_us;
+  volatile uint64_t _max_us;
+
+public:
+  static uint bucket_for(uint64_t us);
+  // Smallest value that falls into the given bucket.
+  static uint64_t bucket_lower_bound(uint bucket);
+
+  void record(uint64_t us);
+  void reset();
+
+  uint64_t count(uint bucket) const { return _counts[bucket]; }
+  uint64_t total_count() const { return _total_count; }
+  uint64_t total_us() const { return _total_us; }
+  uint64_t max_us() const { return _max_us; }
+
+  // Upper estimate for the given percentile, in microseconds.
+  uint64_t percentile(double p) const;
+};
+
+// Registry of pause and concurrent phase latency histograms shared by all
+// collectors. It is fed from GCTracer::report_gc_end with the top-level
+// phases and their direct sub-phases, printed by the GC.telemetry
+// diagnostic command and sent as periodic GCPhaseLatency JFR events.
+class GCTelemetry : AllStatic {
+  static const uint MaxPhases = 128;
+  static const int  MaxLevel = 1;
+
+  struct Entry {
+    const char* volatile _name;
+    GCPhase::PhaseType _type;
+    GCLatencyHistogram _histogram;
+  };
+
+  static Entry _entries[MaxPhases];
+  static volatile uint _dropped;
+
+  static Entry* find_or_add(const char* name, GCPhase::PhaseType type);
+
+public:
+  static void record(const char* name, GCPhase::PhaseType type, uint64_t us);
+  static void report(TimePartitions* time_partitions);
+
+  static void reset();
+  static void print_on(outputStream* st, bool print_histograms);
+  // Send one GCPhaseLatency event per recorded phase.
+  static void send_events();
+};
+
+#endif // SHARE_GC_SHARED_GCTELEMETRY_HPP
@@ -26,6 +26,7 @@
 #include "gc/shared/copyFailedInfo.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gcTelemetry.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
@@ -60,6 +61,7 @@ void GCTracer::report_gc_end_impl(const Ticks& timestamp, TimePartitions* time_p
 }
 
 void GCTracer::report_gc_end(const Ticks& timestamp, TimePartitions* time_partitions) {
+  GCTelemetry::report(time_partitions);
   report_gc_end_impl(timestamp, time_partitions);
 }
 
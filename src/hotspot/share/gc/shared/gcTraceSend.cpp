@@ -246,6 +246,9 @@ class GCHeapSummaryEventSender : public GCHeapSummaryVisitor {
       e.set_survivorUsedSize(g1_heap_summary->survivorUsed());
       e.set_oldGenUsedSize(g1_heap_summary->oldGenUsed());
       e.set_numberOfRegions(g1_heap_summary->numberOfRegions());
+      e.set_humongousUsedSize(g1_heap_summary->humongousUsed());
+      e.set_humongousWastedSize(g1_heap_summary->humongousWasted());
+      e.set_numberOfHumongousRegions(g1_heap_summary->numberOfHumongousRegions());
       e.commit();
     }
   }
@@ -189,6 +189,11 @@
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
                                                                             \
+  product(size_t, NonTemporalArrayZeroingThreshold, 0, EXPERIMENTAL,        \
+          "Arrays of at least this many bytes are zeroed with "             \
+          "non-temporal stores, if supported by the platform. "             \
+          "0 disables non-temporal zeroing")                                \
+                                                                            \
   product(bool, AlwaysPreTouchStacks, false, DIAGNOSTIC,                    \
           "Force java thread stacks to be fully pre-touched")               \
                                                                             \
@@ -265,6 +270,12 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uint, WorkStealingBatchSize, 1, EXPERIMENTAL,                     \
+          "Maximum number of tasks moved from the victim queue by a "       \
+          "successful steal; at most half of the remaining tasks are "      \
+          "taken. 1 disables batched stealing")                             \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
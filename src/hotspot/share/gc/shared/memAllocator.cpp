@@ -27,6 +27,7 @@
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/allocTracer.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/memAllocator.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
@@ -38,6 +39,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "services/lowMemoryDetector.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -357,12 +359,16 @@ oop MemAllocator::allocate() const {
   return obj;
 }
 
-void MemAllocator::mem_clear(HeapWord* mem) const {
+void MemAllocator::mem_clear(HeapWord* mem, bool nontemporal) const {
   assert(mem != nullptr, "cannot initialize null object");
   const size_t hs = oopDesc::header_size();
   assert(_word_size >= hs, "unexpected object size");
   oopDesc::set_klass_gap(mem, 0);
-  Copy::fill_to_aligned_words(mem + hs, _word_size - hs);
+  if (nontemporal) {
+    StubRoutines::ZeroWordsNonTemporal_stub()(mem + hs, _word_size - hs);
+  } else {
+    Copy::fill_to_aligned_words(mem + hs, _word_size - hs);
+  }
 }
 
 oop MemAllocator::finish(HeapWord* mem) const {
@@ -381,13 +387,19 @@ oop ObjAllocator::initialize(HeapWord* mem) const {
   return finish(mem);
 }
 
+bool ObjArrayAllocator::use_nontemporal_clearing() const {
+  return (NonTemporalArrayZeroingThreshold != 0) &&
+         (_word_size >= NonTemporalArrayZeroingThreshold / HeapWordSize) &&
+         (StubRoutines::zero_words_nontemporal() != nullptr);
+}
+
 oop ObjArrayAllocator::initialize(HeapWord* mem) const {
   // Set array length before setting the _klass field because a
   // non-null klass field indicates that the object is parsable by
   // concurrent GC.
   assert(_length >= 0, "length should be non-negative");
   if (_do_zero) {
-    mem_clear(mem);
+    mem_clear(mem, use_nontemporal_clearing());
     mem_zap_start_padding(mem);
     mem_zap_end_padding(mem);
   }
@@ -64,8 +64,9 @@ class MemAllocator: StackObj {
   // Initialization provided by subclasses.
   virtual oop initialize(HeapWord* mem) const = 0;
 
-  // This function clears the memory of the object.
-  void mem_clear(HeapWord* mem) const;
+  // This function clears the memory of the object.  If nontemporal is true
+  // the memory is cleared with non-temporal stores, bypassing the caches.
+  void mem_clear(HeapWord* mem, bool nontemporal = false) const;
 
   // This finish constructing an oop by installing the mark word and the Klass* pointer
   // last. At the point when the Klass pointer is initialized, this is a constructed object
@@ -97,6 +98,10 @@ class ObjArrayAllocator: public MemAllocator {
   void mem_zap_start_padding(HeapWord* mem) const PRODUCT_RETURN;
   void mem_zap_end_padding(HeapWord* mem) const PRODUCT_RETURN;
 
+  // Returns true if the array is large enough to be cleared with
+  // non-temporal stores, so that zeroing it does not evict the caches.
+  bool use_nontemporal_clearing() const;
+
 public:
   ObjArrayAllocator(Klass* klass, size_t word_size, int length, bool do_zero,
                     Thread* thread = Thread::current())
@@ -811,6 +811,28 @@ void OopStorage::release(const oop* const* ptrs, size_t size) {
   }
 }
 
+oop* OopStorageAllocationCache::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    _count = storage->allocate(_entries, Capacity);
+    if (_count == 0) {
+      return nullptr;
+    }
+    // Only count entries as they are handed out.
+    Atomic::sub(&storage->_allocation_count, _count);
+  }
+  Atomic::inc(&storage->_allocation_count);
+  return _entries[--_count];
+}
+
+void OopStorageAllocationCache::flush(OopStorage* storage) {
+  if (_count > 0) {
+    // Releasing uncounts the entries, so count them first.
+    Atomic::add(&storage->_allocation_count, _count);
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
 OopStorage* OopStorage::create(const char* name, MemTag mem_tag) {
   return new (mem_tag) OopStorage(name, mem_tag);
 }
@@ -257,6 +257,8 @@ class OopStorage : public CHeapObjBase {
   };
 
 private:
+  friend class OopStorageAllocationCache;
+
   const char* _name;
   ActiveArray* _active_array;
   AllocationList _allocation_list;
@@ -265,7 +267,8 @@ class OopStorage : public CHeapObjBase {
   Mutex* _active_mutex;
   NumDeadCallback _num_dead_callback;
 
-  // Volatile for racy unlocked accesses.
+  // Volatile for racy unlocked accesses.  Entries held by an
+  // OopStorageAllocationCache are not counted until handed out.
   volatile size_t _allocation_count;
 
   // Protection for _active_array.
@@ -323,4 +326,33 @@ class OopStorage : public CHeapObjBase {
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
 };
 
+// A small cache of entries obtained from an OopStorage by bulk allocation,
+// so that a thread taking many entries locks the storage's allocation mutex
+// only once per refill. Cached entries are allocated (and null) in the
+// storage until handed out or returned by flush(), but are not included in
+// its allocation_count(). A cache is used by a single thread, and always
+// with the same storage.
+class OopStorageAllocationCache {
+  static const size_t Capacity = 8;
+
+  oop* _entries[Capacity];
+  size_t _count;
+
+  NONCOPYABLE(OopStorageAllocationCache);
+
+public:
+  OopStorageAllocationCache() : _entries(), _count(0) {}
+  ~OopStorageAllocationCache() { assert(_count == 0, "not flushed"); }
+
+  size_t count() const { return _count; }
+
+  // Returns a new entry of storage, refilling the cache if it is empty.
+  // Returns null if memory allocation failed.
+  // postcondition: result == nullptr or *result == nullptr.
+  oop* allocate(OopStorage* storage);
+
+  // Releases the cached entries back to storage.
+  void flush(OopStorage* storage);
+};
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_HPP
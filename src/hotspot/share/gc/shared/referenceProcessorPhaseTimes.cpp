@@ -154,7 +154,7 @@ RefProcTotalPhaseTimesTracker::~RefProcTotalPhaseTimesTracker() {
 }
 
 ReferenceProcessorPhaseTimes::ReferenceProcessorPhaseTimes(GCTimer* gc_timer, uint max_gc_threads) :
-  _processing_is_mt(false), _gc_timer(gc_timer) {
+  _processing_is_mt(false), _phantom_refs_folded(false), _gc_timer(gc_timer) {
   assert(gc_timer != nullptr, "pre-condition");
   for (uint i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
     _sub_phases_worker_time_sec[i] = new WorkerDataArray<double>(nullptr, SubPhasesParWorkTitle[i], max_gc_threads);
@@ -204,6 +204,7 @@ void ReferenceProcessorPhaseTimes::reset() {
   _total_time_ms = uninitialized();
 
   _processing_is_mt = false;
+  _phantom_refs_folded = false;
 }
 
 ReferenceProcessorPhaseTimes::~ReferenceProcessorPhaseTimes() {
@@ -312,6 +313,9 @@ void ReferenceProcessorPhaseTimes::print_phase(ReferenceProcessor::RefProcPhases
         print_sub_phase(&ls, ReferenceProcessor::ProcessSoftRefSubPhase, indent + 1);
         print_sub_phase(&ls, ReferenceProcessor::ProcessWeakRefSubPhase, indent + 1);
         print_sub_phase(&ls, ReferenceProcessor::ProcessFinalRefSubPhase, indent + 1);
+        if (_phantom_refs_folded) {
+          print_sub_phase(&ls, ReferenceProcessor::ProcessPhantomRefsSubPhase, indent + 1);
+        }
         break;
       case ReferenceProcessor::KeepAliveFinalRefsPhase:
         print_sub_phase(&ls, ReferenceProcessor::KeepAliveFinalRefsSubPhase, indent + 1);
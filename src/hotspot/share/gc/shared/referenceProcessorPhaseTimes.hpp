@@ -57,6 +57,9 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
 
   bool                     _processing_is_mt;
 
+  // Phantom references were processed as part of SoftWeakFinalRefsPhase.
+  bool                     _phantom_refs_folded;
+
   GCTimer*                 _gc_timer;
 
   double phase_time_ms(ReferenceProcessor::RefProcPhases phase) const;
@@ -91,6 +94,8 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
 
   void set_processing_is_mt(bool processing_is_mt) { _processing_is_mt = processing_is_mt; }
 
+  void set_phantom_refs_folded(bool folded) { _phantom_refs_folded = folded; }
+
   GCTimer* gc_timer() const { return _gc_timer; }
 
   // Reset all fields. If not reset at next cycle, an assertion will fail.
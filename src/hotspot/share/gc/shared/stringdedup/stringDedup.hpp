@@ -40,8 +40,8 @@
 // added to the set of deduplication requests for later processing.
 //
 // The second part, processing the deduplication requests, is a concurrent
-// phase.  This phase is executed by the deduplication thread, which takes
-// candidates from the set of requests and tries to deduplicate them.
+// phase.  This phase is executed by the deduplication threads, which take
+// candidates from the set of requests and try to deduplicate them.
 //
 // A deduplication table is used to keep track of unique byte arrays used by
 // String objects.  When deduplicating, a lookup is made in this table to
@@ -56,7 +56,7 @@
 // One is used for requests, the other is being processed.  When processing
 // completes, the roles of the storage objects are exchanged.  The GC adds
 // entries referring to discovered candidates, allocating new OopStorage
-// entries for the requests.  The deduplication processing thread does a
+// entries for the requests.  The deduplication processing threads do a
 // concurrent iteration over the processing storage, deduplicating the
 // Strings and releasing the OopStorage entries.  Two storage objects are
 // used so there isn't any conflict between adding and removing entries by
@@ -93,7 +93,7 @@
 // but before weak reference processing, the GC should flush or delete all
 // of its Requests objects.
 //
-// The deduplication thread is a daemon JavaThread.  No thread visitor is
+// The deduplication threads are daemon JavaThreads.  No thread visitor is
 // needed, as it is handled via the normal JavaThread visiting mechanism.
 // Similarly, there is no need for a stop() function.
 //
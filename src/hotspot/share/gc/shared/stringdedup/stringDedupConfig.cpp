@@ -40,11 +40,16 @@ double StringDedup::Config::_load_factor_target;
 size_t StringDedup::Config::_minimum_dead_for_cleanup;
 double StringDedup::Config::_dead_factor_for_cleanup;
 uint64_t StringDedup::Config::_hash_seed;
+uint StringDedup::Config::_number_of_threads;
 
 size_t StringDedup::Config::initial_table_size() {
   return _initial_table_size;
 }
 
+uint StringDedup::Config::number_of_threads() {
+  return _number_of_threads;
+}
+
 int StringDedup::Config::age_threshold() {
   return _age_threshold;
 }
@@ -78,6 +83,10 @@ const size_t StringDedup::Config::good_sizes[] = {
 const size_t StringDedup::Config::min_good_size = good_sizes[0];
 const size_t StringDedup::Config::max_good_size = good_sizes[ARRAY_SIZE(good_sizes) - 1];
 
+size_t StringDedup::Config::max_table_size() {
+  return max_good_size;
+}
+
 size_t StringDedup::Config::good_size(size_t n) {
   size_t result = good_sizes[ARRAY_SIZE(good_sizes) - 1];
   for (size_t i = 0; i < ARRAY_SIZE(good_sizes); ++i) {
@@ -163,4 +172,5 @@ void StringDedup::Config::initialize() {
   _minimum_dead_for_cleanup = StringDeduplicationCleanupDeadMinimum;
   _dead_factor_for_cleanup = StringDeduplicationCleanupDeadPercent / 100.0;
   _hash_seed = initial_hash_seed();
+  _number_of_threads = StringDeduplicationThreads;
 }
@@ -41,6 +41,7 @@ class StringDedup::Config : AllStatic {
   static size_t _minimum_dead_for_cleanup;
   static double _dead_factor_for_cleanup;
   static uint64_t _hash_seed;
+  static uint _number_of_threads;
 
   static const size_t good_sizes[];
   static const size_t min_good_size;
@@ -55,6 +56,8 @@ class StringDedup::Config : AllStatic {
   static void initialize();
 
   static size_t initial_table_size();
+  static size_t max_table_size();
+  static uint number_of_threads();
   static int age_threshold();
   static uint64_t hash_seed();
 
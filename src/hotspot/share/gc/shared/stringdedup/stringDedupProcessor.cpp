@@ -29,6 +29,7 @@
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/stringdedup/stringDedupConfig.hpp"
 #include "gc/shared/stringdedup/stringDedupProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "gc/shared/stringdedup/stringDedupStorageUse.hpp"
@@ -61,7 +62,20 @@ void StringDedup::Processor::initialize_storage() {
   _storage_for_processing = new StorageUse(_storages[1]);
 }
 
-StringDedup::Processor::Processor() : _thread(nullptr) {}
+StringDedup::Processor::Processor() :
+  _thread(nullptr),
+  _number_of_threads(Config::number_of_threads()),
+  _threads(NEW_C_HEAP_ARRAY(JavaThread*, _number_of_threads, mtStringDedup)),
+  _worker_stats(NEW_C_HEAP_ARRAY(Stat, _number_of_threads, mtStringDedup)),
+  _round(nullptr),
+  _round_number(0),
+  _active_helpers(0)
+{
+  for (uint i = 0; i < _number_of_threads; ++i) {
+    _threads[i] = nullptr;
+    ::new (&_worker_stats[i]) Stat();
+  }
+}
 
 void StringDedup::Processor::initialize() {
   _processor = new Processor();
@@ -104,11 +118,11 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 }
 
 void StringDedup::Processor::yield() const {
-  assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  ThreadBlockInVM tbivm(JavaThread::current());
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
+  assert(Thread::current() == _thread, "precondition");
   if (Table::cleanup_start_if_needed(grow_only, force)) {
     do {
       yield();
@@ -119,6 +133,8 @@ void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
 
 class StringDedup::Processor::ProcessRequest final : public OopClosure {
   OopStorage* _storage;
+  Stat* _stat;
+  bool _may_grow_table;
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
@@ -133,8 +149,10 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 
 public:
-  ProcessRequest(OopStorage* storage) :
+  ProcessRequest(OopStorage* storage, Stat* stat, bool may_grow_table) :
     _storage(storage),
+    _stat(stat),
+    _may_grow_table(may_grow_table),
     _release_index(0),
     _bulk_release()
   {}
@@ -152,32 +170,125 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
     // Dedup java_string, after checking for various reasons to skip it.
     if (java_string == nullptr) {
       // String became unreachable before we got a chance to process it.
-      _cur_stat.inc_skipped_dead();
+      _stat->inc_skipped_dead();
     } else if (java_lang_String::value(java_string) == nullptr) {
       // Request during String construction, before its value array has
       // been initialized.
-      _cur_stat.inc_skipped_incomplete();
+      _stat->inc_skipped_incomplete();
     } else {
-      Table::deduplicate(java_string);
-      if (Table::is_grow_needed()) {
-        _cur_stat.report_process_pause();
+      Table::deduplicate(java_string, _stat);
+      if (_may_grow_table && Table::is_grow_needed()) {
+        _stat->report_process_pause();
         _processor->cleanup_table(true /* grow_only */, false /* force */);
-        _cur_stat.report_process_resume();
+        _stat->report_process_resume();
       }
     }
   }
 };
 
-void StringDedup::Processor::process_requests() const {
+// A processing round is a parallel iteration over the processing storage,
+// shared by all deduplication threads.
+class StringDedup::Processor::Round : public StackObj {
+  OopStorage* _storage;
+  OopStorage::ParState<true, false> _par_state;
+
+public:
+  Round(OopStorage* storage, uint number_of_threads) :
+    _storage(storage),
+    _par_state(storage, number_of_threads)
+  {}
+
+  void process(Stat* stat, bool may_grow_table) {
+    ProcessRequest processor{_storage, stat, may_grow_table};
+    _par_state.oops_do(&processor);
+  }
+};
+
+void StringDedup::Processor::start_round(Round* round) {
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  assert(_active_helpers == 0, "previous round not finished");
+  _round = round;
+  _round_number++;
+  _active_helpers = _number_of_threads - 1;
+  ml.notify_all();
+}
+
+void StringDedup::Processor::wait_for_helpers() {
+  ThreadBlockInVM tbivm(_thread);
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  while (_active_helpers > 0) {
+    ml.wait();
+  }
+  _round = nullptr;
+}
+
+StringDedup::Processor::Round*
+StringDedup::Processor::wait_for_round(uint* last_round_number) {
+  ThreadBlockInVM tbivm(JavaThread::current());
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  while (_round_number == *last_round_number) {
+    ml.wait();
+  }
+  *last_round_number = _round_number;
+  return _round;
+}
+
+void StringDedup::Processor::end_round() {
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  assert(_active_helpers > 0, "invariant");
+  if (--_active_helpers == 0) {
+    ml.notify_all();
+  }
+}
+
+void StringDedup::Processor::collect_worker_stats() {
+  _cur_stat.log_throughput(0);
+  for (uint i = 1; i < _number_of_threads; ++i) {
+    _worker_stats[i].log_throughput(i);
+    _cur_stat.add_counters(&_worker_stats[i]);
+    _worker_stats[i] = Stat{};
+  }
+}
+
+void StringDedup::Processor::process_requests() {
   _cur_stat.report_process_start();
-  OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
-  ProcessRequest processor{_storage_for_processing->storage()};
-  par_state.oops_do(&processor);
+  Round round{_storage_for_processing->storage(), _number_of_threads};
+  start_round(&round);
+  round.process(&_cur_stat, true /* may_grow_table */);
+  wait_for_helpers();
   _cur_stat.report_process_end();
+  collect_worker_stats();
 }
 
-void StringDedup::Processor::run(JavaThread* thread) {
+void StringDedup::Processor::update_cpu_time_counter() const {
+  if (UsePerfData && os::is_thread_cpu_time_supported()) {
+    ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::conc_dedup);
+    for (uint i = 0; i < _number_of_threads; ++i) {
+      JavaThread* thread = Atomic::load_acquire(&_threads[i]);
+      if (thread != nullptr) {
+        tttc.do_thread(thread);
+      }
+    }
+  }
+}
+
+void StringDedup::Processor::run(JavaThread* thread, uint worker_id) {
   assert(thread == Thread::current(), "precondition");
+  assert(worker_id < _number_of_threads, "invalid worker id %u", worker_id);
+  Atomic::release_store(&_threads[worker_id], thread);
+  if (worker_id > 0) {
+    // Helper thread, joining the rounds started by the main thread.
+    log_debug(stringdedup)("Starting string deduplication helper thread %u", worker_id);
+    Stat* stat = &_worker_stats[worker_id];
+    uint last_round_number = 0;
+    while (true) {
+      Round* round = wait_for_round(&last_round_number);
+      stat->report_process_start();
+      round->process(stat, false /* may_grow_table */);
+      stat->report_process_end();
+      end_round();
+    }
+  }
   _thread = thread;
   log_debug(stringdedup)("Starting string deduplication thread");
   while (true) {
@@ -189,10 +300,7 @@ void StringDedup::Processor::run(JavaThread* thread) {
     cleanup_table(false /* grow_only */, StringDeduplicationResizeALot /* force */);
     _cur_stat.report_active_end();
     log_statistics();
-    if (UsePerfData && os::is_thread_cpu_time_supported()) {
-      ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::conc_dedup);
-      tttc.do_thread(thread);
-    }
+    update_cpu_time_counter();
   }
 }
 
@@ -37,6 +37,14 @@ class OopStorage;
 // deduplication table, performing resize and cleanup operations as needed.
 // This includes managing the OopStorage objects used to hold requests.
 //
+// Requests are processed by one or more deduplication threads.  The main
+// thread (worker 0) waits for requests, swaps the request storages, and
+// then starts a processing round.  Any helper threads join the round and
+// drain the processing storage in parallel with the main thread.  Only the
+// main thread resizes or cleans the table, while the helpers keep
+// deduplicating.  Each thread records its results in its own Stat, which
+// the main thread merges at the end of the round.
+//
 // Processing periodically checks for and yields at safepoints.  Processing of
 // requests is performed in incremental chunks.  The Table provides
 // incremental operations for resizing and for removing dead entries, so
@@ -52,6 +60,18 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   static StorageUse* _storage_for_processing;
 
   JavaThread* _thread;
+  const uint _number_of_threads;
+  // Deduplication threads by worker id, registered as they start.
+  JavaThread* volatile* _threads;
+  // Per-round statistics of the helper threads, by worker id.
+  Stat* _worker_stats;
+
+  class Round;
+  // The current processing round and the number of helpers that have not
+  // finished it.  Protected by StringDedup_lock.
+  Round* _round;
+  uint _round_number;
+  uint _active_helpers;
 
   // Wait until there are requests to be processed.  The storage for requests
   // and storage for processing are swapped; the former requests storage
@@ -63,9 +83,16 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   void yield() const;
 
   class ProcessRequest;
-  void process_requests() const;
+  void process_requests();
   void cleanup_table(bool grow_only, bool force) const;
 
+  void start_round(Round* round);
+  void wait_for_helpers();
+  Round* wait_for_round(uint* last_round_number);
+  void end_round();
+  void collect_worker_stats();
+
+  void update_cpu_time_counter() const;
   void log_statistics();
 
 public:
@@ -74,9 +101,10 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   static void initialize_storage();
   static StorageUse* storage_for_requests();
 
-  // Use thread as the deduplication thread.
+  // Use thread as the deduplication thread with the given worker id.
+  // Worker 0 is the main deduplication thread, others are helpers.
   // precondition: thread == Thread::current()
-  void run(JavaThread* thread);
+  void run(JavaThread* thread, uint worker_id);
 };
 
 #endif // SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
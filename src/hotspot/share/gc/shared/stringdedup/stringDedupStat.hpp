@@ -33,6 +33,7 @@
 //
 // Operation counters are updated when deduplicating a string.
 // Phase timing information is collected by the processing thread.
+// Each deduplication thread updates its own Stat object.
 class StringDedup::Stat {
 private:
   // Counters
@@ -148,7 +149,13 @@ class StringDedup::Stat {
   void report_active_end();
 
   void add(const Stat* const stat);
+  // Add only the operation counters of stat, not its phase times.  Used to
+  // merge the results of a deduplication helper thread.
+  void add_counters(const Stat* const stat);
   void log_statistics(bool total) const;
+  // Log the processing throughput of the deduplication thread with the
+  // given worker id.
+  void log_throughput(uint worker_id) const;
 
   static void log_summary(const Stat* last_stat, const Stat* total_stat);
 };
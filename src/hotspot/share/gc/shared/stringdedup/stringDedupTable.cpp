@@ -42,165 +42,88 @@
 #include "oops/oopsHierarchy.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "utilities/concurrentHashTableTasks.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
-#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 //////////////////////////////////////////////////////////////////////////////
-// StringDedup::Table::Bucket
+// StringDedup::Table::Entry
 //
-// A bucket is a pair of vectors, one containing hash codes, the other
-// containing values.  An "entry" is a corresponding pair of elements from
-// the vectors.  The size of the table is the size of either vector.
-//
-// The capacity of the vectors is explicitly controlled, based on the size.
-// Given N > 0 and 2^N <= size < 2^(N+1), then capacity <= 2^N + k * 2^(N-1)
-// for the smallest integer k in [0,2] such that size <= capacity.  That is,
-// use a power of 2 or the midpoint between consecutive powers of 2 that is
-// minimally at least size.  When adding an entry and the capacity has been
-// reached, capacity is increased to the next of those values.
-//
-// The main benefit of this representation is that it uses less space than a
-// more traditional linked-list of entry nodes representation.  Such a
-// representation requires 24 bytes per entry (64 bit platform) for the next
-// pointer (8 bytes), the value (8 bytes), and the hash code (4 bytes, but
-// padded to 8 because of alignment requirements).  The pair of vectors uses
-// 12 bytes per entry, but has overhead for excess capacity so that adding
-// an entry takes amortized constant time.  That excess capacity increases
-// the per entry storage requirement, but it's still better than the linked
-// list representation.
-//
-// The per-bucket cost of a pair of vectors is higher than having a bucket
-// be the head of a linked list of nodes.  We ameliorate this by allowing
-// buckets to be somewhat longer than is usually desired for a hashtable.
-// The lookup performance for string deduplication is not that critical, and
-// searching a vector of hash codes of moderate length should be pretty
-// fast.  By using a good hash function, having different values hash to the
-// same hash code should be uncommon, making the part of the search of a
-// bucket for a given hash code more effective.
-//
-// The reason to record the hash codes with the values is that comparisons
-// are expensive, and recomputing the hash code when resizing is also
-// expensive.  A closed hashing implementation with just the values would be
-// more space efficient.
+// An entry is a value together with its hash code.  The reason to record
+// the hash codes with the values is that comparisons are expensive, and
+// recomputing the hash code when resizing is also expensive.  By using a
+// good hash function, having different values hash to the same hash code
+// should be uncommon, so comparing hash codes first avoids most array
+// comparisons when searching a bucket.
 
-class StringDedup::Table::Bucket {
-  GrowableArrayCHeap<uint, mtStringDedup> _hashes;
-  GrowableArrayCHeap<TableValue, mtStringDedup> _values;
-
-  void expand_if_full();
+class StringDedup::Table::Entry {
+  TableValue _value;
+  uint _hash;
 
 public:
-  // precondition: reserve == 0 or is the result of needed_capacity.
-  explicit Bucket(int reserve = 0);
+  Entry() : _value(), _hash(0) {}
+  Entry(TableValue value, uint hash) : _value(value), _hash(hash) {}
 
-  ~Bucket() {
-    while (!_values.is_empty()) {
-      _values.pop().release(_table_storage);
-    }
-  }
+  TableValue value() const { return _value; }
+  uint hash() const { return _hash; }
 
-  static int needed_capacity(int size);
+  void release() { _value.release(_table_storage); }
+};
 
-  const GrowableArrayView<uint>& hashes() const { return _hashes; }
-  const GrowableArrayView<TableValue>& values() const { return _values; }
+//////////////////////////////////////////////////////////////////////////////
+// StringDedup::Table::TableConfig
 
-  bool is_empty() const { return _hashes.is_empty(); }
-  int length() const { return _hashes.length(); }
+class StringDedup::Table::TableConfig : AllStatic {
+public:
+  using Value = Entry;
 
-  void add(uint hash_code, TableValue value) {
-    expand_if_full();
-    _hashes.push(hash_code);
-    _values.push(value);
+  static uintx get_hash(Value const& value, bool* is_dead) {
+    *is_dead = false;
+    return value.hash();
   }
 
-  void delete_at(int index) {
-    _values.at(index).release(_table_storage);
-    _hashes.delete_at(index);
-    _values.delete_at(index);
+  static void* allocate_node(void* context, size_t size, Value const& value) {
+    Atomic::inc(&_number_of_entries);
+    return AllocateHeap(size, mtStringDedup);
   }
 
-  void pop_norelease() {
-    _hashes.pop();
-    _values.pop();
+  static void free_node(void* context, void* memory, Value& value) {
+    value.release();
+    FreeHeap(memory);
+    Atomic::dec(&_number_of_entries);
   }
-
-  void shrink();
-
-  TableValue find(typeArrayOop obj, uint hash_code) const;
-
-  void verify(size_t bucket_index, size_t bucket_count) const;
 };
 
-StringDedup::Table::Bucket::Bucket(int reserve) :
-  _hashes(reserve), _values(reserve)
-{
-  assert(reserve == needed_capacity(reserve),
-         "reserve %d not computed properly", reserve);
-}
+//////////////////////////////////////////////////////////////////////////////
+// StringDedup::Table::Lookup
 
-// Choose the least power of 2 or half way between two powers of 2,
-// such that number of entries <= target.
-int StringDedup::Table::Bucket::needed_capacity(int needed) {
-  if (needed == 0) return 0;
-  int high = round_up_power_of_2(needed);
-  int low = high - high/4;
-  return (needed <= low) ? low : high;
-}
+class StringDedup::Table::Lookup : public StackObj {
+  typeArrayOop _obj;
+  uint _hash;
 
-void StringDedup::Table::Bucket::expand_if_full() {
-  if (_hashes.is_full()) {
-    int needed = needed_capacity(_hashes.capacity() + 1);
-    _hashes.reserve(needed);
-    _values.reserve(needed);
-  }
-}
+public:
+  Lookup(typeArrayOop obj, uint hash) : _obj(obj), _hash(hash) {}
 
-void StringDedup::Table::Bucket::shrink() {
-  _hashes.shrink_to_fit();
-  _values.shrink_to_fit();
-}
+  uintx get_hash() const { return _hash; }
 
-StringDedup::Table::TableValue
-StringDedup::Table::Bucket::find(typeArrayOop obj, uint hash_code) const {
-  int index = 0;
-  for (uint cur_hash : _hashes) {
-    if (cur_hash == hash_code) {
-      typeArrayOop value = cast_from_oop<typeArrayOop>(_values.at(index).peek());
-      if ((value != nullptr) &&
-          java_lang_String::value_equals(obj, value)) {
-        return _values.at(index);
-      }
+  bool equals(Entry* entry) {
+    if (entry->hash() != _hash) {
+      return false;
     }
-    ++index;
+    typeArrayOop value = cast_from_oop<typeArrayOop>(entry->value().peek());
+    return (value != nullptr) && java_lang_String::value_equals(_obj, value);
   }
-  return TableValue();
-}
 
-void StringDedup::Table::Bucket::verify(size_t bucket_index,
-                                        size_t bucket_count) const {
-  int entry_count = _hashes.length();
-  guarantee(entry_count == _values.length(),
-            "hash/value length mismatch: %zu: %d, %d",
-            bucket_index, entry_count, _values.length());
-  for (uint hash_code : _hashes) {
-    size_t hash_index = hash_code % bucket_count;
-    guarantee(bucket_index == hash_index,
-              "entry in wrong bucket: %zu, %u", bucket_index, hash_code);
-  }
-  size_t index = 0;
-  for (TableValue tv : _values) {
-    guarantee(!tv.is_empty(), "entry missing value: %zu:%zu", bucket_index, index);
-    const oop* p = tv.ptr_raw();
-    OopStorage::EntryStatus status = _table_storage->allocation_status(p);
-    guarantee(OopStorage::ALLOCATED_ENTRY == status,
-              "bad value: %zu:%zu -> " PTR_FORMAT, bucket_index, index, p2i(p));
-    // Don't check object is oop_or_null; duplicates OopStorage verify.
-    ++index;
-  }
-}
+  // Dead entries are only removed by cleanup, so the dead count reported
+  // by the GC stays consistent with the number of entries in the table.
+  bool is_dead(Entry* entry) { return false; }
+};
 
 //////////////////////////////////////////////////////////////////////////////
 // Tracking dead entries
@@ -271,157 +194,139 @@ void StringDedup::Table::num_dead_callback(size_t num_dead) {
 
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table::CleanupState
+//
+// A cleanup first resizes the table to the target size, one doubling or
+// halving at a time, and then removes dead entries.  A grow-only cleanup,
+// done while helper threads are processing requests, skips the removal of
+// dead entries.  Growing and removing
+// dead entries are split into chunks of buckets, so the cleaning thread
+// can yield between steps.  The table stays usable for lookups and
+// insertions by other deduplication threads throughout.
 
 class StringDedup::Table::CleanupState : public CHeapObj<mtStringDedup> {
   NONCOPYABLE(CleanupState);
 
-protected:
-  CleanupState() = default;
+  enum class Phase { resize, remove_dead, done };
 
-public:
-  virtual ~CleanupState() = default;
-  virtual bool step() = 0;
-  virtual TableValue find(typeArrayOop obj, uint hash_code) const = 0;
-  virtual void report_end() const = 0;
-  virtual void verify() const = 0;
-};
-
-//////////////////////////////////////////////////////////////////////////////
-// StringDedup::Table::Resizer
+  const bool _is_resize;
+  const bool _remove_dead;
+  const size_t _target_size_log2;
+  Phase _phase;
+  bool _task_started;
+  TableHash::GrowTask _grow_task;
+  TableHash::BulkDeleteTask _delete_task;
 
-class StringDedup::Table::Resizer final : public CleanupState {
-  Bucket* _buckets;
-  size_t _number_of_buckets;
-  size_t _bucket_index;
-  size_t _shrink_index;
+  bool resize_step(JavaThread* thread);
+  bool remove_dead_step(JavaThread* thread);
 
 public:
-  Resizer(bool grow_only, Bucket* buckets, size_t number_of_buckets) :
-    _buckets(buckets),
-    _number_of_buckets(number_of_buckets),
-    _bucket_index(0),
-    // Disable bucket shrinking if grow_only requested.
-    _shrink_index(grow_only ? Table::_number_of_buckets : 0)
-  {
-    Table::_need_bucket_shrinking = !grow_only;
-  }
+  CleanupState(bool is_resize, bool remove_dead, size_t target_size_log2) :
+    _is_resize(is_resize),
+    _remove_dead(remove_dead),
+    _target_size_log2(target_size_log2),
+    _phase(is_resize ? Phase::resize : Phase::remove_dead),
+    _task_started(false),
+    _grow_task(_table),
+    _delete_task(_table)
+  {}
 
-  virtual ~Resizer() {
-    free_buckets(_buckets, _number_of_buckets);
+  ~CleanupState() {
+    assert(!_task_started, "cleanup task still in progress");
   }
 
-  virtual bool step();
-
-  virtual TableValue find(typeArrayOop obj, uint hash_code) const {
-    return _buckets[hash_code % _number_of_buckets].find(obj, hash_code);
-  }
+  bool step();
 
-  virtual void report_end() const {
-    _cur_stat.report_resize_table_end();
+  void report_end() const {
+    if (_is_resize) {
+      _cur_stat.report_resize_table_end();
+    } else {
+      _cur_stat.report_cleanup_table_end();
+    }
   }
-
-  virtual void verify() const;
 };
 
-bool StringDedup::Table::Resizer::step() {
-  if (_bucket_index < _number_of_buckets) {
-    Bucket& bucket = _buckets[_bucket_index];
-    if (bucket.is_empty()) {
-      bucket.shrink();          // Eagerly release old bucket memory.
-      ++_bucket_index;
-      return true;              // Continue transferring with next bucket.
-    } else {
-      uint hash_code = bucket.hashes().last();
-      TableValue tv = bucket.values().last();
-      bucket.pop_norelease();
-      if (tv.peek() != nullptr) {
-        Table::add(tv, hash_code);
-      } else {
-        tv.release(_table_storage);
-        _cur_stat.inc_deleted();
+bool StringDedup::Table::CleanupState::resize_step(JavaThread* thread) {
+  if (!_task_started) {
+    size_t size_log2 = _table->get_size_log2(thread);
+    if (size_log2 > _target_size_log2) {
+      // Shrinking is not incremental, but halves the table in one go.
+      if (_table->shrink(thread, _target_size_log2)) {
+        return true;            // Continue with the next halving.
       }
-      return true;              // Continue transferring current bucket.
+    } else if ((size_log2 < _target_size_log2) && _grow_task.prepare(thread)) {
+      _task_started = true;
+      _grow_task.pause(thread);
+      return true;              // Continue with the first chunk.
     }
-  } else if (_shrink_index < Table::_number_of_buckets) {
-    // When the new buckets were created, space was reserved based on the
-    // expected number of entries per bucket.  But that might be off for any
-    // given bucket.  Some will have exceeded that and have been grown as
-    // needed by the insertions.  But some might be less and can be shrunk.
-    Table::_buckets[_shrink_index++].shrink();
-    return true;                // Continue shrinking with next bucket.
-  } else {
-    return false;               // All buckets transferred and shrunk, so done.
+    _phase = _remove_dead ? Phase::remove_dead : Phase::done;
+    return true;                // Resized as far as possible.
   }
-}
-
-void StringDedup::Table::Resizer::verify() const {
-  for (size_t i = 0; i < _number_of_buckets; ++i) {
-    _buckets[i].verify(i, _number_of_buckets);
+  _grow_task.cont(thread);
+  if (_grow_task.do_task(thread)) {
+    _grow_task.pause(thread);
+    return true;                // Continue with the next chunk.
   }
+  _grow_task.done(thread);
+  _task_started = false;
+  _number_of_buckets = size_t(1) << _table->get_size_log2(thread);
+  return true;                  // Continue with the next doubling.
 }
 
-//////////////////////////////////////////////////////////////////////////////
-// StringDedup::Table::Cleaner
-
-class StringDedup::Table::Cleaner final : public CleanupState {
-  size_t _bucket_index;
-  int _entry_index;
-
-public:
-  Cleaner() : _bucket_index(0), _entry_index(0) {
-    Table::_need_bucket_shrinking = false;
-  }
-
-  virtual ~Cleaner() = default;
-
-  virtual bool step();
+bool StringDedup::Table::CleanupState::remove_dead_step(JavaThread* thread) {
+  struct IsDead : StackObj {
+    bool operator()(Entry* entry) {
+      return entry->value().peek() == nullptr;
+    }
+  } is_dead;
+  struct CountDeleted : StackObj {
+    void operator()(Entry* entry) {
+      _cur_stat.inc_deleted();
+    }
+  } count_deleted;
 
-  virtual TableValue find(typeArrayOop obj, uint hash_code) const {
-    return TableValue();
+  if (!_task_started) {
+    if (!_delete_task.prepare(thread)) {
+      _phase = Phase::done;
+      return false;
+    }
+    _task_started = true;
+  } else {
+    _delete_task.cont(thread);
   }
-
-  virtual void report_end() const {
-    _cur_stat.report_cleanup_table_end();
+  if (_delete_task.do_task(thread, is_dead, count_deleted)) {
+    _delete_task.pause(thread);
+    return true;                // Continue with the next chunk.
   }
+  _delete_task.done(thread);
+  _task_started = false;
+  _phase = Phase::done;
+  return false;
+}
 
-  virtual void verify() const {} // Nothing to do here.
-};
-
-bool StringDedup::Table::Cleaner::step() {
-  if (_bucket_index == Table::_number_of_buckets) {
-    return false;               // All buckets processed, so done.
-  }
-  Bucket& bucket = Table::_buckets[_bucket_index];
-  const GrowableArrayView<TableValue>& values = bucket.values();
-  assert(_entry_index <= values.length(), "invariant");
-  if (_entry_index == values.length()) {
-    // End of current bucket.  Shrink the bucket if oversized for current
-    // usage, and continue at the start of the next bucket.
-    bucket.shrink();
-    ++_bucket_index;
-    _entry_index = 0;
-  } else if (values.at(_entry_index).peek() == nullptr) {
-    // Current entry is dead.  Remove and continue at same index.
-    bucket.delete_at(_entry_index);
-    --Table::_number_of_entries;
-    _cur_stat.inc_deleted();
-  } else {
-    // Current entry is live.  Continue with the next entry.
-    ++_entry_index;
+bool StringDedup::Table::CleanupState::step() {
+  JavaThread* thread = JavaThread::current();
+  switch (_phase) {
+  case Phase::resize:
+    return resize_step(thread);
+  case Phase::remove_dead:
+    return remove_dead_step(thread);
+  case Phase::done:
+    return false;
   }
-  return true;
+  ShouldNotReachHere();
+  return false;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table
 
 OopStorage* StringDedup::Table::_table_storage;
-StringDedup::Table::Bucket* StringDedup::Table::_buckets;
+StringDedup::Table::TableHash* StringDedup::Table::_table;
 size_t StringDedup::Table::_number_of_buckets;
-size_t StringDedup::Table::_number_of_entries = 0;
+size_t StringDedup::Table::_min_number_of_buckets;
 size_t StringDedup::Table::_grow_threshold;
 StringDedup::Table::CleanupState* StringDedup::Table::_cleanup_state = nullptr;
-bool StringDedup::Table::_need_bucket_shrinking = false;
+volatile size_t StringDedup::Table::_number_of_entries = 0;
 volatile size_t StringDedup::Table::_dead_count = 0;
 volatile StringDedup::Table::DeadState StringDedup::Table::_dead_state = DeadState::good;
 
@@ -430,29 +335,19 @@ void StringDedup::Table::initialize_storage() {
   _table_storage = OopStorageSet::create_weak("StringDedup Table Weak", mtStringDedup);
 }
 
-void StringDedup::Table::initialize() {
-  size_t num_buckets = Config::initial_table_size();
-  _buckets = make_buckets(num_buckets);
-  _number_of_buckets = num_buckets;
-  _grow_threshold = Config::grow_threshold(num_buckets);
-  _table_storage->register_num_dead_callback(num_dead_callback);
+size_t StringDedup::Table::table_size_log2(size_t number_of_buckets) {
+  return ceil_log2(number_of_buckets);
 }
 
-StringDedup::Table::Bucket*
-StringDedup::Table::make_buckets(size_t number_of_buckets, size_t reserve) {
-  Bucket* buckets = NEW_C_HEAP_ARRAY(Bucket, number_of_buckets, mtStringDedup);
-  for (size_t i = 0; i < number_of_buckets; ++i) {
-    // Cast because GrowableArray uses int for sizes and such.
-    ::new (&buckets[i]) Bucket(static_cast<int>(reserve));
-  }
-  return buckets;
-}
-
-void StringDedup::Table::free_buckets(Bucket* buckets, size_t number_of_buckets) {
-  while (number_of_buckets > 0) {
-    buckets[--number_of_buckets].~Bucket();
-  }
-  FREE_C_HEAP_ARRAY(Bucket, buckets);
+void StringDedup::Table::initialize() {
+  size_t size_log2 = table_size_log2(Config::initial_table_size());
+  size_t max_size_log2 = MAX2(size_log2, table_size_log2(Config::max_table_size()));
+  _table = new TableHash(size_log2, max_size_log2, TableHash::DEFAULT_GROW_HINT,
+                         false /* enable_statistics */, Mutex::nosafepoint - 2);
+  _number_of_buckets = size_t(1) << size_log2;
+  _min_number_of_buckets = _number_of_buckets;
+  _grow_threshold = Config::grow_threshold(_number_of_buckets);
+  _table_storage->register_num_dead_callback(num_dead_callback);
 }
 
 // Compute the hash code for obj using halfsiphash_32.  As this is a high
@@ -466,15 +361,6 @@ uint StringDedup::Table::compute_hash(typeArrayOop obj) {
   return AltHashing::halfsiphash_32(hash_seed, data, length);
 }
 
-size_t StringDedup::Table::hash_to_index(uint hash_code) {
-  return hash_code % _number_of_buckets;
-}
-
-void StringDedup::Table::add(TableValue tv, uint hash_code) {
-  _buckets[hash_to_index(hash_code)].add(hash_code, tv);
-  ++_number_of_entries;
-}
-
 bool StringDedup::Table::is_dead_count_good_acquire() {
   return Atomic::load_acquire(&_dead_state) == DeadState::good;
 }
@@ -482,28 +368,13 @@ bool StringDedup::Table::is_dead_count_good_acquire() {
 // Should be consistent with cleanup_start_if_needed.
 bool StringDedup::Table::is_grow_needed() {
   return is_dead_count_good_acquire() &&
-         ((_number_of_entries - Atomic::load(&_dead_count)) > _grow_threshold);
+         ((Atomic::load(&_number_of_entries) - Atomic::load(&_dead_count)) > _grow_threshold);
 }
 
 // Should be consistent with cleanup_start_if_needed.
 bool StringDedup::Table::is_dead_entry_removal_needed() {
   return is_dead_count_good_acquire() &&
-         Config::should_cleanup_table(_number_of_entries, Atomic::load(&_dead_count));
-}
-
-StringDedup::Table::TableValue
-StringDedup::Table::find(typeArrayOop obj, uint hash_code) {
-  assert(obj != nullptr, "precondition");
-  if (_cleanup_state != nullptr) {
-    TableValue tv = _cleanup_state->find(obj, hash_code);
-    if (!tv.is_empty()) return tv;
-  }
-  return _buckets[hash_to_index(hash_code)].find(obj, hash_code);
-}
-
-void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
-  add(TableValue(_table_storage, obj), hash_code);
-  _cur_stat.inc_new(obj->size() * HeapWordSize);
+         Config::should_cleanup_table(Atomic::load(&_number_of_entries), Atomic::load(&_dead_count));
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -514,7 +385,7 @@ void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
 // of the string we're deduplicating.  GC requests can provide us with
 // access to a String that is incompletely constructed; the value could be
 // set before the coder.
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   typeArrayOop value = java_lang_String::value(java_string);
   assert(value != nullptr, "precondition");
   assert(TypeArrayKlass::cast(value->klass())->element_type() == T_BYTE, "precondition");
@@ -534,7 +405,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
     // table key, so not actually a match to value.
     if ((found != nullptr) &&
         !java_lang_String::is_latin1(found) &&
-        try_deduplicate_found_shared(java_string, found)) {
+        try_deduplicate_found_shared(java_string, found, stat)) {
       return true;
     }
     // That didn't work.  Try as compact latin1.
@@ -547,7 +418,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   ResourceMark rm(Thread::current());
   jchar* chars = NEW_RESOURCE_ARRAY_RETURN_NULL(jchar, length);
   if (chars == nullptr) {
-    _cur_stat.inc_skipped_shared();
+    stat->inc_skipped_shared();
     return true;
   }
   for (int i = 0; i < length; ++i) {
@@ -556,11 +427,11 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   oop found = StringTable::lookup_shared(chars, length);
   if (found == nullptr) return false;
   assert(java_lang_String::is_latin1(found), "invariant");
-  return try_deduplicate_found_shared(java_string, found);
+  return try_deduplicate_found_shared(java_string, found, stat);
 }
 
-bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found) {
-  _cur_stat.inc_known_shared();
+bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat) {
+  stat->inc_known_shared();
   typeArrayOop found_value = java_lang_String::value(found);
   if (found_value == java_lang_String::value(java_string)) {
     // String's value already matches what's in the table.
@@ -571,7 +442,7 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
     // shared string.  But if they have different coders but happen to have
     // the same sequence of bytes in their value arrays, then java_string
     // could have been interned and marked deduplication-forbidden.
-    _cur_stat.inc_deduped(found_value->size() * HeapWordSize);
+    stat->inc_deduped(found_value->size() * HeapWordSize);
     return true;
   } else {
     // Must be a mismatch between java_string and found string encodings,
@@ -585,13 +456,13 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
 
 #else // if !INCLUDE_CDS_JAVA_HEAP
 
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   ShouldNotReachHere();         // Call is guarded.
   return false;
 }
 
 // Undefined because unreferenced.
-// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found);
+// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
 
 #endif // INCLUDE_CDS_JAVA_HEAP
 
@@ -607,38 +478,63 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
-void StringDedup::Table::deduplicate(oop java_string) {
-  assert(java_lang_String::is_instance(java_string), "precondition");
-  _cur_stat.inc_inspected();
-  if ((StringTable::shared_entry_count() > 0) &&
-      try_deduplicate_shared(java_string)) {
-    return;                     // Done if deduplicated against shared StringTable.
-  }
-  typeArrayOop value = java_lang_String::value(java_string);
-  uint hash_code = compute_hash(value);
-  TableValue tv = find(value, hash_code);
-  if (tv.is_empty()) {
-    // Not in table.  Create a new table entry.
-    install(value, hash_code);
-  } else {
-    _cur_stat.inc_known();
+
+// Deduplicates against the value of a found entry.  This is called from
+// within the table's get operation, so the entry's weak handle can't be
+// released by a concurrent cleanup while it is being used.
+class StringDedup::Table::Deduplicator : public StackObj {
+  oop _java_string;
+  typeArrayOop _value;
+  Stat* _stat;
+
+public:
+  Deduplicator(oop java_string, typeArrayOop value, Stat* stat) :
+    _java_string(java_string), _value(value), _stat(stat) {}
+
+  void operator()(Entry* entry) {
+    _stat->inc_known();
+    TableValue tv = entry->value();
     typeArrayOop found = cast_from_oop<typeArrayOop>(tv.resolve());
     assert(found != nullptr, "invariant");
     // Deduplicate if value array differs from what's in the table.
-    if (found != value) {
-      if (deduplicate_if_permitted(java_string, found)) {
-        _cur_stat.inc_deduped(found->size() * HeapWordSize);
+    if (found != _value) {
+      if (deduplicate_if_permitted(_java_string, found)) {
+        _stat->inc_deduped(found->size() * HeapWordSize);
       } else {
         // If string marked deduplication_forbidden then we can't update its
         // value.  Instead, replace the array in the table with the new one,
         // as java_string is probably in the StringTable.  That makes it a
         // good target for future deduplications as it is probably intended
         // to live for some time.
-        tv.replace(value);
-        _cur_stat.inc_replaced();
+        tv.replace(_value);
+        _stat->inc_replaced();
       }
     }
   }
+};
+
+void StringDedup::Table::deduplicate(oop java_string, Stat* stat) {
+  assert(java_lang_String::is_instance(java_string), "precondition");
+  stat->inc_inspected();
+  if ((StringTable::shared_entry_count() > 0) &&
+      try_deduplicate_shared(java_string, stat)) {
+    return;                     // Done if deduplicated against shared StringTable.
+  }
+  typeArrayOop value = java_lang_String::value(java_string);
+  uint hash_code = compute_hash(value);
+  Thread* thread = Thread::current();
+  Lookup lookup(value, hash_code);
+  Deduplicator deduplicator(java_string, value, stat);
+  while (!_table->get(thread, lookup, deduplicator)) {
+    // Not in table.  Create a new table entry.  The table takes ownership
+    // of the value even if another thread concurrently installed an
+    // equivalent array, in which case we retry the lookup.
+    Entry entry(TableValue(_table_storage, value), hash_code);
+    if (_table->insert(thread, lookup, entry)) {
+      stat->inc_new(value->size() * HeapWordSize);
+      return;
+    }
+  }
 }
 
 bool StringDedup::Table::cleanup_start_if_needed(bool grow_only, bool force) {
@@ -648,21 +544,22 @@ bool StringDedup::Table::cleanup_start_if_needed(bool grow_only, bool force) {
   // without needing any locking.  The recorded count could increase
   // after the read, but that's okay.
   size_t dead_count = Atomic::load(&_dead_count);
+  size_t number_of_entries = Atomic::load(&_number_of_entries);
   // This assertion depends on dead state tracking.  Otherwise, concurrent
   // reference processing could detect some, but a cleanup operation could
   // remove them before they are reported.
-  assert(dead_count <= _number_of_entries, "invariant");
-  size_t adjusted = _number_of_entries - dead_count;
+  assert(dead_count <= number_of_entries, "invariant");
+  size_t adjusted = number_of_entries - dead_count;
   if (force || Config::should_grow_table(_number_of_buckets, adjusted)) {
-    return start_resizer(grow_only, adjusted);
+    return start_resizer(adjusted, !grow_only /* remove_dead */);
   } else if (grow_only) {
     return false;
-  } else if (Config::should_shrink_table(_number_of_buckets, adjusted)) {
-    return start_resizer(false /* grow_only */, adjusted);
-  } else if (_need_bucket_shrinking ||
-             Config::should_cleanup_table(_number_of_entries, dead_count)) {
-    // Remove dead entries and shrink buckets if needed.
-    return start_cleaner(_number_of_entries, dead_count);
+  } else if ((_number_of_buckets > _min_number_of_buckets) &&
+             Config::should_shrink_table(_number_of_buckets, adjusted)) {
+    return start_resizer(adjusted, true /* remove_dead */);
+  } else if (Config::should_cleanup_table(number_of_entries, dead_count)) {
+    // Remove dead entries.
+    return start_cleaner(number_of_entries, dead_count);
   } else {
     // No cleanup needed.
     return false;
@@ -675,22 +572,18 @@ void StringDedup::Table::set_dead_state_cleaning() {
   Atomic::store(&_dead_state, DeadState::cleaning);
 }
 
-bool StringDedup::Table::start_resizer(bool grow_only, size_t number_of_entries) {
-  size_t new_size = Config::desired_table_size(number_of_entries);
-  _cur_stat.report_resize_table_start(new_size, _number_of_buckets, number_of_entries);
-  _cleanup_state = new Resizer(grow_only, _buckets, _number_of_buckets);
-  size_t reserve = Bucket::needed_capacity(checked_cast<int>(number_of_entries / new_size));
-  _buckets = make_buckets(new_size, reserve);
-  _number_of_buckets = new_size;
-  _number_of_entries = 0;
-  _grow_threshold = Config::grow_threshold(new_size);
+bool StringDedup::Table::start_resizer(size_t number_of_entries, bool remove_dead) {
+  size_t new_size_log2 = table_size_log2(Config::desired_table_size(number_of_entries));
+  _cur_stat.report_resize_table_start(size_t(1) << new_size_log2, _number_of_buckets, number_of_entries);
+  _cleanup_state = new CleanupState(true /* is_resize */, remove_dead, new_size_log2);
   set_dead_state_cleaning();
   return true;
 }
 
 bool StringDedup::Table::start_cleaner(size_t number_of_entries, size_t dead_count) {
   _cur_stat.report_cleanup_table_start(number_of_entries, dead_count);
-  _cleanup_state = new Cleaner();
+  _cleanup_state = new CleanupState(false /* is_resize */, true /* remove_dead */,
+                                    table_size_log2(_number_of_buckets));
   set_dead_state_cleaning();
   return true;
 }
@@ -705,22 +598,33 @@ void StringDedup::Table::cleanup_end() {
   _cleanup_state->report_end();
   delete _cleanup_state;
   _cleanup_state = nullptr;
+  _number_of_buckets = size_t(1) << _table->get_size_log2(Thread::current());
+  _grow_threshold = Config::grow_threshold(_number_of_buckets);
   MutexLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
   Atomic::store(&_dead_state, DeadState::wait2);
 }
 
 void StringDedup::Table::verify() {
-  size_t total_count = 0;
-  for (size_t i = 0; i < _number_of_buckets; ++i) {
-    _buckets[i].verify(i, _number_of_buckets);
-    total_count += _buckets[i].length();
-  }
-  guarantee(total_count == _number_of_entries,
+  struct VerifyEntry : StackObj {
+    size_t _count;
+    VerifyEntry() : _count(0) {}
+    bool operator()(Entry* entry) {
+      TableValue tv = entry->value();
+      guarantee(!tv.is_empty(), "entry missing value: %zu", _count);
+      const oop* p = tv.ptr_raw();
+      OopStorage::EntryStatus status = _table_storage->allocation_status(p);
+      guarantee(OopStorage::ALLOCATED_ENTRY == status,
+                "bad value: %zu -> " PTR_FORMAT, _count, p2i(p));
+      // Don't check object is oop_or_null; duplicates OopStorage verify.
+      ++_count;
+      return true;
+    }
+  } verifier;
+  _table->do_safepoint_scan(verifier);
+  size_t number_of_entries = Atomic::load(&_number_of_entries);
+  guarantee(verifier._count == number_of_entries,
             "number of values mismatch: %zu counted, %zu recorded",
-            total_count, _number_of_entries);
-  if (_cleanup_state != nullptr) {
-    _cleanup_state->verify();
-  }
+            verifier._count, number_of_entries);
 }
 
 void StringDedup::Table::log_statistics() {
@@ -732,23 +636,16 @@ void StringDedup::Table::log_statistics() {
     dead_state = static_cast<int>(_dead_state);
   }
   log_debug(stringdedup)("Table: %zu values in %zu buckets, %zu dead (%d)",
-                         _number_of_entries, _number_of_buckets,
+                         Atomic::load(&_number_of_entries), _number_of_buckets,
                          dead_count, dead_state);
   LogStreamHandle(Trace, stringdedup) log;
   if (log.is_enabled()) {
-    ResourceMark rm;
-    GrowableArray<size_t> counts;
-    for (size_t i = 0; i < _number_of_buckets; ++i) {
-      int length = _buckets[i].length();
-      size_t count = counts.at_grow(length);
-      counts.at_put(length, count + 1);
-    }
-    log.print_cr("Table bucket distribution:");
-    for (int i = 0; i < counts.length(); ++i) {
-      size_t count = counts.at(i);
-      if (count != 0) {
-        log.print_cr("  %4d: %zu", i, count);
+    struct ValueSize : StackObj {
+      size_t operator()(Entry* entry) {
+        oop value = entry->value().peek();
+        return (value == nullptr) ? 0 : value->size() * HeapWordSize;
       }
-    }
+    } value_size;
+    _table->statistics_to(Thread::current(), value_size, &log, "StringDedup Table");
   }
 }
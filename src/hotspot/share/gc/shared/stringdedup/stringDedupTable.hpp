@@ -30,6 +30,7 @@
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "oops/typeArrayOop.hpp"
 #include "oops/weakHandle.hpp"
+#include "utilities/concurrentHashTable.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 
@@ -38,22 +39,21 @@ class OopStorage;
 // Provides deduplication.  This class keeps track of all the unique byte
 // arrays used by deduplicated String objects.
 //
-// The arrays are in a hashtable, hashed using the bytes in the array.  The
-// references to the arrays by the hashtable are weak, allowing arrays that
-// become unreachable to be collected and their entries pruned from the
-// table.  The hashtable is dynamically resized to accommodate the current
-// number of hashtable entries.  There are several command line options
-// controlling the growth or shrinkage of the hashtable.
+// The arrays are in a ConcurrentHashTable, hashed using the bytes in the
+// array.  The references to the arrays by the hashtable are weak, allowing
+// arrays that become unreachable to be collected and their entries pruned
+// from the table.  The hashtable is dynamically resized to accommodate the
+// current number of hashtable entries.  There are several command line
+// options controlling the growth or shrinkage of the hashtable.
 //
-// Operations on the table are not thread-safe.  Only the deduplication
-// thread calls most of the operations on the table.  The only exception is
-// the GC dead object count notification and the management of its state.
-//
-// The table supports resizing and removal of entries for byte arrays that
-// have become unreferenced.  These operations are performed by the
-// deduplication thread, in a series of small incremental steps.  This
-// prevents these potentially long running operations from long blockage of
-// safepoints or concurrent deduplication requests from the StringTable.
+// Lookups and insertions are thread-safe, so several deduplication threads
+// may deduplicate strings concurrently.  Resizing and removal of dead
+// entries are only performed by the main deduplication thread, one cleanup
+// at a time.  Dead entries are only removed between processing rounds, when
+// the helper threads are idle.  These operations are performed concurrently
+// with lookups and insertions, in a series of small incremental steps.  This prevents these
+// potentially long running operations from long blockage of safepoints or
+// concurrent deduplication requests from the StringTable.
 //
 // As a space optimization, when shared StringTable entries exist the shared
 // part of the StringTable is also used as a source for byte arrays.  This
@@ -61,10 +61,11 @@ class OopStorage;
 // recording them in this table too.
 class StringDedup::Table : AllStatic {
 private:
-  class Bucket;
+  class Entry;
+  class TableConfig;
+  class Lookup;
+  class Deduplicator;
   class CleanupState;
-  class Resizer;
-  class Cleaner;
   enum class DeadState;
 
   // Values in the table are weak references to jbyte[] Java objects.  The
@@ -76,32 +77,32 @@ class StringDedup::Table : AllStatic {
   // can provide the deduplication thread with access to a String that is
   // incompletely constructed; the value could be set before the coder.
   using TableValue = WeakHandle;
+  using TableHash = ConcurrentHashTable<TableConfig, mtStringDedup>;
 
   // Weak storage for the string data in the table.
   static OopStorage* _table_storage;
-  static Bucket* _buckets;
+  static TableHash* _table;
+  // Only updated by the thread performing cleanup.
   static size_t _number_of_buckets;
-  static size_t _number_of_entries;
+  // The table never shrinks below its initial size.
+  static size_t _min_number_of_buckets;
   static size_t _grow_threshold;
   static CleanupState* _cleanup_state;
-  static bool _need_bucket_shrinking;
+  // Updated by node allocation and release, which may be on any
+  // deduplication thread.
+  static volatile size_t _number_of_entries;
   // These are always written while holding StringDedup_lock, but may be
-  // read by the dedup thread without holding the lock lock.
+  // read by the dedup threads without holding the lock lock.
   static volatile size_t _dead_count;
   static volatile DeadState _dead_state;
 
   static uint compute_hash(typeArrayOop obj);
-  static size_t hash_to_index(uint hash_code);
-  static void add(TableValue tv, uint hash_code);
-  static TableValue find(typeArrayOop obj, uint hash_code);
-  static void install(typeArrayOop obj, uint hash_code);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
-  static bool try_deduplicate_shared(oop java_string);
-  static bool try_deduplicate_found_shared(oop java_string, oop found);
-  static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
-  static void free_buckets(Bucket* buckets, size_t number_of_buckets);
+  static bool try_deduplicate_shared(oop java_string, Stat* stat);
+  static bool try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
 
-  static bool start_resizer(bool grow_only, size_t number_of_entries);
+  static size_t table_size_log2(size_t number_of_buckets);
+  static bool start_resizer(size_t number_of_entries, bool remove_dead);
   static bool start_cleaner(size_t number_of_entries, size_t dead_count);
 
   static void num_dead_callback(size_t num_dead);
@@ -114,8 +115,9 @@ class StringDedup::Table : AllStatic {
 
   // Deduplicate java_string.  If the table already contains the string's
   // data array, replace the string's data array with the one in the table.
-  // Otherwise, add the string's data array to the table.
-  static void deduplicate(oop java_string);
+  // Otherwise, add the string's data array to the table.  The outcome is
+  // recorded in stat, which must be private to the calling thread.
+  static void deduplicate(oop java_string, Stat* stat);
 
   // Returns true if table needs to grow.
   static bool is_grow_needed();
@@ -124,7 +126,9 @@ class StringDedup::Table : AllStatic {
   static bool is_dead_entry_removal_needed();
 
   // If cleanup (resizing or removing dead entries) is needed or force
-  // is true, setup cleanup state and return true.  If result is true,
+  // is true, setup cleanup state and return true.  If grow_only is true,
+  // only growing is considered, and dead entries are not removed, as other
+  // deduplication threads may be using the table.  If result is true,
   // the caller must eventually call cleanup_end.
   // precondition: no cleanup is in progress.
   static bool cleanup_start_if_needed(bool grow_only, bool force);
@@ -24,26 +24,37 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/stringdedup/stringDedupConfig.hpp"
 #include "gc/shared/stringdedup/stringDedupProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedupThread.hpp"
 #include "runtime/handles.hpp"
 #include "runtime/os.hpp"
 #include "utilities/exceptions.hpp"
 
-StringDedupThread::StringDedupThread() : JavaThread(thread_entry) {}
+StringDedupThread::StringDedupThread(uint worker_id) :
+  JavaThread(thread_entry), _worker_id(worker_id) {}
 
 void StringDedupThread::initialize() {
   EXCEPTION_MARK;
 
-  const char* name = "StringDedupThread";
-  Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
-  StringDedupThread* thread = new StringDedupThread();
-  JavaThread::vm_exit_on_osthread_failure(thread);
-  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  uint number_of_threads = StringDedup::Config::number_of_threads();
+  for (uint i = 0; i < number_of_threads; ++i) {
+    char name[64];
+    if (i == 0) {
+      os::snprintf_checked(name, sizeof(name), "StringDedupThread");
+    } else {
+      os::snprintf_checked(name, sizeof(name), "StringDedupThread#%u", i);
+    }
+    Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+    StringDedupThread* thread = new StringDedupThread(i);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
 }
 
 void StringDedupThread::thread_entry(JavaThread* thread, TRAPS) {
-  StringDedup::_processor->run(thread);
+  uint worker_id = static_cast<StringDedupThread*>(thread)->_worker_id;
+  StringDedup::_processor->run(thread, worker_id);
 }
 
 bool StringDedupThread::is_hidden_from_external_view() const {
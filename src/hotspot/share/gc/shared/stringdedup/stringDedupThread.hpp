@@ -30,9 +30,9 @@
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
 
-// Thread class for string deduplication.  There is only one instance of this
-// class.  This class provides thread management.  It uses the Processor
-// to perform most of the work.
+// Thread class for string deduplication.  There is one instance of this
+// class per StringDeduplicationThreads.  This class provides thread
+// management.  It uses the Processor to perform most of the work.
 //
 // Unlike most of the classes in the stringdedup implementation, this class is
 // not an inner class of StringDedup.  This is because we need a simple public
@@ -40,7 +40,9 @@
 class StringDedupThread : public JavaThread {
   friend class VMStructs;
 
-  StringDedupThread();
+  const uint _worker_id;
+
+  explicit StringDedupThread(uint worker_id);
   ~StringDedupThread() = default;
 
   NONCOPYABLE(StringDedupThread);
@@ -35,7 +35,7 @@
 #if TASKQUEUE_STATS
 const char * const TaskQueueStats::_names[last_stat_id] = {
   "push", "pop", "pop-slow",
-  "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop",
+  "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop", "st-batched",
   "ovflw-push", "ovflw-max"
 };
 
@@ -88,9 +88,9 @@ void TaskQueueStats::print(outputStream* stream, unsigned int width) const
 // quiescent; they do not hold at arbitrary times.
 void TaskQueueStats::verify() const
 {
-  assert(get(push) == get(pop) + get(steal_success),
-         "push=%zu pop=%zu steal=%zu",
-         get(push), get(pop), get(steal_success));
+  assert(get(push) == get(pop) + get(steal_success) + get(steal_batched),
+         "push=%zu pop=%zu steal=%zu batched=%zu",
+         get(push), get(pop), get(steal_success), get(steal_batched));
   assert(get(pop_slow) <= get(pop),
          "pop_slow=%zu pop=%zu",
          get(pop_slow), get(pop));
@@ -61,6 +61,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batched,    // number of additional tasks moved by batched steals
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +83,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batched() { ++_stats[steal_batched]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -480,10 +482,18 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   uint _n;
   T** _queues;
 
+  // Maximum number of tasks transferred by a successful steal.
+  uint _steal_batch_size;
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
-  // the result in t. Validity of this value and the return value is the same
-  // as for the last pop_global() operation.
-  PopResult steal_best_of_2(uint queue_num, E& t);
+  // the result in t and the queue stolen from in victim. Validity of these
+  // values and the return value is the same as for the last pop_global()
+  // operation.
+  PopResult steal_best_of_2(uint queue_num, E& t, uint& victim);
+
+  // After a successful steal from victim, move up to half of its remaining
+  // tasks, bounded by the batch size, to the queue queue_num.
+  void steal_batch(uint queue_num, uint victim);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -495,6 +505,16 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
 
   T* queue(uint n);
 
+  // Let a successful steal also move up to n - 1 further tasks from the victim
+  // to the stealing queue, so that the thief need not come back for each of
+  // them. Requires that stolen tasks may be pushed to the queue of the thief;
+  // steal() must only be called by the owner of queue_num. 1 (the default)
+  // disables batching.
+  void set_steal_batch_size(uint n) {
+    assert(n >= 1, "must be");
+    _steal_batch_size = n;
+  }
+
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
@@ -39,7 +39,7 @@
 #include "utilities/stack.inline.hpp"
 
 template <class T, MemTag MT>
-inline GenericTaskQueueSet<T, MT>::GenericTaskQueueSet(uint n) : _n(n) {
+inline GenericTaskQueueSet<T, MT>::GenericTaskQueueSet(uint n) : _n(n), _steal_batch_size(1) {
   typedef T* GenericTaskQueuePtr;
   _queues = NEW_C_HEAP_ARRAY(GenericTaskQueuePtr, n, MT);
   for (uint i = 0; i < n; i++) {
@@ -317,7 +317,7 @@ int GenericTaskQueue<E, MT, N>::next_random_queue_id() {
 }
 
 template<class T, MemTag MT>
-typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal_best_of_2(uint queue_num, E& t) {
+typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal_best_of_2(uint queue_num, E& t, uint& victim) {
   T* const local_queue = queue(queue_num);
   if (_n > 2) {
     uint k1 = queue_num;
@@ -354,6 +354,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      victim = sel_k;
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -364,6 +365,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     uint k = (queue_num + 1) % 2;
     PopResult res = queue(k)->pop_global(t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    victim = k;
     return res;
   } else {
     assert(_n == 1, "can't be zero.");
@@ -372,14 +374,38 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
   }
 }
 
+template<class T, MemTag MT>
+void GenericTaskQueueSet<T, MT>::steal_batch(uint queue_num, uint victim) {
+  T* const local_queue = queue(queue_num);
+  T* const victim_queue = queue(victim);
+  // Only the owner pushes to local_queue, so the free space can only grow
+  // while we are transferring.
+  uint const free = local_queue->max_elems() - local_queue->size();
+  uint const n = MIN3(victim_queue->size() / 2, _steal_batch_size - 1, free);
+  for (uint i = 0; i < n; i++) {
+    E t;
+    if (victim_queue->pop_global(t) != PopResult::Success) {
+      // Leave the remaining tasks to the owner and other thieves.
+      break;
+    }
+    bool pushed = local_queue->push(t);
+    assert(pushed, "must have space");
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_batched();)
+  }
+}
+
 template<class T, MemTag MT>
 bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    uint victim = queue_num;
+    PopResult sr = steal_best_of_2(queue_num, t, victim);
     if (sr == PopResult::Success) {
+      if (_steal_batch_size > 1) {
+        steal_batch(queue_num, victim);
+      }
       return true;
     } else if (sr == PopResult::Contended) {
       TASKQUEUE_STATS_ONLY(
@@ -27,6 +27,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -55,6 +56,7 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _refill_waste(0),
   _gc_waste(0),
   _slow_allocations(0),
+  _refill_resizes(0),
   _allocated_size(0),
   _allocation_fraction(TLABAllocationWeight) {
 
@@ -105,7 +107,8 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
-                                   _refill_waste);
+                                   _refill_waste,
+                                   _refill_resizes);
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
@@ -177,9 +180,31 @@ void ThreadLocalAllocBuffer::reset_statistics() {
   _refill_waste      = 0;
   _gc_waste          = 0;
   _slow_allocations  = 0;
+  _refill_resizes    = 0;
   _allocated_size    = 0;
 }
 
+void ThreadLocalAllocBuffer::resize_at_refill() {
+  assert(ResizeTLAB && ResizeTLABAtRefill, "Should not call this otherwise");
+  // The thread has used up more refills than expected for the whole GC
+  // interval. Size the TLAB as if everything allocated so far had been
+  // the prediction at the last GC. Half a TLAB wasted at the next GC is
+  // then still within TLABWasteTargetPercent of what the thread allocated.
+  size_t new_size = clamp(_allocated_size / _target_refills, min_size(), max_size());
+  size_t aligned_new_size = align_object_size(new_size);
+  if (aligned_new_size <= desired_size()) {
+    return;
+  }
+
+  log_trace(gc, tlab)("TLAB refill resize: thread: " PTR_FORMAT " [id: %2d]"
+                      " refills %d  allocated: " SIZE_FORMAT "B desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                      p2i(thread()), thread()->osthread()->thread_id(),
+                      _number_of_refills, _allocated_size * HeapWordSize, desired_size(), aligned_new_size);
+
+  set_desired_size(aligned_new_size);
+  _refill_resizes++;
+}
+
 void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   HeapWord* top,
                                   size_t    new_size) {
@@ -190,6 +215,10 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   initialize(start, top, start + new_size - alignment_reserve());
 
+  if (ResizeTLAB && ResizeTLABAtRefill && _number_of_refills > _target_refills) {
+    resize_at_refill();
+  }
+
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -353,6 +382,7 @@ PerfVariable* ThreadLocalAllocStats::_perf_total_refill_waste;
 PerfVariable* ThreadLocalAllocStats::_perf_max_refill_waste;
 PerfVariable* ThreadLocalAllocStats::_perf_total_slow_allocations;
 PerfVariable* ThreadLocalAllocStats::_perf_max_slow_allocations;
+PerfVariable* ThreadLocalAllocStats::_perf_total_refill_resizes;
 AdaptiveWeightedAverage ThreadLocalAllocStats::_allocating_threads_avg(0);
 
 static PerfVariable* create_perf_variable(const char* name, PerfData::Units unit, TRAPS) {
@@ -376,6 +406,7 @@ void ThreadLocalAllocStats::initialize() {
     _perf_max_refill_waste        = create_perf_variable("maxRefillWaste", PerfData::U_Bytes, CHECK);
     _perf_total_slow_allocations  = create_perf_variable("slowAlloc",      PerfData::U_None,  CHECK);
     _perf_max_slow_allocations    = create_perf_variable("maxSlowAlloc",   PerfData::U_None,  CHECK);
+    _perf_total_refill_resizes    = create_perf_variable("refillResizes",  PerfData::U_None,  CHECK);
   }
 }
 
@@ -389,7 +420,8 @@ ThreadLocalAllocStats::ThreadLocalAllocStats() :
     _total_refill_waste(0),
     _max_refill_waste(0),
     _total_slow_allocations(0),
-    _max_slow_allocations(0) {}
+    _max_slow_allocations(0),
+    _total_refill_resizes(0) {}
 
 unsigned int ThreadLocalAllocStats::allocating_threads_avg() {
   return MAX2((unsigned int)(_allocating_threads_avg.average() + 0.5), 1U);
@@ -398,7 +430,8 @@ unsigned int ThreadLocalAllocStats::allocating_threads_avg() {
 void ThreadLocalAllocStats::update_fast_allocations(unsigned int refills,
                                        size_t allocations,
                                        size_t gc_waste,
-                                       size_t refill_waste) {
+                                       size_t refill_waste,
+                                       unsigned int refill_resizes) {
   _allocating_threads      += 1;
   _total_refills           += refills;
   _max_refills              = MAX2(_max_refills, refills);
@@ -407,6 +440,7 @@ void ThreadLocalAllocStats::update_fast_allocations(unsigned int refills,
   _max_gc_waste             = MAX2(_max_gc_waste, gc_waste);
   _total_refill_waste      += refill_waste;
   _max_refill_waste         = MAX2(_max_refill_waste, refill_waste);
+  _total_refill_resizes    += refill_resizes;
 }
 
 void ThreadLocalAllocStats::update_slow_allocations(unsigned int allocations) {
@@ -425,6 +459,7 @@ void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
   _max_refill_waste         = MAX2(_max_refill_waste, other._max_refill_waste);
   _total_slow_allocations  += other._total_slow_allocations;
   _max_slow_allocations     = MAX2(_max_slow_allocations, other._max_slow_allocations);
+  _total_refill_resizes    += other._total_refill_resizes;
 }
 
 void ThreadLocalAllocStats::reset() {
@@ -438,6 +473,7 @@ void ThreadLocalAllocStats::reset() {
   _max_refill_waste        = 0;
   _total_slow_allocations  = 0;
   _max_slow_allocations    = 0;
+  _total_refill_resizes    = 0;
 }
 
 void ThreadLocalAllocStats::publish() {
@@ -452,11 +488,22 @@ void ThreadLocalAllocStats::publish() {
   log_debug(gc, tlab)("TLAB totals: thrds: %d  refills: %d max: %d"
                       " slow allocs: %d max %d waste: %4.1f%%"
                       " gc: " SIZE_FORMAT "B max: " SIZE_FORMAT "B"
-                      " slow: " SIZE_FORMAT "B max: " SIZE_FORMAT "B",
+                      " slow: " SIZE_FORMAT "B max: " SIZE_FORMAT "B"
+                      " refill resizes: %d",
                       _allocating_threads, _total_refills, _max_refills,
                       _total_slow_allocations, _max_slow_allocations, waste_percent,
                       _total_gc_waste * HeapWordSize, _max_gc_waste * HeapWordSize,
-                      _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize);
+                      _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize,
+                      _total_refill_resizes);
+
+  EventTLABStatistics::commit(_allocating_threads,
+                              _total_refills,
+                              _max_refills,
+                              _total_slow_allocations,
+                              _total_allocations * HeapWordSize,
+                              _total_gc_waste * HeapWordSize,
+                              _total_refill_waste * HeapWordSize,
+                              _total_refill_resizes);
 
   if (UsePerfData) {
     _perf_allocating_threads      ->set_value(_allocating_threads);
@@ -469,6 +516,7 @@ void ThreadLocalAllocStats::publish() {
     _perf_max_refill_waste        ->set_value(_max_refill_waste);
     _perf_total_slow_allocations  ->set_value(_total_slow_allocations);
     _perf_max_slow_allocations    ->set_value(_max_slow_allocations);
+    _perf_total_refill_resizes    ->set_value(_total_refill_resizes);
   }
 }
 
@@ -66,12 +66,17 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
   unsigned  _refill_waste;
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
+  unsigned  _refill_resizes;
   size_t    _allocated_size;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
   void reset_statistics();
 
+  // Grow the desired size if the thread allocates faster than predicted
+  // at the last GC.
+  void resize_at_refill();
+
   void set_start(HeapWord* start)                { _start = start; }
   void set_end(HeapWord* end)                    { _end = end; }
   void set_allocation_end(HeapWord* ptr)         { _allocation_end = ptr; }
@@ -199,6 +204,7 @@ class ThreadLocalAllocStats : public StackObj {
   static PerfVariable* _perf_max_refill_waste;
   static PerfVariable* _perf_total_slow_allocations;
   static PerfVariable* _perf_max_slow_allocations;
+  static PerfVariable* _perf_total_refill_resizes;
 
   static AdaptiveWeightedAverage _allocating_threads_avg;
 
@@ -212,6 +218,7 @@ class ThreadLocalAllocStats : public StackObj {
   size_t       _max_refill_waste;
   unsigned int _total_slow_allocations;
   unsigned int _max_slow_allocations;
+  unsigned int _total_refill_resizes;
 
 public:
   static void initialize();
@@ -222,7 +229,8 @@ class ThreadLocalAllocStats : public StackObj {
   void update_fast_allocations(unsigned int refills,
                                size_t allocations,
                                size_t gc_waste,
-                               size_t refill_waste);
+                               size_t refill_waste,
+                               unsigned int refill_resizes);
   void update_slow_allocations(unsigned int allocations);
   void update(const ThreadLocalAllocStats& other);
 
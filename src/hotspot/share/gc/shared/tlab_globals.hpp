@@ -42,6 +42,10 @@
   product(bool, ResizeTLAB, true,                                           \
           "Dynamically resize TLAB size for threads")                       \
                                                                             \
+  product(bool, ResizeTLABAtRefill, false, EXPERIMENTAL,                    \
+          "Grow the TLAB of a thread between GCs when the thread refills "  \
+          "more often than the expected number of refills per GC")          \
+                                                                            \
   product(bool, ZeroTLAB, false,                                            \
           "Zero out the newly created TLAB")                                \
                                                                             \
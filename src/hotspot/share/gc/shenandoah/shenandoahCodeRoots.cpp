@@ -173,6 +173,10 @@ class ShenandoahUnlinkTask : public WorkerTask {
     _iterator(ShenandoahCodeRoots::table()) {}
 
   virtual void work(uint worker_id) {
+    ShenandoahConcurrentWorkerSession worker_session(worker_id);
+    ShenandoahWorkerTimingsTracker timer(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots,
+                                         ShenandoahPhaseTimings::CodeCacheUnload,
+                                         worker_id);
     _iterator.nmethods_do(&_cl);
   }
 };
@@ -452,7 +452,12 @@ void ShenandoahConcurrentGC::entry_evacuate() {
                               "concurrent evacuation");
 
   heap->try_inject_alloc_failure();
+
+  // Record the time mutators and workers spent waiting for the heap lock, summed over all threads
+  const uint64_t lock_wait_start = heap->lock()->contended_wait_ns();
   op_evacuate();
+  const uint64_t lock_wait = heap->lock()->contended_wait_ns() - lock_wait_start;
+  heap->phase_timings()->record_phase_time(ShenandoahPhaseTimings::conc_evac_heap_lock, (double)lock_wait / NANOSECS_PER_SEC);
 }
 
 void ShenandoahConcurrentGC::entry_update_thread_roots() {
@@ -27,12 +27,14 @@
 #include "gc/shared/tlab_globals.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 
 static const char* partition_name(ShenandoahFreeSetPartitionId t) {
@@ -579,7 +581,8 @@ ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _partitions(max_regions, this),
   _trash_regions(NEW_C_HEAP_ARRAY(ShenandoahHeapRegion*, max_regions, mtGC)),
   _right_to_left_bias(false),
-  _alloc_bias_weight(0)
+  _alloc_bias_weight(0),
+  _gc_alloc_region(nullptr)
 {
   clear_internal();
 }
@@ -740,20 +743,35 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
       adjusted_size = free;
     }
     if (adjusted_size >= req.min_size()) {
-      result = r->allocate(adjusted_size, req.type());
-      log_debug(gc)("Allocated " SIZE_FORMAT " words (adjusted from " SIZE_FORMAT ") for %s @" PTR_FORMAT
-                          " from %s region " SIZE_FORMAT ", free bytes remaining: " SIZE_FORMAT,
-                          adjusted_size, req.size(), ShenandoahAllocRequest::alloc_type_to_string(req.type()), p2i(result),
-                          _partitions.partition_membership_name(r->index()), r->index(), r->free());
-      assert (result != nullptr, "Allocation must succeed: free " SIZE_FORMAT ", actual " SIZE_FORMAT, free, adjusted_size);
-      req.set_actual_size(adjusted_size);
+      if (req.is_gc_alloc() && ShenandoahLockFreeGCAlloc) {
+        // Other GC allocations may be bumping this region without the heap lock, and may
+        // have taken the remaining space since free was computed.
+        r->make_regular_allocation();
+        result = r->allocate_atomic(req.min_size(), adjusted_size, 0, req.type());
+      } else {
+        result = r->allocate(adjusted_size, req.type());
+        assert (result != nullptr, "Allocation must succeed: free " SIZE_FORMAT ", actual " SIZE_FORMAT, free, adjusted_size);
+      }
+      if (result != nullptr) {
+        log_debug(gc)("Allocated " SIZE_FORMAT " words (adjusted from " SIZE_FORMAT ") for %s @" PTR_FORMAT
+                            " from %s region " SIZE_FORMAT ", free bytes remaining: " SIZE_FORMAT,
+                            adjusted_size, req.size(), ShenandoahAllocRequest::alloc_type_to_string(req.type()), p2i(result),
+                            _partitions.partition_membership_name(r->index()), r->index(), r->free());
+        req.set_actual_size(adjusted_size);
+      }
     } else {
       log_trace(gc, free)("Failed to shrink TLAB or GCLAB request (" SIZE_FORMAT ") in region " SIZE_FORMAT " to " SIZE_FORMAT
                           " because min_size() is " SIZE_FORMAT, req.size(), r->index(), adjusted_size, req.min_size());
     }
   } else {
     size_t size = req.size();
-    result = r->allocate(size, req.type());
+    if (req.is_gc_alloc() && ShenandoahLockFreeGCAlloc) {
+      // Other GC allocations may be bumping this region without the heap lock
+      r->make_regular_allocation();
+      result = r->allocate_atomic(size, size, 0, req.type());
+    } else {
+      result = r->allocate(size, req.type());
+    }
     if (result != nullptr) {
       // Record actual allocation size
       log_debug(gc)("Allocated " SIZE_FORMAT " words for %s @" PTR_FORMAT
@@ -772,8 +790,9 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
       assert(req.is_gc_alloc(), "Should be gc_alloc since req wasn't mutator alloc");
 
       // For GC allocations, we advance update_watermark because the objects relocated into this memory during
-      // evacuation are not updated during evacuation.
-      r->set_update_watermark(r->top());
+      // evacuation are not updated during evacuation. Concurrent GC allocations in the same region may have
+      // advanced it further already, so it is only raised.
+      r->raise_update_watermark(r->top());
     }
   }
 
@@ -787,12 +806,51 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
     // Also, if this allocation request failed and the consumed within this region * ShenandoahEvacWaste > region size,
     // then retire the region so that subsequent searches can find available memory more quickly.
 
+    if (req.is_gc_alloc() && ShenandoahLockFreeGCAlloc) {
+      // GC allocations that loaded this region before it was unpublished may still bump it. Claim the rest
+      // of the region first, so that used() below stays accurate and the remnant is not counted twice.
+      clear_gc_alloc_region(r);
+      r->fill_remaining_atomic();
+    }
+
     size_t idx = r->index();
     _partitions.retire_from_partition(req.is_mutator_alloc()?
                                       ShenandoahFreeSetPartitionId::Mutator: ShenandoahFreeSetPartitionId::Collector,
                                       idx, r->used());
     _partitions.assert_bounds();
+  } else if ((result != nullptr) && req.is_gc_alloc() && ShenandoahLockFreeGCAlloc) {
+    // Let the following GC allocations bump this region without taking the heap lock
+    Atomic::release_store(&_gc_alloc_region, r);
+  }
+  return result;
+}
+
+void ShenandoahFreeSet::clear_gc_alloc_region(ShenandoahHeapRegion* r) {
+  shenandoah_assert_heaplocked_or_safepoint();
+  if ((r == nullptr) || (Atomic::load(&_gc_alloc_region) == r)) {
+    Atomic::store(&_gc_alloc_region, (ShenandoahHeapRegion*)nullptr);
   }
+}
+
+HeapWord* ShenandoahFreeSet::par_allocate_gc(ShenandoahAllocRequest& req) {
+  assert(req.is_gc_alloc(), "Only GC allocations: %s", ShenandoahAllocRequest::alloc_type_to_string(req.type()));
+  assert(!ShenandoahHeapRegion::requires_humongous(req.size()), "Not for humongous allocations");
+
+  ShenandoahHeapRegion* const r = Atomic::load_acquire(&_gc_alloc_region);
+  if (r == nullptr) {
+    return nullptr;
+  }
+
+  // Leave enough room that the region never falls below the retirement threshold without the heap lock,
+  // so only locked allocations retire regions and free regions keep some allocation capacity.
+  size_t size = req.size();
+  const size_t min_size = req.is_lab_alloc() ? req.min_size() : size;
+  HeapWord* const result = r->allocate_atomic(min_size, size, PLAB::min_size(), req.type());
+  if (result != nullptr) {
+    req.set_actual_size(size);
+    r->raise_update_watermark(result + size);
+  }
+
   return result;
 }
 
@@ -981,6 +1039,7 @@ void ShenandoahFreeSet::clear() {
 }
 
 void ShenandoahFreeSet::clear_internal() {
+  Atomic::store(&_gc_alloc_region, (ShenandoahHeapRegion*)nullptr);
   _partitions.make_all_regions_unavailable();
 }
 
@@ -1048,6 +1107,12 @@ void ShenandoahFreeSet::move_regions_from_collector_to_mutator(size_t max_xfer_r
   size_t collector_empty_xfer = 0;
   size_t collector_not_empty_xfer = 0;
 
+  if (max_xfer_regions > 0) {
+    // Evacuation is done, but the GC allocation region may be handed to the Mutator partition below
+    ShenandoahHeapLocker locker(_heap->lock());
+    clear_gc_alloc_region();
+  }
+
   // Process empty regions within the Collector free partition
   if ((max_xfer_regions > 0) &&
       (_partitions.leftmost_empty(ShenandoahFreeSetPartitionId::Collector)
@@ -272,6 +272,13 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
 
   const ssize_t _InitialAllocBiasWeight = 256;
 
+  // The Collector region most recently allocated from under the heap lock. GC allocations first try to bump
+  // allocate in it with CAS, see par_allocate_gc(). Only updated while holding the heap lock, and cleared
+  // whenever the region may stop being a Collector region.
+  ShenandoahHeapRegion* volatile _gc_alloc_region;
+
+  void clear_gc_alloc_region(ShenandoahHeapRegion* r = nullptr);
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
 
   // While holding the heap lock, allocate memory for a single object or LAB  which is to be entirely contained
@@ -355,6 +362,12 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   }
 
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Without holding the heap lock, try to satisfy a GCLAB or shared GC allocation from the current GC
+  // allocation region. Returns null if there is no such region or it is too full, in which case the
+  // caller falls back to allocate() under the heap lock.
+  HeapWord* par_allocate_gc(ShenandoahAllocRequest& req);
+
   size_t unsafe_peek_free() const;
 
   /*
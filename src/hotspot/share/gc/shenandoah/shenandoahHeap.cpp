@@ -968,7 +968,12 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
     }
   } else {
     assert(req.is_gc_alloc(), "Can only accept GC allocs here");
-    result = allocate_memory_under_lock(req, in_new_region);
+    if (ShenandoahLockFreeGCAlloc) {
+      result = _free_set->par_allocate_gc(req);
+    }
+    if (result == nullptr) {
+      result = allocate_memory_under_lock(req, in_new_region);
+    }
     // Do not call handle_alloc_failure() here, because we cannot block.
     // The allocation failure would be handled by the LRB slowpath with handle_alloc_failure_evac().
   }
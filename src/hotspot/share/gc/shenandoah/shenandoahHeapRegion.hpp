@@ -330,6 +330,17 @@ class ShenandoahHeapRegion {
   // Allocation (return null if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
+  // GC allocation that may race with other GC allocations in this region without
+  // holding the heap lock. The region must already be regular. The allocation
+  // leaves at least reserve_word_size words free. The word_size is shrunk to the
+  // available space if that is still at least min_word_size (return null otherwise).
+  inline HeapWord* allocate_atomic(size_t min_word_size, size_t& word_size, size_t reserve_word_size,
+                                   ShenandoahAllocRequest::Type type);
+
+  // Claim the rest of the region with a filler object, so that GC allocations racing
+  // without the heap lock can no longer allocate in it. Returns the filler size in words.
+  inline size_t fill_remaining_atomic();
+
   inline void clear_live_data();
   void set_live_data(size_t s);
 
@@ -379,6 +390,7 @@ class ShenandoahHeapRegion {
 
   inline HeapWord* get_update_watermark() const;
   inline void set_update_watermark(HeapWord* w);
+  inline void raise_update_watermark(HeapWord* w);
   inline void set_update_watermark_at_safepoint(HeapWord* w);
 
 private:
@@ -52,6 +52,63 @@ HeapWord* ShenandoahHeapRegion::allocate(size_t size, ShenandoahAllocRequest::Ty
   }
 }
 
+HeapWord* ShenandoahHeapRegion::allocate_atomic(size_t min_word_size, size_t& word_size, size_t reserve_word_size,
+                                                ShenandoahAllocRequest::Type type) {
+  assert(is_object_aligned(min_word_size), "alloc size breaks alignment: " SIZE_FORMAT, min_word_size);
+  assert(type == ShenandoahAllocRequest::_alloc_gclab || type == ShenandoahAllocRequest::_alloc_shared_gc,
+         "Only GC allocations: %s", ShenandoahAllocRequest::alloc_type_to_string(type));
+  assert(is_alloc_allowed() && !is_empty(), "Should be regular: %s", region_state_to_string(state()));
+
+  HeapWord* obj = Atomic::load(&_top);
+  for (;;) {
+    const size_t free = align_down(pointer_delta(end(), obj), MinObjAlignment);
+    if (free < reserve_word_size + min_word_size) {
+      return nullptr;
+    }
+    const size_t size = MIN2(word_size, align_down(free - reserve_word_size, MinObjAlignment));
+    if (size < min_word_size) {
+      return nullptr;
+    }
+
+    HeapWord* const new_top = obj + size;
+    HeapWord* const prev_top = Atomic::cmpxchg(&_top, obj, new_top);
+    if (prev_top == obj) {
+      if (type == ShenandoahAllocRequest::_alloc_gclab) {
+        Atomic::add(&_gclab_allocs, size);
+      }
+      word_size = size;
+
+      assert(is_object_aligned(new_top), "new top breaks alignment: " PTR_FORMAT, p2i(new_top));
+      assert(is_object_aligned(obj),     "obj is not aligned: "       PTR_FORMAT, p2i(obj));
+
+      return obj;
+    }
+
+    // Retry with the new top
+    obj = prev_top;
+  }
+}
+
+size_t ShenandoahHeapRegion::fill_remaining_atomic() {
+  HeapWord* obj = Atomic::load(&_top);
+  for (;;) {
+    const size_t free = pointer_delta(end(), obj);
+    if (free < CollectedHeap::min_fill_size()) {
+      // Too small for any allocation
+      return 0;
+    }
+
+    HeapWord* const prev_top = Atomic::cmpxchg(&_top, obj, end());
+    if (prev_top == obj) {
+      CollectedHeap::fill_with_object(obj, free);
+      return free;
+    }
+
+    // Retry with the new top
+    obj = prev_top;
+  }
+}
+
 inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t size) {
   switch (type) {
     case ShenandoahAllocRequest::_alloc_shared:
@@ -126,6 +183,19 @@ inline void ShenandoahHeapRegion::set_update_watermark(HeapWord* w) {
   Atomic::release_store(&_update_watermark, w);
 }
 
+// Only moves the watermark up, for concurrent GC allocations in the same region.
+inline void ShenandoahHeapRegion::raise_update_watermark(HeapWord* w) {
+  assert(bottom() <= w && w <= top(), "within bounds");
+  HeapWord* prev = Atomic::load_acquire(&_update_watermark);
+  while (prev < w) {
+    HeapWord* const res = Atomic::cmpxchg(&_update_watermark, prev, w);
+    if (res == prev) {
+      return;
+    }
+    prev = res;
+  }
+}
+
 // Fast version that avoids synchronization, only to be used at safepoints.
 inline void ShenandoahHeapRegion::set_update_watermark_at_safepoint(HeapWord* w) {
   assert(bottom() <= w && w <= top(), "within bounds");
@@ -33,12 +33,14 @@
 #include "runtime/os.inline.hpp"
 
 void ShenandoahLock::contended_lock(bool allow_block_for_safepoint) {
+  const jlong start = os::javaTimeNanos();
   Thread* thread = Thread::current();
   if (allow_block_for_safepoint && thread->is_Java_thread()) {
     contended_lock_internal<true>(JavaThread::cast(thread));
   } else {
     contended_lock_internal<false>(nullptr);
   }
+  Atomic::add(&_contended_wait_ns, (uint64_t)(os::javaTimeNanos() - start));
 }
 
 template<bool ALLOW_BLOCK>
@@ -27,6 +27,7 @@
 
 #include "gc/shenandoah/shenandoahPadding.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/safepoint.hpp"
 
@@ -39,11 +40,13 @@ class ShenandoahLock  {
   shenandoah_padding(1);
   Thread* volatile _owner;
   shenandoah_padding(2);
+  volatile uint64_t _contended_wait_ns;
+  shenandoah_padding(3);
 
   template<bool ALLOW_BLOCK>
   void contended_lock_internal(JavaThread* java_thread);
 public:
-  ShenandoahLock() : _state(unlocked), _owner(nullptr) {};
+  ShenandoahLock() : _state(unlocked), _owner(nullptr), _contended_wait_ns(0) {};
 
   void lock(bool allow_block_for_safepoint) {
     assert(Atomic::load(&_owner) != Thread::current(), "reentrant locking attempt, would deadlock");
@@ -70,6 +73,11 @@ class ShenandoahLock  {
 
   void contended_lock(bool allow_block_for_safepoint);
 
+  // Accumulated time all threads have spent in contended_lock()
+  uint64_t contended_wait_ns() const {
+    return Atomic::load(&_contended_wait_ns);
+  }
+
   bool owned_by_self() {
 #ifdef ASSERT
     return _state == locked && _owner == Thread::current();
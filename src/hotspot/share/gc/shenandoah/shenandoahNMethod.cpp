@@ -429,8 +429,16 @@ ShenandoahNMethodTableSnapshot::~ShenandoahNMethodTableSnapshot() {
   _list->release();
 }
 
+size_t ShenandoahNMethodTableSnapshot::claim_stride() const {
+  // Hand out several batches per worker, so that workers finishing early steal
+  // from the rest of the table instead of waiting for one worker's last large
+  // batch of expensive nmethods, while still amortizing the claims.
+  const size_t workers = MAX2(_heap->workers()->active_workers(), 1u);
+  return clamp((size_t)_limit / (workers * 8), (size_t)16, (size_t)256);
+}
+
 void ShenandoahNMethodTableSnapshot::parallel_nmethods_do(NMethodClosure *f) {
-  size_t stride = 256; // educated guess
+  const size_t stride = claim_stride();
 
   ShenandoahNMethod** const list = _list->list();
 
@@ -455,7 +463,7 @@ void ShenandoahNMethodTableSnapshot::parallel_nmethods_do(NMethodClosure *f) {
 }
 
 void ShenandoahNMethodTableSnapshot::concurrent_nmethods_do(NMethodClosure* cl) {
-  size_t stride = 256; // educated guess
+  const size_t stride = claim_stride();
 
   ShenandoahNMethod** list = _list->list();
   size_t max = (size_t)_limit;
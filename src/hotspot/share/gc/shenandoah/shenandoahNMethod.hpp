@@ -118,6 +118,8 @@ class ShenandoahNMethodTableSnapshot : public CHeapObj<mtGC> {
   volatile size_t       _claimed;
   shenandoah_padding(1);
 
+  size_t claim_stride() const;
+
 public:
   ShenandoahNMethodTableSnapshot(ShenandoahNMethodTable* table);
   ~ShenandoahNMethodTableSnapshot();
@@ -28,6 +28,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -183,6 +185,10 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_epoch_allocated, (size_t)0);
+  Atomic::store(&_epoch_allocators, (size_t)0);
+  Atomic::store(&_epoch_overdraft, (intptr_t)0);
+  Atomic::store(&_epoch_overdraft_limit, (intptr_t)(initial / FairShareOverdraftDivisor));
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -221,6 +227,46 @@ void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
 
   size_t tax = MAX2<size_t>(1, words * Atomic::load(&_tax_rate));
   add_budget(tax);
+
+  if (ShenandoahPacingFairShare) {
+    ShenandoahThreadLocalData::sub_pacing_allocated(Thread::current(), epoch, words);
+  }
+}
+
+size_t ShenandoahPacer::account_alloc(JavaThread* thread, size_t words) {
+  const intptr_t epoch = Atomic::load(&_epoch);
+  if (ShenandoahThreadLocalData::add_pacing_allocated(thread, epoch, words)) {
+    Atomic::inc(&_epoch_allocators, memory_order_relaxed);
+  }
+  Atomic::add(&_epoch_allocated, words, memory_order_relaxed);
+  return ShenandoahThreadLocalData::pacing_allocated(thread);
+}
+
+bool ShenandoahPacer::is_light_allocator(size_t thread_allocated) const {
+  const size_t allocators = Atomic::load(&_epoch_allocators);
+  if (allocators <= 1) {
+    // Nobody to shift the stall to
+    return false;
+  }
+
+  // A thread allocating less than half of the average share is
+  // not the one that depleted the budget.
+  const size_t average = Atomic::load(&_epoch_allocated) / allocators;
+  return thread_allocated <= average / 2;
+}
+
+bool ShenandoahPacer::claim_overdraft(size_t words) {
+  const intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+  const intptr_t limit = Atomic::load(&_epoch_overdraft_limit);
+  intptr_t cur = Atomic::load(&_epoch_overdraft);
+  while (cur + tax <= limit) {
+    const intptr_t prev = Atomic::cmpxchg(&_epoch_overdraft, cur, cur + tax, memory_order_relaxed);
+    if (prev == cur) {
+      return true;
+    }
+    cur = prev;
+  }
+  return false;
 }
 
 intptr_t ShenandoahPacer::epoch() {
@@ -230,12 +276,24 @@ intptr_t ShenandoahPacer::epoch() {
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* current = JavaThread::current();
+  const size_t thread_allocated = ShenandoahPacingFairShare ? account_alloc(current, words) : 0;
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc<false>(words);
   if (claimed) {
     return;
   }
 
+  // Light allocators overdraw the budget instead of stalling, which
+  // leaves heavier allocators waiting longer for GC to catch up. The
+  // total overdraft per epoch is capped, so many threads each taking
+  // credit once cannot outpace GC.
+  if (ShenandoahPacingFairShare && is_light_allocator(thread_allocated) && claim_overdraft(words)) {
+    claim_for_alloc<true>(words);
+    return;
+  }
+
   // Threads that are attaching should not block at all: they are not
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
@@ -243,13 +301,13 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Thread which is not an active Java thread should also not block.
   // This can happen during VM init when main thread is still not an
   // active Java thread.
-  JavaThread* current = JavaThread::current();
   if (current->is_attaching_via_jni() ||
       !current->is_active_Java_thread()) {
     claim_for_alloc<true>(words);
     return;
   }
 
+  EventShenandoahAllocationPacing event;
   jlong const max_delay = ShenandoahPacingMaxDelay * NANOSECS_PER_MILLISEC;
   jlong const start_time = os::elapsed_counter();
   while (!claimed && (os::elapsed_counter() - start_time) < max_delay) {
@@ -257,7 +315,8 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     wait(1);
     claimed = claim_for_alloc<false>(words);
   }
-  if (!claimed) {
+  const bool forced = !claimed;
+  if (forced) {
     // Spent local time budget to wait for enough GC progress.
     // Force allocating anyway, which may mean we outpace GC,
     // and start Degenerated GC cycle.
@@ -265,6 +324,13 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     assert(claimed, "Should always succeed");
   }
   ShenandoahThreadLocalData::add_paced_time(current, (double)(os::elapsed_counter() - start_time) / NANOSECS_PER_SEC);
+
+  if (event.should_commit()) {
+    event.set_size(words * HeapWordSize);
+    event.set_threadAllocated(thread_allocated * HeapWordSize);
+    event.set_forced(forced);
+    event.commit();
+  }
 }
 
 void ShenandoahPacer::wait(size_t time_ms) {
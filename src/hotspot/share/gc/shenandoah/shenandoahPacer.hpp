@@ -56,6 +56,12 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahPacingFairShare, each thread also tracks how much it allocated in
+ * the current pacing epoch. When credit is not available, a thread that allocated
+ * well below the average of all allocating threads takes the credit anyway, so the
+ * stalls are taken by the heavy allocators that depleted it. The credit taken that
+ * way is capped at 1/8 of the initial budget of the epoch.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -80,6 +86,16 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Words allocated and distinct allocating threads in this epoch, for fair share pacing
+  volatile size_t _epoch_allocated;
+  volatile size_t _epoch_allocators;
+  // Budget overdrawn by light allocators in this epoch, capped at a fraction of the initial budget
+  volatile intptr_t _epoch_overdraft;
+  volatile intptr_t _epoch_overdraft_limit;
+  shenandoah_padding(4);
+
+  static const intptr_t FairShareOverdraftDivisor = 8;
+
 public:
   explicit ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -90,7 +106,11 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {
+          _progress(PACING_PROGRESS_UNINIT),
+          _epoch_allocated(0),
+          _epoch_allocators(0),
+          _epoch_overdraft(0),
+          _epoch_overdraft_limit(0) {
     _notify_waiters_task.enroll();
   }
 
@@ -129,6 +149,10 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   size_t update_and_get_progress_history();
 
+  size_t account_alloc(JavaThread* thread, size_t words);
+  bool is_light_allocator(size_t thread_allocated) const;
+  bool claim_overdraft(size_t words);
+
   void wait(size_t time_ms);
 };
 
@@ -88,6 +88,7 @@ class outputStream;
   f(conc_class_unload_unlink_sd,                    "    System Dictionary")           \
   f(conc_class_unload_unlink_weak_klass,            "    Weak Class Links")            \
   f(conc_class_unload_unlink_code_roots,            "    Code Roots")                  \
+  SHENANDOAH_PAR_PHASE_DO(conc_class_unload_unlink_code_roots_, "      CCR: ", f)      \
   f(conc_class_unload_rendezvous,                   "  Rendezvous")                    \
   f(conc_class_unload_purge,                        "  Purge Unlinked")                \
   f(conc_class_unload_purge_coderoots,              "    Code Roots")                  \
@@ -96,6 +97,7 @@ class outputStream;
   f(conc_strong_roots,                              "Concurrent Strong Roots")         \
   SHENANDOAH_PAR_PHASE_DO(conc_strong_roots_,       "  CSR: ", f)                      \
   f(conc_evac,                                      "Concurrent Evacuation")           \
+  f(conc_evac_heap_lock,                            "  Heap Lock Wait")                \
                                                                                        \
   f(final_roots_gross,                              "Pause Final Roots (G)")           \
   f(final_roots,                                    "Pause Final Roots (N)")           \
@@ -45,6 +45,8 @@ class ShenandoahThreadLocalData {
   PLAB* _gclab;
   size_t _gclab_size;
   double _paced_time;
+  intptr_t _pacing_epoch;
+  size_t _pacing_allocated;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -53,7 +55,9 @@ class ShenandoahThreadLocalData {
     _satb_mark_queue(&ShenandoahBarrierSet::satb_mark_queue_set()),
     _gclab(nullptr),
     _gclab_size(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _pacing_epoch(0),
+    _pacing_allocated(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -124,6 +128,30 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  // Words allocated by the thread in the given pacing epoch. Returns true if
+  // this is the first allocation of the thread in that epoch.
+  static bool add_pacing_allocated(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const data = ShenandoahThreadLocalData::data(thread);
+    const bool first = data->_pacing_epoch != epoch;
+    if (first) {
+      data->_pacing_epoch = epoch;
+      data->_pacing_allocated = 0;
+    }
+    data->_pacing_allocated += words;
+    return first;
+  }
+
+  static void sub_pacing_allocated(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const data = ShenandoahThreadLocalData::data(thread);
+    if (data->_pacing_epoch == epoch) {
+      data->_pacing_allocated -= MIN2(words, data->_pacing_allocated);
+    }
+  }
+
+  static size_t pacing_allocated(Thread* thread) {
+    return data(thread)->_pacing_allocated;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
@@ -38,6 +38,7 @@
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "gc/shenandoah/shenandoahRootProcessor.hpp"
 #include "gc/shenandoah/shenandoahUnload.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
 #include "gc/shenandoah/shenandoahVerifier.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceUtils.hpp"
@@ -159,6 +160,7 @@ void ShenandoahUnload::unload() {
 
     {
       ShenandoahTimingsTracker t(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots);
+      ShenandoahGCWorkerPhase worker_phase(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots);
       ShenandoahCodeRoots::unlink(heap->workers(), unloadingOccurred);
     }
 
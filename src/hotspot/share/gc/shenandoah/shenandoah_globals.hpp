@@ -227,10 +227,20 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(bool, ShenandoahLockFreeGCAlloc, false, EXPERIMENTAL,             \
+          "Satisfy GCLAB and shared GC allocations by bumping the current " \
+          "collector region with CAS, only taking the heap lock to pick "   \
+          "a new region.")                                                  \
+                                                                            \
   product(bool, ShenandoahPacing, true, EXPERIMENTAL,                       \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
                                                                             \
+  product(bool, ShenandoahPacingFairShare, false, EXPERIMENTAL,             \
+          "Track pacing per thread, and let threads that allocated well "   \
+          "below the average in the current GC phase proceed without "      \
+          "stalling, so that the heaviest allocators are paced first.")     \
+                                                                            \
   product(uintx, ShenandoahPacingMaxDelay, 10, EXPERIMENTAL,                \
           "Max delay for pacing application allocations. Larger values "    \
           "provide more resilience against out of memory, at expense at "   \
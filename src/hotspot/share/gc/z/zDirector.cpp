@@ -65,6 +65,7 @@ struct ZDirectorGenerationStats {
 
 struct ZDirectorStats {
   ZStatMutatorAllocRateStats _mutator_alloc_rate;
+  ZStatAllocStallStats       _alloc_stall;
   ZDirectorHeapStats         _heap;
   ZDirectorGenerationStats   _young_stats;
   ZDirectorGenerationStats   _old_stats;
@@ -391,6 +392,94 @@ static bool rule_minor_high_usage(const ZDirectorStats& stats) {
   return is_high_usage(stats, &print_function);
 }
 
+// Returns how many times longer the allocation stalls at the SLO percentile
+// are than the SLO, or 0.0 if the SLO is disabled or met.
+static double alloc_stall_slo_violation(const ZDirectorStats& stats) {
+  if (ZAllocationStallSLO <= 0.0) {
+    // SLO disabled
+    return 0.0;
+  }
+
+  const double stall_ms = stats._alloc_stall._percentile * MILLIUNITS;
+  if (stats._alloc_stall._count == 0 || stall_ms <= ZAllocationStallSLO) {
+    // SLO met
+    return 0.0;
+  }
+
+  return stall_ms / ZAllocationStallSLO;
+}
+
+static bool rule_minor_allocation_stall_slo(const ZDirectorStats& stats) {
+  if (ZAllocationStallSLO <= 0.0 || ZCollectionIntervalOnly) {
+    // Rule disabled
+    return false;
+  }
+
+  if (!stats._old_stats._cycle._is_time_trustable) {
+    // Rule disabled
+    return false;
+  }
+
+  if (ZHeap::heap()->is_alloc_stalling_for_old()) {
+    // Don't collect young if we have threads stalled waiting for an old collection
+    return false;
+  }
+
+  if (is_young_small(stats)) {
+    return false;
+  }
+
+  const double violation = alloc_stall_slo_violation(stats);
+  if (violation == 0.0) {
+    log_debug(gc, director)("Rule Minor: Allocation Stall SLO, Stalls: " UINT64_FORMAT ", "
+                            "P%.1f: %.3fms, SLO: %.3fms, Met",
+                            stats._alloc_stall._count, ZAllocationStallSLOPercentile,
+                            stats._alloc_stall._percentile * MILLIUNITS, ZAllocationStallSLO);
+    return false;
+  }
+
+  // Calculate amount of free memory available. Note that we take the
+  // relocation headroom into account to avoid in-place relocation.
+  const size_t soft_max_capacity = stats._heap._soft_max_heap_size;
+  const size_t used = stats._heap._used;
+  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
+  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+
+  // Calculate time until OOM given the conservative allocation rate, like
+  // the allocation rate rule.
+  const ZStatMutatorAllocRateStats alloc_rate_stats = stats._mutator_alloc_rate;
+  const double alloc_rate = (MAX2(alloc_rate_stats._predict, alloc_rate_stats._avg) * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000) + 1.0;
+  const double time_until_oom = free / alloc_rate;
+
+  // Calculate max duration of a GC cycle, with the number of workers
+  // used by the last cycle.
+  const double serial_gc_time = stats._young_stats._cycle._avg_serial_time + (stats._young_stats._cycle._sd_serial_time * one_in_1000);
+  const double parallelizable_gc_time = stats._young_stats._cycle._avg_parallelizable_time + (stats._young_stats._cycle._sd_parallelizable_time * one_in_1000);
+  const double last_gc_workers = MAX2(stats._young_stats._cycle._last_active_workers, 1.0);
+  const double gc_duration = serial_gc_time + (parallelizable_gc_time / last_gc_workers);
+
+  // The stalls observed show that cycles are started too late. Start the
+  // cycle earlier, by a lead time proportional to how far the stalls are
+  // above the SLO, capped to a few GC durations.
+  const double lead_time = gc_duration * MIN2(violation, 4.0);
+  const double time_until_gc = time_until_oom - gc_duration - lead_time;
+
+  log_debug(gc, director)("Rule Minor: Allocation Stall SLO, Stalls: " UINT64_FORMAT ", "
+                          "P%.1f: %.3fms, SLO: %.3fms, Violated, MaxAllocRate: %.1fMB/s, Free: " SIZE_FORMAT "MB, "
+                          "GCDuration: %.3fs, LeadTime: %.3fs, TimeUntilOOM: %.3fs, TimeUntilGC: %.3fs",
+                          stats._alloc_stall._count, ZAllocationStallSLOPercentile,
+                          stats._alloc_stall._percentile * MILLIUNITS, ZAllocationStallSLO,
+                          alloc_rate / M, free / M, gc_duration, lead_time, time_until_oom, time_until_gc);
+
+  if (time_until_gc > 0) {
+    return false;
+  }
+
+  log_info(gc, director)("Starting Minor GC early: allocation stalls at P%.1f are %.3fms, above the %.3fms SLO",
+                         ZAllocationStallSLOPercentile, stats._alloc_stall._percentile * MILLIUNITS, ZAllocationStallSLO);
+  return true;
+}
+
 // Major GC rules
 
 static bool rule_major_timer(const ZDirectorStats& stats) {
@@ -614,6 +703,10 @@ static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
     return GCCause::_z_allocation_rate;
   }
 
+  if (rule_minor_allocation_stall_slo(stats)) {
+    return GCCause::_z_allocation_rate;
+  }
+
   if (rule_minor_high_usage(stats)) {
     return GCCause::_z_high_usage;
   }
@@ -687,6 +780,13 @@ static ZWorkerCounts select_worker_threads(const ZDirectorStats& stats, uint you
   if (ZHeap::heap()->is_alloc_stalling()) {
     // Boost GC threads when stalling
     return {ZYoungGCThreads, ZOldGCThreads};
+  } else if (alloc_stall_slo_violation(stats) > 0.0) {
+    // Boost GC threads when recent stalls are above the SLO
+    log_debug(gc, director)("Select GC Workers (Allocation Stall SLO Violated), "
+                            "P%.1f: %.3fms, SLO: %.3fms, YoungGCWorkers: %u, OldGCWorkers: %u",
+                            ZAllocationStallSLOPercentile, stats._alloc_stall._percentile * MILLIUNITS,
+                            ZAllocationStallSLO, ZYoungGCThreads, ZOldGCThreads);
+    return {ZYoungGCThreads, ZOldGCThreads};
   } else if (active_young_workers + active_old_workers > ConcGCThreads) {
     // Threads are boosted, due to stalling recently; retain that boosting
     return {active_young_workers, active_old_workers};
@@ -869,6 +969,7 @@ static ZDirectorStats sample_stats() {
   ZGenerationYoung* young = ZGeneration::young();
   ZGenerationOld* old = ZGeneration::old();
   const ZStatMutatorAllocRateStats mutator_alloc_rate = ZStatMutatorAllocRate::stats();
+  const ZStatAllocStallStats alloc_stall = ZStatAllocStall::stats(ZAllocationStallSLOPercentile);
   const ZDirectorHeapStats heap = sample_heap_stats();
 
   ZStatCycleStats young_cycle = young->stat_cycle()->stats();
@@ -888,6 +989,7 @@ static ZDirectorStats sample_stats() {
 
   return {
     mutator_alloc_rate,
+    alloc_stall,
     heap,
     {
       young_cycle,
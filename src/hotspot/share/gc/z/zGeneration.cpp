@@ -494,6 +494,7 @@ ZGenerationYoung::ZGenerationYoung(ZPageTable* page_table,
   : ZGeneration(ZGenerationId::young, page_table, page_allocator),
     _active_type(ZYoungType::none),
     _tenuring_threshold(0),
+    _life_expectancy(),
     _remembered(page_table, old_forwarding_table, page_allocator),
     _jfr_tracer() {
   ZGeneration::_young = this;
@@ -745,8 +746,13 @@ uint ZGenerationYoung::compute_tenuring_threshold(ZRelocationSetSelectorStats st
   // two ages in the age table. Values below 1 indicate generational behaviour where
   // the live bytes is shrinking from age to age. Values at or above 1 indicate
   // anti-generational patterns where the live bytes isn't going down or grows
-  // from age to age.
-  const double young_life_expectancy = young_life_expectancy_samples == 0 ? 1.0 : young_life_expectancy_sum / young_life_expectancy_samples;
+  // from age to age. A single age table is noisy for medium-lived objects, e.g.
+  // caches that turn over every few cycles, so the decaying average over previous
+  // young collections is used.
+  if (young_life_expectancy_samples != 0) {
+    _life_expectancy.add(young_life_expectancy_sum / young_life_expectancy_samples);
+  }
+  const double young_life_expectancy = _life_expectancy.num() == 0 ? 1.0 : _life_expectancy.davg();
 
   // The life decay factor is the reciprocal of the life expectancy. Therefore,
   // values at or below 1 indicate anti-generational behaviour where the live
@@ -803,6 +809,7 @@ uint ZGenerationYoung::compute_tenuring_threshold(ZRelocationSetSelectorStats st
   log_trace(gc, reloc)("Young Residency Reciprocal: %.1f", young_residency_reciprocal);
   log_trace(gc, reloc)("Young Residency Factor: %.1f", young_residency_factor);
   log_debug(gc, reloc)("Young Log Residency: %.1f", young_log_residency);
+  log_debug(gc, reloc)("Life Expectancy: %.2f (last: %.2f)", young_life_expectancy, _life_expectancy.last());
   log_debug(gc, reloc)("Life Decay Factor: %.1f", young_life_decay_factor);
 
   // Round to an integer as we can't have non-integral tenuring threshold.
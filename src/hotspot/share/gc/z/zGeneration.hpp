@@ -37,6 +37,7 @@
 #include "gc/z/zWeakRootsProcessor.hpp"
 #include "gc/z/zWorkers.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/numberSeq.hpp"
 
 class ThreadClosure;
 class ZForwardingTable;
@@ -198,6 +199,7 @@ class ZGenerationYoung : public ZGeneration {
 private:
   ZYoungType   _active_type;
   uint         _tenuring_threshold;
+  NumberSeq    _life_expectancy;
   ZRemembered  _remembered;
   ZYoungTracer _jfr_tracer;
 
@@ -101,6 +101,12 @@ inline void ZGranuleMap<T>::release_put(zoffset offset, size_t size, T value) {
   put(offset, size, value);
 }
 
+template <typename T>
+inline T ZGranuleMap<T>::cmpxchg(zoffset offset, T compare_value, T new_value) {
+  const size_t index = index_for_offset(offset);
+  return Atomic::cmpxchg(_map + index, compare_value, new_value);
+}
+
 template <typename T, bool Parallel>
 inline ZGranuleMapIterator<T, Parallel>::ZGranuleMapIterator(const ZGranuleMap<T>* granule_map)
   : ZArrayIteratorImpl<T, Parallel>(granule_map->_map, granule_map->_size) {}
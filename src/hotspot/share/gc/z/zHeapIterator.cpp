@@ -35,7 +35,6 @@
 #include "gc/z/zGranuleMap.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
-#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
 #include "memory/iterator.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
@@ -258,7 +257,6 @@ ZHeapIterator::ZHeapIterator(uint nworkers,
   : _visit_weaks(visit_weaks),
     _for_verify(for_verify),
     _bitmaps(ZAddressOffsetMax),
-    _bitmaps_lock(),
     _queues(nworkers),
     _array_chunk_queues(nworkers),
     _roots_colored(ZGenerationIdOptional::none),
@@ -313,18 +311,23 @@ static size_t object_index(oop obj) {
 
 ZHeapIteratorBitMap* ZHeapIterator::object_bitmap(oop obj) {
   const zoffset offset = ZAddress::offset(to_zaddress(obj));
-  ZHeapIteratorBitMap* bitmap = _bitmaps.get_acquire(offset);
-  if (bitmap == nullptr) {
-    ZLocker<ZLock> locker(&_bitmaps_lock);
-    bitmap = _bitmaps.get(offset);
-    if (bitmap == nullptr) {
-      // Install new bitmap
-      bitmap = new ZHeapIteratorBitMap(object_index_max());
-      _bitmaps.release_put(offset, bitmap);
-    }
+  ZHeapIteratorBitMap* const bitmap = _bitmaps.get_acquire(offset);
+  if (bitmap != nullptr) {
+    return bitmap;
+  }
+
+  // Install new bitmap. The bitmap is allocated and cleared outside of
+  // any lock, so that parallel iterators (e.g. heap dumping) touching
+  // many new granules at the same time don't serialize on the install.
+  ZHeapIteratorBitMap* const new_bitmap = new ZHeapIteratorBitMap(object_index_max());
+  ZHeapIteratorBitMap* const prev_bitmap = _bitmaps.cmpxchg(offset, (ZHeapIteratorBitMap*)nullptr, new_bitmap);
+  if (prev_bitmap != nullptr) {
+    // Lost the race, use the installed bitmap
+    delete new_bitmap;
+    return prev_bitmap;
   }
 
-  return bitmap;
+  return new_bitmap;
 }
 
 bool ZHeapIterator::should_visit_object_at_mark() const {
@@ -150,7 +150,13 @@ inline void ZLiveMap::iterate_segment(BitMap::idx_t segment, Function function)
   const BitMap::idx_t start_index = segment_start(segment);
   const BitMap::idx_t end_index   = segment_end(segment);
 
-  _bitmap.iterate(function, start_index, end_index);
+  // Each object has a pair of bits, where the even bit is the strong mark
+  // bit, and the odd bit is the finalizable mark bit. Only visit the even
+  // bits, to not visit the finalizable bits. The bitmap is not updated
+  // while it is iterated, so the dense iteration can be used.
+  const BitMap::bm_word_t even_bits = ~(BitMap::bm_word_t)0 / 3;
+
+  _bitmap.iterate_dense(function, start_index, end_index, even_bits);
 }
 
 template <typename Function>
@@ -159,17 +165,9 @@ inline void ZLiveMap::iterate(ZGenerationId id, Function function) {
     return;
   }
 
-  auto live_only = [&](BitMap::idx_t index) -> bool {
-    if ((index & 1) == 0) {
-      return function(index);
-    }
-    // Don't visit the finalizable bits
-    return true;
-  };
-
   for (BitMap::idx_t segment = first_live_segment(); segment < NumSegments; segment = next_live_segment(segment)) {
     // For each live segment
-    iterate_segment(segment, live_only);
+    iterate_segment(segment, function);
   }
 }
 
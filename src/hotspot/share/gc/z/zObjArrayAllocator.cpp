@@ -27,6 +27,7 @@
 #include "gc/z/zUtils.inline.hpp"
 #include "oops/arrayKlass.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "utilities/debug.hpp"
 
 ZObjArrayAllocator::ZObjArrayAllocator(Klass* klass, size_t word_size, int length, bool do_zero, Thread* thread)
@@ -102,6 +103,10 @@ oop ZObjArrayAllocator::initialize(HeapWord* mem) const {
 
   bool seen_gc_safepoint = false;
 
+  // Primitive arrays are zero filled, so large ones can be cleared with
+  // non-temporal stores.  Reference arrays need colored nulls.
+  const bool nontemporal = !is_reference_type(element_type) && use_nontemporal_clearing();
+
   auto initialize_memory = [&]() {
     for (size_t processed = 0; processed < process_size; processed += segment_max) {
       // Clear segment
@@ -123,7 +128,11 @@ oop ZObjArrayAllocator::initialize(HeapWord* mem) const {
       const uintptr_t colored_null = seen_gc_safepoint ? (ZPointerStoreGoodMask | ZPointerRememberedMask)
                                                        : ZPointerStoreGoodMask;
       const uintptr_t fill_value = is_reference_type(element_type) ? colored_null : 0;
-      ZUtils::fill(start, segment, fill_value);
+      if (nontemporal) {
+        StubRoutines::ZeroWordsNonTemporal_stub()((HeapWord*)start, segment);
+      } else {
+        ZUtils::fill(start, segment, fill_value);
+      }
 
       // Safepoint
       yield_for_safepoint();
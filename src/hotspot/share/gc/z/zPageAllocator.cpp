@@ -35,6 +35,7 @@
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zPageCache.hpp"
+#include "gc/z/zPageWarmer.hpp"
 #include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
@@ -197,6 +198,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     _stalled(),
     _unmapper(new ZUnmapper(this)),
     _uncommitter(new ZUncommitter(this)),
+    _warmer(ZWarmPageCache ? new ZPageWarmer(this) : nullptr),
     _safe_destroy(),
     _safe_recycle(this),
     _initialized(false) {
@@ -215,6 +217,7 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     log_info_p(gc, init)("Medium Page Size: N/A");
   }
   log_info_p(gc, init)("Pre-touch: %s", AlwaysPreTouch ? "Enabled" : "Disabled");
+  log_info_p(gc, init)("Page Cache Warming: %s", ZWarmPageCache ? "Enabled" : "Disabled");
 
   // Warn if system limits could stop us from reaching max capacity
   _physical.warn_commit_limits(max_capacity);
@@ -553,6 +556,7 @@ static void check_out_of_memory_during_initialization() {
 bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
   ZStatTimer timer(ZCriticalPhaseAllocationStall);
   EventZAllocationStall event;
+  const Ticks start = Ticks::now();
 
   // We can only block if the VM is fully initialized
   check_out_of_memory_during_initialization();
@@ -575,6 +579,9 @@ bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
     ZLocker<ZLock> locker(&_lock);
   }
 
+  // Record stall duration
+  ZStatAllocStall::sample(Ticks::now() - start);
+
   // Send event
   event.commit((u8)allocation->type(), allocation->size());
 
@@ -953,6 +960,95 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   return flushed;
 }
 
+size_t ZPageAllocator::warm(size_t reserve) {
+  // We need to join the suspendible thread set while manipulating capacity and
+  // used, to make sure GC safepoints will have a consistent view.
+  size_t warmed;
+
+  {
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZLocker<ZLock> locker(&_lock);
+
+    if (_stalled.first() != nullptr) {
+      // Leave the remaining capacity to the stalled allocations
+      return 0;
+    }
+
+    // Never warm beyond the soft max capacity. We commit chunks at a time
+    // (~0.8% of the max capacity, but at least one granule and at most
+    // 256M), to not hold back allocations needing the memory right now.
+    const size_t cached = _capacity - _used - _claimed;
+    const size_t limit = soft_max_capacity();
+    if (cached >= reserve || _capacity >= limit) {
+      // Nothing to warm
+      return 0;
+    }
+
+    const size_t chunk = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
+    const size_t size = align_down(MIN3(reserve - cached, limit - _capacity, chunk), ZGranuleSize);
+    if (size == 0) {
+      // Nothing to warm
+      return 0;
+    }
+
+    warmed = increase_capacity(size);
+    if (warmed == 0) {
+      // Nothing to warm
+      return 0;
+    }
+
+    // Record warmed memory as claimed, so that it isn't handed out
+    // before it has been inserted into the page cache
+    Atomic::add(&_claimed, warmed);
+  }
+
+  // Allocate, commit, map and pre-touch memory
+  ZPage* page = nullptr;
+  size_t committed = 0;
+
+  const ZVirtualMemory vmem = _virtual.alloc(warmed, false /* force_low_address */);
+  if (!vmem.is_null()) {
+    ZPhysicalMemory pmem;
+    _physical.alloc(pmem, warmed);
+    page = new ZPage(ZPageType::large, vmem, pmem);
+
+    if (!commit_page(page)) {
+      // Failed or partially failed. Keep any successfully
+      // committed part of the page.
+      ZPage* const committed_page = page->split_committed();
+      destroy_page(page);
+      page = committed_page;
+    }
+
+    if (page != nullptr) {
+      committed = page->size();
+      map_page(page);
+      _physical.pretouch(page->start(), page->size());
+    }
+  }
+
+  {
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZLocker<ZLock> locker(&_lock);
+
+    // Adjust claimed and capacity to reflect what was warmed
+    Atomic::sub(&_claimed, warmed);
+    if (committed < warmed) {
+      decrease_capacity(warmed - committed, false /* set_max_capacity */);
+    }
+
+    if (page != nullptr) {
+      // Cache page
+      recycle_page(page);
+    }
+
+    // Try satisfy stalled allocations
+    satisfy_stalled();
+  }
+
+  return committed;
+}
+
 void ZPageAllocator::enable_safe_destroy() const {
   _safe_destroy.enable_deferred_delete();
 }
@@ -1042,4 +1138,7 @@ void ZPageAllocator::handle_alloc_stalling_for_old(bool cleared_all_soft_refs) {
 void ZPageAllocator::threads_do(ThreadClosure* tc) const {
   tc->do_thread(_unmapper);
   tc->do_thread(_uncommitter);
+  if (_warmer != nullptr) {
+    tc->do_thread(_warmer);
+  }
 }
@@ -41,6 +41,7 @@ class ZPageAllocation;
 class ZPageAllocator;
 class ZPageAllocatorStats;
 class ZWorkers;
+class ZPageWarmer;
 class ZUncommitter;
 class ZUnmapper;
 
@@ -61,6 +62,7 @@ class ZSafePageRecycle {
 class ZPageAllocator {
   friend class VMStructs;
   friend class ZUnmapper;
+  friend class ZPageWarmer;
   friend class ZUncommitter;
 
 private:
@@ -83,6 +85,7 @@ class ZPageAllocator {
   ZList<ZPageAllocation>     _stalled;
   ZUnmapper*                 _unmapper;
   ZUncommitter*              _uncommitter;
+  ZPageWarmer*               _warmer;
   mutable ZSafeDelete<ZPage> _safe_destroy;
   mutable ZSafePageRecycle   _safe_recycle;
   bool                       _initialized;
@@ -121,6 +124,7 @@ class ZPageAllocator {
   void satisfy_stalled();
 
   size_t uncommit(uint64_t* timeout);
+  size_t warm(size_t reserve);
 
   void notify_out_of_memory();
   void restart_gc() const;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zPageWarmer.hpp"
+#include "gc/z/zStat.hpp"
+#include "logging/log.hpp"
+#include "utilities/align.hpp"
+
+static const ZStatCounter ZCounterPageCacheWarm("Memory", "Page Cache Warm", ZStatUnitBytesPerSecond);
+
+ZPageWarmer::ZPageWarmer(ZPageAllocator* page_allocator)
+  : _page_allocator(page_allocator),
+    _lock(),
+    _stop(false) {
+  set_name("ZPageWarmer");
+  create_and_start();
+}
+
+bool ZPageWarmer::wait(uint64_t timeout_ms) const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  if (!_stop) {
+    _lock.wait(timeout_ms);
+  }
+
+  return !_stop;
+}
+
+bool ZPageWarmer::should_continue() const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  return !_stop;
+}
+
+size_t ZPageWarmer::reserve() const {
+  // Keep enough memory to cover the predicted mutator allocation
+  // during the reserve period, with some margin for variance.
+  const ZStatMutatorAllocRateStats stats = ZStatMutatorAllocRate::stats();
+  const double rate = MAX2(stats._avg, stats._predict) + stats._sd;
+  const double reserve = rate * ZWarmPageCacheReserveSeconds;
+  return align_up((size_t)reserve, ZGranuleSize);
+}
+
+void ZPageWarmer::run_thread() {
+  while (wait(ZWarmPageCacheIntervalMillis)) {
+    const size_t target = reserve();
+    size_t warmed = 0;
+
+    while (should_continue()) {
+      // Warm chunk
+      const size_t committed = _page_allocator->warm(target);
+      if (committed == 0) {
+        // Done
+        break;
+      }
+
+      warmed += committed;
+    }
+
+    if (warmed > 0) {
+      // Update statistics
+      ZStatInc(ZCounterPageCacheWarm, warmed);
+      log_debug(gc, heap)("Page Cache Warmed: " SIZE_FORMAT "M, Reserve: " SIZE_FORMAT "M",
+                          warmed / M, target / M);
+    }
+  }
+}
+
+void ZPageWarmer::terminate() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _stop = true;
+  _lock.notify_all();
+}
@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -467,7 +468,8 @@ class ZRelocateMediumAllocator {
 private:
   ZGeneration* const _generation;
   ZConditionLock     _lock;
-  ZPage*             _shared[ZAllocator::_relocation_allocators];
+  const uint32_t     _numa_count;
+  ZPage**            _shared;
   bool               _in_place;
   volatile size_t    _in_place_count;
 
@@ -475,24 +477,33 @@ class ZRelocateMediumAllocator {
   ZRelocateMediumAllocator(ZGeneration* generation)
     : _generation(generation),
       _lock(),
-      _shared(),
+      _numa_count(ZNUMA::count()),
+      _shared(NEW_C_HEAP_ARRAY(ZPage*, _numa_count * ZAllocator::_relocation_allocators, mtGC)),
       _in_place(false),
-      _in_place_count(0) {}
+      _in_place_count(0) {
+    for (uint i = 0; i < _numa_count * ZAllocator::_relocation_allocators; ++i) {
+      _shared[i] = nullptr;
+    }
+  }
 
   ~ZRelocateMediumAllocator() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    for (uint i = 0; i < _numa_count * ZAllocator::_relocation_allocators; ++i) {
       if (_shared[i] != nullptr) {
         retire_target_page(_generation, _shared[i]);
       }
     }
+
+    FREE_C_HEAP_ARRAY(ZPage*, _shared);
   }
 
-  ZPage* shared(ZPageAge age) {
-    return _shared[static_cast<uint>(age) - 1];
+  // The shared target pages are kept per NUMA node of the pages being
+  // relocated, so that pages on the same node are compacted together.
+  ZPage* shared(uint32_t numa_id, ZPageAge age) {
+    return _shared[numa_id * ZAllocator::_relocation_allocators + static_cast<uint>(age) - 1];
   }
 
-  void set_shared(ZPageAge age, ZPage* page) {
-    _shared[static_cast<uint>(age) - 1] = page;
+  void set_shared(uint32_t numa_id, ZPageAge age, ZPage* page) {
+    _shared[numa_id * ZAllocator::_relocation_allocators + static_cast<uint>(age) - 1] = page;
   }
 
   ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
@@ -507,11 +518,12 @@ class ZRelocateMediumAllocator {
     // current target page. The shared page will be different from the
     // current target page if another thread shared a page, or allocated
     // a new page.
+    const uint32_t numa_id = forwarding->page()->numa_id();
     const ZPageAge to_age = forwarding->to_age();
-    if (shared(to_age) == target) {
+    if (shared(numa_id, to_age) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
       ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
-      set_shared(to_age, to_page);
+      set_shared(numa_id, to_age, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
         _in_place = true;
@@ -523,18 +535,19 @@ class ZRelocateMediumAllocator {
       }
     }
 
-    return shared(to_age);
+    return shared(numa_id, to_age);
   }
 
   void share_target_page(ZPage* page) {
+    const uint32_t numa_id = page->numa_id();
     const ZPageAge age = page->age();
 
     ZLocker<ZConditionLock> locker(&_lock);
     assert(_in_place, "Invalid state");
-    assert(shared(age) == nullptr, "Invalid state");
+    assert(shared(numa_id, age) == nullptr, "Invalid state");
     assert(page != nullptr, "Invalid page");
 
-    set_shared(age, page);
+    set_shared(numa_id, age, page);
     _in_place = false;
 
     _lock.notify_all();
@@ -1047,11 +1060,14 @@ class ZRelocateStoreBufferInstallBasePointersTask : public ZTask {
 
 class ZRelocateTask : public ZRestartableTask {
 private:
-  ZRelocationSetParallelIterator _iter;
-  ZGeneration* const             _generation;
-  ZRelocateQueue* const          _queue;
-  ZRelocateSmallAllocator        _small_allocator;
-  ZRelocateMediumAllocator       _medium_allocator;
+  ZRelocationSetNUMAParallelIterator _iter;
+  ZGeneration* const                 _generation;
+  ZRelocateQueue* const              _queue;
+  ZRelocateSmallAllocator            _small_allocator;
+  ZRelocateMediumAllocator           _medium_allocator;
+  volatile size_t                    _numa_local_count;
+  volatile size_t                    _numa_remote_count;
+  size_t                             _relocated[ZPageAgeMax + 1];
 
 public:
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
@@ -1060,10 +1076,17 @@ class ZRelocateTask : public ZRestartableTask {
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
-      _medium_allocator(_generation) {}
+      _medium_allocator(_generation),
+      _numa_local_count(0),
+      _numa_remote_count(0),
+      _relocated() {}
 
   ~ZRelocateTask() {
-    _generation->stat_relocation()->at_relocate_end(_small_allocator.in_place_count(), _medium_allocator.in_place_count());
+    _generation->stat_relocation()->at_relocate_end(_small_allocator.in_place_count(),
+                                                    _medium_allocator.in_place_count(),
+                                                    _numa_local_count,
+                                                    _numa_remote_count,
+                                                    _relocated);
 
     // Signal that we're not using the queue anymore. Used mostly for asserts.
     _queue->deactivate();
@@ -1073,8 +1096,13 @@ class ZRelocateTask : public ZRestartableTask {
     ZRelocateWork<ZRelocateSmallAllocator> small(&_small_allocator, _generation);
     ZRelocateWork<ZRelocateMediumAllocator> medium(&_medium_allocator, _generation);
 
+    // Surviving bytes per source age, sampled once per relocated page
+    size_t relocated[ZPageAgeMax + 1] = {};
+
     const auto do_forwarding = [&](ZForwarding* forwarding) {
       ZPage* const page = forwarding->page();
+      relocated[static_cast<uint>(forwarding->from_age())] += page->live_bytes();
+
       if (page->is_small()) {
         small.do_forwarding(forwarding);
       } else {
@@ -1091,17 +1119,25 @@ class ZRelocateTask : public ZRestartableTask {
       forwarding->mark_done();
     };
 
-    const auto claim_and_do_forwarding = [&](ZForwarding* forwarding) {
-      if (forwarding->claim()) {
-        do_forwarding(forwarding);
-      }
-    };
+    size_t numa_local_count = 0;
+    size_t numa_remote_count = 0;
 
     const auto do_forwarding_one_from_iter = [&]() {
+      // Prefer pages on the NUMA node the worker is currently running on,
+      // which the target pages are then also allocated from.
       ZForwarding* forwarding;
+      bool numa_local;
 
-      if (_iter.next(&forwarding)) {
-        claim_and_do_forwarding(forwarding);
+      if (_iter.next(ZNUMA::id(), &forwarding, &numa_local)) {
+        if (forwarding->claim()) {
+          if (numa_local) {
+            numa_local_count++;
+          } else {
+            numa_remote_count++;
+          }
+
+          do_forwarding(forwarding);
+        }
         return true;
       }
 
@@ -1128,6 +1164,15 @@ class ZRelocateTask : public ZRestartableTask {
       }
     }
 
+    Atomic::add(&_numa_local_count, numa_local_count);
+    Atomic::add(&_numa_remote_count, numa_remote_count);
+
+    for (uint i = 0; i <= ZPageAgeMax; ++i) {
+      if (relocated[i] != 0) {
+        Atomic::add(&_relocated[i], relocated[i]);
+      }
+    }
+
     _queue->leave();
   }
 
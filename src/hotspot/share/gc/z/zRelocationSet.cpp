@@ -27,6 +27,7 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -56,6 +57,12 @@ class ZRelocationSetInstallTask : public ZTask {
 
     _forwardings[index] = forwarding;
 
+    if (ZNUMA::is_enabled()) {
+      // Resolve the NUMA node of the page here, in parallel, rather
+      // than when the relocation set is partitioned by NUMA node.
+      page->numa_id();
+    }
+
     if (forwarding->is_promotion()) {
       // Before promoting an object (and before relocate start), we must ensure that all
       // contained zpointers are store good. The marking code ensures that for non-null
@@ -142,6 +149,7 @@ ZRelocationSet::ZRelocationSet(ZGeneration* generation)
     _allocator(),
     _forwardings(nullptr),
     _nforwardings(0),
+    _numa_offsets(),
     _promotion_lock(),
     _flip_promoted_pages(),
     _in_place_relocate_promoted_pages() {}
@@ -166,10 +174,54 @@ void ZRelocationSet::install(const ZRelocationSetSelector* selector) {
   _forwardings = task.forwardings();
   _nforwardings = task.nforwardings();
 
+  // Group forwardings by NUMA node
+  partition_by_numa();
+
   // Update statistics
   _generation->stat_relocation()->at_install_relocation_set(_allocator.size());
 }
 
+void ZRelocationSet::partition_by_numa() {
+  const uint32_t numa_count = ZNUMA::count();
+
+  // Count forwardings per NUMA node
+  ZArray<size_t> counts((int)numa_count, (int)numa_count, 0);
+  if (numa_count > 1) {
+    for (size_t i = 0; i < _nforwardings; i++) {
+      counts.at(_forwardings[i]->page()->numa_id())++;
+    }
+  } else {
+    counts.at(0) = _nforwardings;
+  }
+
+  // Calculate the start offset of each NUMA node's partition
+  _numa_offsets.clear();
+  size_t offset = 0;
+  for (uint32_t numa_id = 0; numa_id < numa_count; numa_id++) {
+    _numa_offsets.append(offset);
+    offset += counts.at(numa_id);
+  }
+  _numa_offsets.append(offset);
+
+  if (numa_count == 1) {
+    // Nothing to partition
+    return;
+  }
+
+  // Stable partition, so medium pages are still relocated before
+  // small pages within each NUMA node
+  ZArray<ZForwarding*> forwardings((int)_nforwardings);
+  for (size_t i = 0; i < _nforwardings; i++) {
+    forwardings.append(_forwardings[i]);
+  }
+
+  ZArray<size_t> next((int)numa_count);
+  next.appendAll(&_numa_offsets);
+  for (ZForwarding* const forwarding : forwardings) {
+    _forwardings[next.at(forwarding->page()->numa_id())++] = forwarding;
+  }
+}
+
 static void destroy_and_clear(ZPageAllocator* page_allocator, ZArray<ZPage*>* array) {
   for (int i = 0; i < array->length(); i++) {
     // Delete non-relocating promoted pages from last cycle
@@ -187,6 +239,7 @@ void ZRelocationSet::reset(ZPageAllocator* page_allocator) {
   }
 
   _nforwardings = 0;
+  _numa_offsets.clear();
 
   destroy_and_clear(page_allocator, &_in_place_relocate_promoted_pages);
   destroy_and_clear(page_allocator, &_flip_promoted_pages);
@@ -205,3 +258,62 @@ void ZRelocationSet::register_in_place_relocate_promoted(ZPage* page) {
   assert(!_in_place_relocate_promoted_pages.contains(page), "no duplicates allowed");
   _in_place_relocate_promoted_pages.append(page);
 }
+
+ZRelocationSetNUMAParallelIterator::ZRelocationSetNUMAParallelIterator(ZRelocationSet* relocation_set)
+  : _forwardings(relocation_set->_forwardings),
+    _numa_count(ZNUMA::count()),
+    _partitions(NEW_C_HEAP_ARRAY(PaddedEnd<Partition>, _numa_count, mtGC)) {
+  assert((uint32_t)relocation_set->_numa_offsets.length() == _numa_count + 1, "Not partitioned");
+
+  for (uint32_t numa_id = 0; numa_id < _numa_count; numa_id++) {
+    _partitions[numa_id]._next = relocation_set->_numa_offsets.at(numa_id);
+    _partitions[numa_id]._end = relocation_set->_numa_offsets.at(numa_id + 1);
+  }
+}
+
+ZRelocationSetNUMAParallelIterator::~ZRelocationSetNUMAParallelIterator() {
+  FREE_C_HEAP_ARRAY(PaddedEnd<Partition>, _partitions);
+}
+
+bool ZRelocationSetNUMAParallelIterator::next_in_partition(uint32_t numa_id, ZForwarding** forwarding) {
+  Partition* const partition = &_partitions[numa_id];
+  if (Atomic::load(&partition->_next) >= partition->_end) {
+    // Partition exhausted, avoid bumping the index further
+    return false;
+  }
+
+  const size_t claimed_index = Atomic::fetch_then_add(&partition->_next, 1u, memory_order_relaxed);
+  if (claimed_index < partition->_end) {
+    *forwarding = _forwardings[claimed_index];
+    return true;
+  }
+
+  return false;
+}
+
+bool ZRelocationSetNUMAParallelIterator::next(uint32_t numa_id, ZForwarding** forwarding, bool* numa_local) {
+  // Try NUMA local partition
+  if (next_in_partition(numa_id, forwarding)) {
+    *numa_local = true;
+    return true;
+  }
+
+  *numa_local = false;
+
+  // Try NUMA remote partition(s)
+  uint32_t remote_numa_id = numa_id + 1;
+  const uint32_t remote_numa_count = _numa_count - 1;
+  for (uint32_t i = 0; i < remote_numa_count; i++) {
+    if (remote_numa_id == _numa_count) {
+      remote_numa_id = 0;
+    }
+
+    if (next_in_partition(remote_numa_id, forwarding)) {
+      return true;
+    }
+
+    remote_numa_id++;
+  }
+
+  return false;
+}
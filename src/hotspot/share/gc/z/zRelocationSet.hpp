@@ -27,6 +27,7 @@
 #include "gc/z/zArray.hpp"
 #include "gc/z/zForwardingAllocator.hpp"
 #include "gc/z/zLock.hpp"
+#include "memory/padded.hpp"
 
 class ZForwarding;
 class ZGeneration;
@@ -37,18 +38,22 @@ class ZWorkers;
 
 class ZRelocationSet {
   template <bool> friend class ZRelocationSetIteratorImpl;
+  friend class ZRelocationSetNUMAParallelIterator;
 
 private:
   ZGeneration*         _generation;
   ZForwardingAllocator _allocator;
   ZForwarding**        _forwardings;
   size_t               _nforwardings;
+  ZArray<size_t>       _numa_offsets;
   ZLock                _promotion_lock;
   ZArray<ZPage*>       _flip_promoted_pages;
   ZArray<ZPage*>       _in_place_relocate_promoted_pages;
 
   ZWorkers* workers() const;
 
+  void partition_by_numa();
+
 public:
   ZRelocationSet(ZGeneration* generation);
 
@@ -70,4 +75,27 @@ class ZRelocationSetIteratorImpl : public ZArrayIteratorImpl<ZForwarding*, Paral
 using ZRelocationSetIterator = ZRelocationSetIteratorImpl<false /* Parallel */>;
 using ZRelocationSetParallelIterator = ZRelocationSetIteratorImpl<true /* Parallel */>;
 
+// Parallel iterator which hands out forwardings for pages on the
+// given NUMA node first, and then forwardings for pages on the
+// remaining NUMA nodes.
+class ZRelocationSetNUMAParallelIterator : public StackObj {
+private:
+  struct Partition {
+    volatile size_t _next;
+    size_t          _end;
+  };
+
+  ZForwarding** const   _forwardings;
+  const uint32_t        _numa_count;
+  PaddedEnd<Partition>* _partitions;
+
+  bool next_in_partition(uint32_t numa_id, ZForwarding** forwarding);
+
+public:
+  ZRelocationSetNUMAParallelIterator(ZRelocationSet* relocation_set);
+  ~ZRelocationSetNUMAParallelIterator();
+
+  bool next(uint32_t numa_id, ZForwarding** forwarding, bool* numa_local);
+};
+
 #endif // SHARE_GC_Z_ZRELOCATIONSET_HPP
@@ -75,7 +75,7 @@ void ZRememberedSet::clear_previous() {
 
 void ZRememberedSet::swap_remset_bitmaps() {
   assert(previous()->is_empty(), "Previous remset bits should be empty when swapping");
-  current()->iterate([&](BitMap::idx_t index) {
+  current()->iterate_dense([&](BitMap::idx_t index) {
     previous()->set_bit(index);
     return true;
   });
@@ -31,6 +31,7 @@
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zNMethodTable.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zStat.hpp"
@@ -1015,6 +1016,67 @@ ZStatMutatorAllocRateStats ZStatMutatorAllocRate::stats() {
   return {_rate.avg(), _rate.predict_next(), _rate.sd()};
 }
 
+//
+// Stat allocation stall
+//
+volatile uint64_t ZStatAllocStall::_current[ZStatAllocStall::NumBuckets];
+uint64_t          ZStatAllocStall::_previous[ZStatAllocStall::NumBuckets];
+jlong             ZStatAllocStall::_window_start;
+
+size_t ZStatAllocStall::to_bucket(const Tickspan& duration) {
+  // Bucket 0 holds stalls shorter than 1us, bucket N holds
+  // stalls in the range [2^(N-1), 2^N) us.
+  const jlong us = duration.microseconds();
+  if (us <= 0) {
+    return 0;
+  }
+
+  return MIN2((size_t)log2i(us) + 1, NumBuckets - 1);
+}
+
+double ZStatAllocStall::bucket_limit(size_t bucket) {
+  return (double)((uint64_t)1 << bucket) / MICROUNITS;
+}
+
+void ZStatAllocStall::sample(const Tickspan& duration) {
+  Atomic::inc(&_current[to_bucket(duration)]);
+}
+
+ZStatAllocStallStats ZStatAllocStall::stats(double percentile) {
+  const jlong now = os::elapsed_counter();
+  if (now - _window_start > WindowSeconds * os::elapsed_frequency()) {
+    // Start new window
+    for (size_t i = 0; i < NumBuckets; i++) {
+      _previous[i] = Atomic::xchg(&_current[i], (uint64_t)0);
+    }
+    _window_start = now;
+  }
+
+  uint64_t buckets[NumBuckets];
+  uint64_t count = 0;
+  for (size_t i = 0; i < NumBuckets; i++) {
+    buckets[i] = _previous[i] + Atomic::load(&_current[i]);
+    count += buckets[i];
+  }
+
+  if (count == 0) {
+    return {0, 0.0};
+  }
+
+  // Find the bucket containing the percentile
+  const uint64_t rank = MAX2((uint64_t)ceil((double)count * percentile / 100.0), (uint64_t)1);
+  uint64_t accumulated = 0;
+  size_t bucket = 0;
+  for (; bucket < NumBuckets - 1; bucket++) {
+    accumulated += buckets[bucket];
+    if (accumulated >= rank) {
+      break;
+    }
+  }
+
+  return {count, bucket_limit(bucket)};
+}
+
 //
 // Stat thread
 //
@@ -1469,7 +1531,10 @@ ZStatRelocation::ZStatRelocation()
     _small_selected(),
     _small_in_place_count(),
     _medium_selected(),
-    _medium_in_place_count() {}
+    _medium_in_place_count(),
+    _numa_local_count(),
+    _numa_remote_count(),
+    _relocated() {}
 
 void ZStatRelocation::at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats) {
   _selector_stats = selector_stats;
@@ -1479,9 +1544,29 @@ void ZStatRelocation::at_install_relocation_set(size_t forwarding_usage) {
   _forwarding_usage = forwarding_usage;
 }
 
-void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count) {
+void ZStatRelocation::at_relocate_end(size_t small_in_place_count,
+                                      size_t medium_in_place_count,
+                                      size_t numa_local_count,
+                                      size_t numa_remote_count,
+                                      const size_t* relocated) {
   _small_in_place_count = small_in_place_count;
   _medium_in_place_count = medium_in_place_count;
+  _numa_local_count = numa_local_count;
+  _numa_remote_count = numa_remote_count;
+
+  for (uint i = 0; i <= ZPageAgeMax; ++i) {
+    _relocated[i] = relocated[i];
+  }
+}
+
+size_t ZStatRelocation::live(ZPageAge age) const {
+  return _selector_stats.small(age).live() +
+         _selector_stats.medium(age).live() +
+         _selector_stats.large(age).live();
+}
+
+size_t ZStatRelocation::relocated(ZPageAge age) const {
+  return _relocated[static_cast<uint>(age)];
 }
 
 void ZStatRelocation::print_page_summary() {
@@ -1543,6 +1628,12 @@ void ZStatRelocation::print_page_summary() {
   print_summary("Large", large_summary, 0 /* in_place_count */);
 
   lt.print("Forwarding Usage: " SIZE_FORMAT "M", _forwarding_usage / M);
+
+  if (ZNUMA::is_enabled()) {
+    const size_t numa_total = _numa_local_count + _numa_remote_count;
+    lt.print("NUMA Local Relocation: " SIZE_FORMAT "/" SIZE_FORMAT " pages (%.1f%%)",
+             _numa_local_count, numa_total, percent_of(_numa_local_count, numa_total));
+  }
 }
 
 void ZStatRelocation::print_age_table() {
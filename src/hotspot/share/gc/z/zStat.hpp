@@ -379,6 +379,38 @@ class ZStatMutatorAllocRate : public AllStatic {
   static ZStatMutatorAllocRateStats stats();
 };
 
+struct ZStatAllocStallStats {
+  uint64_t _count;
+  double   _percentile;
+};
+
+//
+// Stat allocation stall
+//
+// Keeps a histogram of allocation stall durations, with power of two
+// microsecond buckets, over the last one to two windows.
+//
+class ZStatAllocStall : public AllStatic {
+private:
+  static const size_t    NumBuckets = 32;
+  static const jlong     WindowSeconds = 60;
+
+  static volatile uint64_t _current[NumBuckets];
+  static uint64_t          _previous[NumBuckets];
+  static jlong             _window_start;
+
+  static size_t to_bucket(const Tickspan& duration);
+  static double bucket_limit(size_t bucket);
+
+public:
+  static void sample(const Tickspan& duration);
+
+  // Returns the number of recent stalls, and an upper bound of the
+  // stall duration (in seconds) at the given percentile. Must only
+  // be called from a single thread.
+  static ZStatAllocStallStats stats(double percentile);
+};
+
 //
 // Stat thread
 //
@@ -531,6 +563,9 @@ class ZStatRelocation {
   size_t                      _small_in_place_count;
   size_t                      _medium_selected;
   size_t                      _medium_in_place_count;
+  size_t                      _numa_local_count;
+  size_t                      _numa_remote_count;
+  size_t                      _relocated[ZPageAgeMax + 1];
 
   void print(const char* name,
              ZStatRelocationSummary selector_group,
@@ -541,7 +576,14 @@ class ZStatRelocation {
 
   void at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats);
   void at_install_relocation_set(size_t forwarding_usage);
-  void at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count);
+  void at_relocate_end(size_t small_in_place_count,
+                       size_t medium_in_place_count,
+                       size_t numa_local_count,
+                       size_t numa_remote_count,
+                       const size_t* relocated);
+
+  size_t live(ZPageAge age) const;
+  size_t relocated(ZPageAge age) const;
 
   void print_page_summary();
   void print_age_table();
@@ -97,9 +97,32 @@ void ZGenerationTracer::report_start(const Ticks& timestamp) {
   _start = timestamp;
 }
 
+void ZYoungTracer::report_tenuring_distribution() {
+  EventZTenuringDistribution e;
+  if (!e.should_commit()) {
+    return;
+  }
+
+  const ZStatRelocation* const stat = ZGeneration::young()->stat_relocation();
+  const uint tenuring_threshold = ZGeneration::young()->tenuring_threshold();
+
+  for (uint i = 0; i < ZPageAgeMax; ++i) {
+    const ZPageAge age = static_cast<ZPageAge>(i);
+    const size_t live = stat->live(age);
+    const size_t relocated = stat->relocated(age);
+    if (live == 0 && relocated == 0) {
+      continue;
+    }
+
+    EventZTenuringDistribution::commit(GCId::current(), i, live, relocated, i >= tenuring_threshold);
+  }
+}
+
 void ZYoungTracer::report_end(const Ticks& timestamp) {
   NoSafepointVerifier nsv;
 
+  report_tenuring_distribution();
+
   EventZYoungGarbageCollection e(UNTIMED);
   e.set_gcId(GCId::current());
   e.set_tenuringThreshold(ZGeneration::young()->tenuring_threshold());
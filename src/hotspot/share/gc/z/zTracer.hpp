@@ -70,6 +70,9 @@ class ZGenerationTracer {
 };
 
 class ZYoungTracer : public ZGenerationTracer {
+private:
+  void report_tenuring_distribution();
+
 public:
   void report_end(const Ticks& timestamp) override;
 };
@@ -47,6 +47,30 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(double, ZAllocationStallSLO, 0.0, EXPERIMENTAL,                   \
+          "Target allocation stall latency (in milliseconds) at the "       \
+          "ZAllocationStallSLOPercentile percentile. GC cycles are "        \
+          "started earlier and with more workers while it is not met. "     \
+          "0 disables the target")                                          \
+          range(0.0, 1000000.0)                                             \
+                                                                            \
+  product(double, ZAllocationStallSLOPercentile, 99.9, EXPERIMENTAL,        \
+          "Percentile of allocation stalls ZAllocationStallSLO applies to") \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  product(bool, ZWarmPageCache, false, EXPERIMENTAL,                        \
+          "Keep a reserve of committed and pre-touched memory in the "      \
+          "page cache, sized from the recent mutator allocation rate")      \
+                                                                            \
+  product(double, ZWarmPageCacheReserveSeconds, 1.0, EXPERIMENTAL,          \
+          "Seconds of predicted mutator allocation to keep warm in the "    \
+          "page cache")                                                     \
+          range(0.0, 3600.0)                                                \
+                                                                            \
+  product(uint, ZWarmPageCacheIntervalMillis, 100, EXPERIMENTAL,            \
+          "Time between page cache warming attempts (in milliseconds)")     \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
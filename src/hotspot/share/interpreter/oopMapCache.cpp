@@ -36,6 +36,7 @@
 #include "runtime/safepoint.hpp"
 #include "runtime/signature.hpp"
 #include "utilities/globalCounter.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -432,6 +433,10 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
 
+volatile size_t OopMapCache::_num_lookups = 0;
+volatile size_t OopMapCache::_num_hits = 0;
+volatile size_t OopMapCache::_num_evictions = 0;
+
 OopMapCache::OopMapCache() {
   for(int i = 0; i < size; i++) _array[i] = nullptr;
 }
@@ -479,6 +484,20 @@ void OopMapCache::flush_obsolete_entries() {
   }
 }
 
+void OopMapCache::update_statistics(bool hit) {
+  size_t lookups = Atomic::add(&_num_lookups, (size_t)1);
+  if (hit) {
+    Atomic::inc(&_num_hits);
+  }
+  // Report at exponentially growing intervals to keep the output small.
+  if (lookups >= 1024 && is_power_of_2(lookups)) {
+    size_t hits = Atomic::load(&_num_hits);
+    log_info(interpreter, oopmap)("OopMapCache: " SIZE_FORMAT " lookups, " SIZE_FORMAT " hits (%.1f%%), "
+                                  SIZE_FORMAT " evictions",
+                                  lookups, hits, 100.0 * hits / lookups, Atomic::load(&_num_evictions));
+  }
+}
+
 // Lookup or compute/cache the entry.
 void OopMapCache::lookup(const methodHandle& method,
                          int bci,
@@ -495,6 +514,7 @@ void OopMapCache::lookup(const methodHandle& method,
 
   // Search hashtable for match.
   // Need a critical section to avoid race against concurrent reclamation.
+  bool found = false;
   {
     GlobalCounter::CriticalSection cs(Thread::current());
     for (int i = 0; i < probe_depth; i++) {
@@ -503,11 +523,19 @@ void OopMapCache::lookup(const methodHandle& method,
         entry_for->copy_from(entry);
         assert(!entry_for->is_empty(), "A non-empty oop map should be returned");
         log_debug(interpreter, oopmap)("- found at hash %d", probe + i);
-        return;
+        found = true;
+        break;
       }
     }
   }
 
+  if (log_is_enabled(Info, interpreter, oopmap)) {
+    update_statistics(found);
+  }
+  if (found) {
+    return;
+  }
+
   // Entry is not in hashtable.
   // Compute entry
 
@@ -547,6 +575,9 @@ void OopMapCache::lookup(const methodHandle& method,
     // Instead of synchronizing on GlobalCounter here and incurring heavy thread
     // walk, we do this clean up out of band.
     enqueue_for_cleanup(old);
+    if (log_is_enabled(Info, interpreter, oopmap)) {
+      Atomic::inc(&_num_evictions);
+    }
   } else {
     OopMapCacheEntry::deallocate(tmp);
   }
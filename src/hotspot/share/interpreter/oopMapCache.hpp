@@ -150,6 +150,11 @@ class InterpreterOopMap: ResourceObj {
 
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+
+ // Statistics over all caches, only collected with -Xlog:interpreter+oopmap=info
+ static volatile size_t _num_lookups;
+ static volatile size_t _num_hits;
+ static volatile size_t _num_evictions;
  private:
   static constexpr int size = 32;        // Use fixed size for now
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
@@ -162,6 +167,8 @@ class OopMapCache : public CHeapObj<mtClass> {
 
   static void enqueue_for_cleanup(OopMapCacheEntry* entry);
 
+  static void update_statistics(bool hit);
+
   void flush();
 
  public:
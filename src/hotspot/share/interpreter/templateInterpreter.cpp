@@ -33,7 +33,7 @@
 #include "memory/resourceArea.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/safepoint.hpp"
-#include "runtime/timerTrace.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "utilities/checkedCast.hpp"
 #include "utilities/copy.hpp"
 
@@ -63,7 +63,7 @@ void TemplateInterpreter::initialize_code() {
 
   // generate interpreter
   { ResourceMark rm;
-    TraceTime timer("Interpreter generation", TRACETIME_LOG(Info, startuptime));
+    TraceStartupTime timer("Interpreter generation");
     TemplateInterpreterGenerator g;
     // Free the unused memory not occupied by the interpreter and the stubs
     _code->deallocate_unused_tail();
@@ -32,6 +32,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/gcConfiguration.hpp"
+#include "gc/shared/gcTelemetry.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
@@ -60,6 +61,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/vmThread.hpp"
@@ -113,6 +115,10 @@ TRACE_REQUEST_FUNC(JVMInformation) {
   event.commit();
  }
 
+TRACE_REQUEST_FUNC(StartupPhase) {
+  StartupTimeline::send_events();
+}
+
 TRACE_REQUEST_FUNC(OSInformation) {
   ResourceMark rm;
   char* os_version = nullptr;
@@ -411,6 +417,10 @@ TRACE_REQUEST_FUNC(G1HeapRegionInformation) {
   G1GC_ONLY(G1HeapRegionEventSender::send_events());
 }
 
+TRACE_REQUEST_FUNC(GCPhaseLatency) {
+  GCTelemetry::send_events();
+}
+
 // Java Mission Control (JMC) uses (Java) Long.MIN_VALUE to describe that a
 // long value is undefined.
 static jlong jmc_undefined_long = min_jlong;
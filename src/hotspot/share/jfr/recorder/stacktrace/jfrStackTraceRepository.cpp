@@ -28,13 +28,19 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Lookups in add_trace() are done without the lock, inside a GlobalCounter critical section.
+ * Entries are only ever prepended to a bucket, and are deleted in clear_table() after a
+ * GlobalCounter::write_synchronize(), so a lock-free reader never sees a deleted entry.
  */
 
 static JfrStackTraceRepository* _instance = nullptr;
@@ -104,41 +110,48 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   }
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = stacktrace->next();
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    clear_table();
     _entries = 0;
   }
   _last_entries = _entries;
   return count;
 }
 
-size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
+// Caller holds JfrStacktrace_lock.
+void JfrStackTraceRepository::clear_table() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const entries = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  memcpy(entries, _table, sizeof(_table));
+  memset(_table, 0, sizeof(_table));
+  // Wait for lock-free readers that may still be traversing the unlinked entries.
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
+    const JfrStackTrace* stacktrace = entries[i];
     while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      const JfrStackTrace* next = stacktrace->next();
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, entries);
+}
+
+size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  if (repo._entries == 0) {
+    return 0;
+  }
+  repo.clear_table();
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -198,17 +211,32 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
+const JfrStackTrace* JfrStackTraceRepository::find_in_bucket(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace) {
+  while (table_entry != nullptr) {
+    if (table_entry->equals(stacktrace)) {
+      return table_entry;
+    }
+    table_entry = table_entry->next();
+  }
+  return nullptr;
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(stacktrace._nr_of_frames > 0, "invariant");
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
-  while (table_entry != nullptr) {
-    if (table_entry->equals(stacktrace)) {
+  {
+    // Most traces recorded are already in the table.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* const table_entry = find_in_bucket(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (table_entry != nullptr) {
       return table_entry->id();
     }
-    table_entry = table_entry->next();
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  const JfrStackTrace* const table_entry = find_in_bucket(_table[index], stacktrace);
+  if (table_entry != nullptr) {
+    return table_entry->id();
   }
 
   if (!stacktrace.have_lineno()) {
@@ -216,7 +244,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
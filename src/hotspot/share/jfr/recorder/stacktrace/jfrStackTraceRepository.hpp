@@ -57,6 +57,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool initialize();
 
   bool is_modified() const;
+  void clear_table();
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
   size_t write(JfrChunkWriter& cw, bool clear);
@@ -67,6 +68,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
   static traceid next_id();
 
+  static const JfrStackTrace* find_in_bucket(const JfrStackTrace* table_entry, const JfrStackTrace& stacktrace);
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
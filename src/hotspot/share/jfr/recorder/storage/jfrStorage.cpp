@@ -189,6 +189,26 @@ BufferPtr JfrStorage::acquire_promotion_buffer(size_t size, JfrStorageMspace* ms
   }
 }
 
+// Global buffers are preallocated to the live list and stay there for the
+// lifetime of the storage, so a thread can keep a reference to the buffer it
+// last promoted into and try that one first. Threads that flush at the same
+// time then tend to spread over different buffers instead of all contending
+// for the head of the live list.
+static BufferPtr acquire_preferred_promotion_buffer(size_t size, JfrStorageMspace* mspace, Thread* thread) {
+  BufferPtr const buffer = thread->jfr_thread_local()->promotion_buffer();
+  if (buffer == nullptr || buffer->retired() || !buffer->try_acquire(thread)) {
+    return nullptr;
+  }
+  assert(!buffer->retired(), "invariant");
+  assert(!buffer->transient(), "invariant");
+  if (buffer->free_size() >= size) {
+    return buffer;
+  }
+  buffer->set_retired();
+  mspace->register_full(buffer, thread);
+  return nullptr;
+}
+
 static const size_t lease_retry = 10;
 
 BufferPtr JfrStorage::acquire_large(size_t size, Thread* thread) {
@@ -246,7 +266,10 @@ bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
     return true;
   }
 
-  BufferPtr const promotion_buffer = acquire_promotion_buffer(unflushed_size, _global_mspace, *this, promotion_retry, thread);
+  BufferPtr promotion_buffer = acquire_preferred_promotion_buffer(unflushed_size, _global_mspace, thread);
+  if (promotion_buffer == nullptr) {
+    promotion_buffer = acquire_promotion_buffer(unflushed_size, _global_mspace, *this, promotion_retry, thread);
+  }
   if (promotion_buffer == nullptr) {
     write_data_loss(buffer, thread);
     return false;
@@ -258,6 +281,8 @@ bool JfrStorage::flush_regular_buffer(BufferPtr buffer, Thread* thread) {
   if (promotion_buffer->transient()) {
     promotion_buffer->set_retired();
     register_full(promotion_buffer, thread);
+  } else {
+    thread->jfr_thread_local()->set_promotion_buffer(promotion_buffer);
   }
   return true;
 }
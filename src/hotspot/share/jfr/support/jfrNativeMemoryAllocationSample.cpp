@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeMemoryAllocationSample.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+static const int64_t sample_interval_bytes = 512 * K;
+
+void JfrNativeMemoryAllocationSample::send_event(const void* address, size_t size, JNIEnv* env) {
+  if (address == nullptr || !EventNativeMemoryAllocationSample::is_enabled()) {
+    return;
+  }
+  JavaThread* const thread = JavaThread::thread_from_jni_environment(env);
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  const int64_t weight = tl->native_bytes_since_sample() + static_cast<int64_t>(size);
+  if (weight < sample_interval_bytes) {
+    tl->set_native_bytes_since_sample(weight);
+    return;
+  }
+  tl->set_native_bytes_since_sample(0);
+  // The stack trace is recorded in the VM; the Unsafe entries are leaves.
+  ThreadInVMfromNative tivm(thread);
+  debug_only(ResetNoHandleMark rnhm;)
+  HandleMark hm(thread);
+  EventNativeMemoryAllocationSample event;
+  if (event.should_commit()) {
+    event.set_address((uintptr_t)address);
+    event.set_size(size);
+    event.set_weight(weight);
+    event.commit();
+  }
+}
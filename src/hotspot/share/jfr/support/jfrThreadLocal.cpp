@@ -51,6 +51,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _java_buffer(nullptr),
   _native_buffer(nullptr),
   _shelved_buffer(nullptr),
+  _promotion_buffer(nullptr),
   _load_barrier_buffer_epoch_0(nullptr),
   _load_barrier_buffer_epoch_1(nullptr),
   _checkpoint_buffer_epoch_0(nullptr),
@@ -66,6 +67,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _stack_trace_hash(0),
   _parent_trace_id(0),
   _last_allocated_bytes(0),
+  _native_bytes_since_sample(0),
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
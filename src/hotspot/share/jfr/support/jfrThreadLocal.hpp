@@ -45,6 +45,7 @@ class JfrThreadLocal {
   mutable JfrBuffer* _java_buffer;
   mutable JfrBuffer* _native_buffer;
   JfrBuffer* _shelved_buffer;
+  JfrBuffer* _promotion_buffer;
   JfrBuffer* _load_barrier_buffer_epoch_0;
   JfrBuffer* _load_barrier_buffer_epoch_1;
   JfrBuffer* _checkpoint_buffer_epoch_0;
@@ -60,6 +61,7 @@ class JfrThreadLocal {
   traceid _stack_trace_hash;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
+  int64_t _native_bytes_since_sample;
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
@@ -125,6 +127,16 @@ class JfrThreadLocal {
     _shelved_buffer = buffer;
   }
 
+  // The global buffer last promoted into, tried first on the next promotion.
+  // Only a hint; the buffer is owned by the global mspace.
+  JfrBuffer* promotion_buffer() const {
+    return _promotion_buffer;
+  }
+
+  void set_promotion_buffer(JfrBuffer* buffer) {
+    _promotion_buffer = buffer;
+  }
+
   bool has_java_event_writer() const {
     return _java_event_writer != nullptr;
   }
@@ -163,6 +175,14 @@ class JfrThreadLocal {
     set_last_allocated_bytes(0);
   }
 
+  int64_t native_bytes_since_sample() const {
+    return _native_bytes_since_sample;
+  }
+
+  void set_native_bytes_since_sample(int64_t bytes) {
+    _native_bytes_since_sample = bytes;
+  }
+
   // Contextually defined thread id that is volatile,
   // a function of Java carrier thread mounts / unmounts.
   static traceid thread_id(const Thread* t);
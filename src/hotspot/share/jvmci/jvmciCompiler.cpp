@@ -43,6 +43,7 @@ JVMCICompiler::JVMCICompiler() : AbstractCompiler(compiler_jvmci) {
   _err_upcalls = 0;
   _disabled = false;
   _global_compilation_ticks = 0;
+  _java_heap_allocated_bytes = 0;
   assert(_instance == nullptr, "only one instance allowed");
   _instance = this;
 }
@@ -195,6 +196,7 @@ void JVMCICompiler::print_timers() {
   tty->print_cr("    JVMCI CompileBroker Time:");
   tty->print_cr("       Compile:        %7.3f s", stats()->total_time());
   _jit_code_installs.print_on(tty, "       Install Code:   ");
+  tty->print_cr("       Heap Allocated: %7.3f MB", (double) _java_heap_allocated_bytes / M);
   tty->cr();
   tty->print_cr("    JVMCI Hosted Time:");
   _hosted_code_installs.print_on(tty, "       Install Code:   ");
@@ -226,6 +228,10 @@ void JVMCICompiler::inc_methods_compiled() {
   Atomic::inc(&_global_compilation_ticks);
 }
 
+void JVMCICompiler::add_java_heap_allocated_bytes(jlong bytes) {
+  Atomic::add(&_java_heap_allocated_bytes, bytes);
+}
+
 void JVMCICompiler::on_upcall(const char* error, JVMCICompileState* compile_state) {
   if (error != nullptr) {
 
@@ -82,6 +82,11 @@ class JVMCICompiler : public AbstractCompiler {
   // to indicate JVMCI compilation activity.
   volatile int _global_compilation_ticks;
 
+  // Bytes allocated in the HotSpot heap by CompileBroker compilations.
+  // With a jarjvmci compiler this is the compiler's whole allocation;
+  // with libjvmci it only covers upcalls into the HotSpot heap.
+  volatile jlong _java_heap_allocated_bytes;
+
   static JVMCICompiler* _instance;
 
   CodeInstallStats _jit_code_installs;     // CompileBroker compilations
@@ -154,6 +159,10 @@ class JVMCICompiler : public AbstractCompiler {
   int global_compilation_ticks() const { return _global_compilation_ticks; }
   void inc_global_compilation_ticks();
 
+  // Accounts for HotSpot heap allocation done by a compilation.
+  void add_java_heap_allocated_bytes(jlong bytes);
+  jlong java_heap_allocated_bytes() const { return _java_heap_allocated_bytes; }
+
   CodeInstallStats* code_install_stats(bool hosted) {
     if (!hosted) {
       return &_jit_code_installs;
@@ -42,15 +42,35 @@
 using metaspace::ChunkManager;
 using metaspace::MetaspaceArena;
 using metaspace::ArenaGrowthPolicy;
+using metaspace::ArenaSizeHistory;
 using metaspace::RunningCounters;
 using metaspace::InternalStats;
 
 #define LOGFMT         "CLMS @" PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this)
 
-ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type) :
+// Returns the level of the first chunk for a new arena, or INVALID_CHUNK_LEVEL
+// to follow the growth policy. A prediction may only make the first chunk
+// smaller than the policy's, never larger.
+static metaspace::chunklevel_t predicted_first_chunk_level(const Klass* loader_klass,
+                                                           Metaspace::MetaspaceType space_type,
+                                                           bool is_class) {
+  if (loader_klass == nullptr) {
+    return metaspace::chunklevel::INVALID_CHUNK_LEVEL;
+  }
+  const metaspace::chunklevel_t predicted = ArenaSizeHistory::predicted_first_level(loader_klass, is_class);
+  if (predicted == metaspace::chunklevel::INVALID_CHUNK_LEVEL) {
+    return predicted;
+  }
+  const metaspace::chunklevel_t policy = ArenaGrowthPolicy::policy_for_space_type(space_type, is_class)->get_level_at_step(0);
+  return MAX2(predicted, policy);
+}
+
+ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type,
+                                           const Klass* loader_klass) :
   _lock(lock),
   _space_type(space_type),
+  _loader_klass(MetaspaceArenaSizePrediction ? loader_klass : nullptr),
   _non_class_space_arena(nullptr),
   _class_space_arena(nullptr)
 {
@@ -62,7 +82,8 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
       non_class_cm,
       ArenaGrowthPolicy::policy_for_space_type(space_type, false),
       RunningCounters::used_nonclass_counter(),
-      "non-class sm");
+      "non-class sm",
+      predicted_first_chunk_level(_loader_klass, space_type, false));
 
   // If needed, initialize class arena
   if (Metaspace::using_class_space()) {
@@ -72,7 +93,8 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
         class_cm,
         ArenaGrowthPolicy::policy_for_space_type(space_type, true),
         RunningCounters::used_class_counter(),
-        "class sm");
+        "class sm",
+        predicted_first_chunk_level(_loader_klass, space_type, true));
   }
 
   UL2(debug, "born (nonclass arena: " PTR_FORMAT ", class arena: " PTR_FORMAT ".",
@@ -82,6 +104,15 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
 ClassLoaderMetaspace::~ClassLoaderMetaspace() {
   UL(debug, "dies.");
   MutexLocker fcl(lock(), Mutex::_no_safepoint_check_flag);
+  if (_loader_klass != nullptr) {
+    size_t used_words;
+    _non_class_space_arena->usage_numbers(&used_words, nullptr, nullptr);
+    ArenaSizeHistory::record(_loader_klass, false, used_words);
+    if (_class_space_arena != nullptr) {
+      _class_space_arena->usage_numbers(&used_words, nullptr, nullptr);
+      ArenaSizeHistory::record(_loader_klass, true, used_words);
+    }
+  }
   delete _non_class_space_arena;
   delete _class_space_arena;
 
@@ -29,6 +29,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class Klass;
 class outputStream;
 
 namespace metaspace {
@@ -63,6 +64,10 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
 
   const Metaspace::MetaspaceType _space_type;
 
+  // Class of the owning class loader, used as a key into the ArenaSizeHistory.
+  // Only compared, never dereferenced. Null if not predicting.
+  const Klass* const _loader_klass;
+
   // Arena for allocations from non-class  metaspace
   //  (resp. for all allocations if -XX:-UseCompressedClassPointers).
   metaspace::MetaspaceArena* _non_class_space_arena;
@@ -77,7 +82,8 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
 
 public:
 
-  ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type);
+  ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType space_type,
+                       const Klass* loader_klass = nullptr);
 
   ~ClassLoaderMetaspace();
 
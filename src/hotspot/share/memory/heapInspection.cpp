@@ -117,6 +117,11 @@ void KlassInfoEntry::print_on(outputStream* st) const {
   }
 }
 
+void KlassInfoEntry::add_par(uint64_t ct, size_t wds) {
+  Atomic::add(&_instance_count, ct, memory_order_relaxed);
+  Atomic::add(&_instance_words, wds, memory_order_relaxed);
+}
+
 KlassInfoEntry* KlassInfoBucket::lookup(Klass* const k) {
   // Can happen if k is an archived class that we haven't loaded yet.
   if (k->java_mirror_no_keepalive() == nullptr) {
@@ -138,6 +143,41 @@ KlassInfoEntry* KlassInfoBucket::lookup(Klass* const k) {
   return elt;
 }
 
+KlassInfoEntry* KlassInfoBucket::lookup_par(Klass* const k) {
+  // Can happen if k is an archived class that we haven't loaded yet.
+  if (k->java_mirror_no_keepalive() == nullptr) {
+    return nullptr;
+  }
+
+  KlassInfoEntry* head = Atomic::load_acquire(&_list);
+  KlassInfoEntry* searched = nullptr;
+  KlassInfoEntry* new_elt = nullptr;
+  while (true) {
+    // Only the entries pushed since the last attempt need to be searched.
+    for (KlassInfoEntry* elt = head; elt != searched; elt = elt->next()) {
+      if (elt->is_equal(k)) {
+        delete new_elt;
+        return elt;
+      }
+    }
+    if (new_elt == nullptr) {
+      new_elt = new (std::nothrow) KlassInfoEntry(k, head);
+      // We may be out of space to allocate the new entry.
+      if (new_elt == nullptr) {
+        return nullptr;
+      }
+    } else {
+      new_elt->set_next(head);
+    }
+    KlassInfoEntry* witness = Atomic::cmpxchg(&_list, head, new_elt);
+    if (witness == head) {
+      return new_elt;
+    }
+    searched = head;
+    head = witness;
+  }
+}
+
 void KlassInfoBucket::iterate(KlassInfoClosure* cic) {
   KlassInfoEntry* elt = _list;
   while (elt != nullptr) {
@@ -210,6 +250,14 @@ KlassInfoEntry* KlassInfoTable::lookup(Klass* k) {
   return e;
 }
 
+KlassInfoEntry* KlassInfoTable::lookup_par(Klass* k) {
+  uint         idx = hash(k) % _num_buckets;
+  assert(_buckets != nullptr, "Allocation failure should have been caught");
+  KlassInfoEntry*  e   = _buckets[idx].lookup_par(k);
+  assert(e == nullptr || k == e->klass(), "must be equal");
+  return e;
+}
+
 // Return false if the entry could not be recorded on account
 // of running out of space required to create a new entry.
 bool KlassInfoTable::record_instance(const oop obj) {
@@ -254,6 +302,19 @@ bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
   return false;
 }
 
+// MT-safe version of merge_entry.
+bool KlassInfoTable::merge_entry_par(const KlassInfoEntry* cie) {
+  Klass*          k = cie->klass();
+  KlassInfoEntry* elt = lookup_par(k);
+  if (elt != nullptr) {
+    elt->add_par(cie->count(), cie->words());
+    Atomic::add(&_size_of_instances_in_words, cie->words(), memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+template <bool is_par>
 class KlassInfoTableMergeClosure : public KlassInfoClosure {
 private:
   KlassInfoTable* _dest;
@@ -261,14 +322,22 @@ class KlassInfoTableMergeClosure : public KlassInfoClosure {
 public:
   KlassInfoTableMergeClosure(KlassInfoTable* table) : _dest(table), _success(true) {}
   void do_cinfo(KlassInfoEntry* cie) {
-    _success &= _dest->merge_entry(cie);
+    _success &= is_par ? _dest->merge_entry_par(cie) : _dest->merge_entry(cie);
   }
   bool success() { return _success; }
 };
 
 // merge from table
 bool KlassInfoTable::merge(KlassInfoTable* table) {
-  KlassInfoTableMergeClosure closure(this);
+  KlassInfoTableMergeClosure<false> closure(this);
+  table->iterate(&closure);
+  return closure.success();
+}
+
+// merge from table, possibly concurrently with other threads
+// merging into this table.
+bool KlassInfoTable::merge_par(KlassInfoTable* table) {
+  KlassInfoTableMergeClosure<true> closure(this);
   table->iterate(&closure);
   return closure.success();
 }
@@ -553,10 +622,9 @@ void ParHeapInspectTask::work(uint worker_id) {
   RecordInstanceClosure ric(&cit, _filter);
   _poi->object_iterate(&ric, worker_id);
   missed_count = ric.missed_count();
-  {
-    MutexLocker x(&_mutex, Mutex::_no_safepoint_check_flag);
-    merge_success = _shared_cit->merge(&cit);
-  }
+  // Workers merge their local tables concurrently, without locking,
+  // so the merge does not serialize on the shared table.
+  merge_success = _shared_cit->merge_par(&cit);
   if (merge_success) {
     Atomic::add(&_missed_count, missed_count);
   } else {
@@ -67,12 +67,14 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   {}
   ~KlassInfoEntry();
   KlassInfoEntry* next() const   { return _next; }
+  void set_next(KlassInfoEntry* next) { _next = next; }
   bool is_equal(const Klass* k)  { return k == _klass; }
   Klass* klass()  const          { return _klass; }
   uint64_t count()    const      { return _instance_count; }
   void set_count(uint64_t ct)    { _instance_count = ct; }
   size_t words()  const          { return _instance_words; }
   void set_words(size_t wds)     { _instance_words = wds; }
+  void add_par(uint64_t ct, size_t wds);
   void set_index(int64_t index)  { _index = index; }
   int64_t index()    const       { return _index; }
   GrowableArray<KlassInfoEntry*>* subclasses() const { return _subclasses; }
@@ -97,6 +99,8 @@ class KlassInfoBucket: public CHeapObj<mtInternal> {
   void set_list(KlassInfoEntry* l) { _list = l; }
  public:
   KlassInfoEntry* lookup(Klass* k);
+  // Lock-free variant of lookup; entries are pushed with a CAS.
+  KlassInfoEntry* lookup_par(Klass* k);
   void initialize() { _list = nullptr; }
   void empty();
   void iterate(KlassInfoClosure* cic);
@@ -114,6 +118,7 @@ class KlassInfoTable: public StackObj {
   KlassInfoBucket* _buckets;
   uint hash(const Klass* p);
   KlassInfoEntry* lookup(Klass* k); // allocates if not found!
+  KlassInfoEntry* lookup_par(Klass* k); // MT-safe, allocates if not found!
 
   class AllClassesFinder;
 
@@ -126,6 +131,10 @@ class KlassInfoTable: public StackObj {
   size_t size_of_instances_in_words() const;
   bool merge(KlassInfoTable* table);
   bool merge_entry(const KlassInfoEntry* cie);
+  // MT-safe variants of merge, allowing several threads to merge
+  // into this table at the same time without locking.
+  bool merge_par(KlassInfoTable* table);
+  bool merge_entry_par(const KlassInfoEntry* cie);
 
   friend class KlassInfoHisto;
   friend class KlassHierarchy;
@@ -214,7 +223,6 @@ class ParHeapInspectTask : public WorkerTask {
   BoolObjectClosure* _filter;
   uintx _missed_count;
   bool _success;
-  Mutex _mutex;
 
  public:
   ParHeapInspectTask(ParallelObjectIterator* poi,
@@ -225,8 +233,7 @@ class ParHeapInspectTask : public WorkerTask {
       _shared_cit(shared_cit),
       _filter(filter),
       _missed_count(0),
-      _success(true),
-      _mutex(Mutex::nosafepoint, "ParHeapInspectTask_lock") {}
+      _success(true) {}
 
   uintx missed_count() const {
     return _missed_count;
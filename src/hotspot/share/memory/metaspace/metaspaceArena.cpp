@@ -53,6 +53,9 @@ namespace metaspace {
 // Returns the level of the next chunk to be added, acc to growth policy.
 chunklevel_t MetaspaceArena::next_chunk_level() const {
   const int growth_step = _chunks.count();
+  if (growth_step == 0 && _first_chunk_level != chunklevel::INVALID_CHUNK_LEVEL) {
+    return _first_chunk_level;
+  }
   return _growth_policy->get_level_at_step(growth_step);
 }
 
@@ -110,9 +113,11 @@ void MetaspaceArena::add_allocation_to_fbl(MetaWord* p, size_t word_size) {
 
 MetaspaceArena::MetaspaceArena(ChunkManager* chunk_manager, const ArenaGrowthPolicy* growth_policy,
                                SizeAtomicCounter* total_used_words_counter,
-                               const char* name) :
+                               const char* name,
+                               chunklevel_t first_chunk_level) :
   _chunk_manager(chunk_manager),
   _growth_policy(growth_policy),
+  _first_chunk_level(first_chunk_level),
   _chunks(),
   _fbl(nullptr),
   _total_used_words_counter(total_used_words_counter),
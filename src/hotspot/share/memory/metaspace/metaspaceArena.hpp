@@ -84,6 +84,9 @@ class MetaspaceArena : public CHeapObj<mtClass> {
   // Reference to the growth policy to use.
   const ArenaGrowthPolicy* const _growth_policy;
 
+  // If valid, overrides the growth policy for the first chunk.
+  const chunklevel_t _first_chunk_level;
+
   // List of chunks. Head of the list is the current chunk.
   MetachunkList _chunks;
 
@@ -133,7 +136,8 @@ class MetaspaceArena : public CHeapObj<mtClass> {
 
   MetaspaceArena(ChunkManager* chunk_manager, const ArenaGrowthPolicy* growth_policy,
                  SizeAtomicCounter* total_used_words_counter,
-                 const char* name);
+                 const char* name,
+                 chunklevel_t first_chunk_level = chunklevel::INVALID_CHUNK_LEVEL);
 
   ~MetaspaceArena();
 
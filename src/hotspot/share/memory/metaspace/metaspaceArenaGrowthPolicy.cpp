@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "memory/metaspace/metaspaceArenaGrowthPolicy.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 namespace metaspace {
@@ -122,5 +123,34 @@ const ArenaGrowthPolicy* ArenaGrowthPolicy::policy_for_space_type(Metaspace::Met
 
 }
 
+ArenaSizeHistory::Entry ArenaSizeHistory::_table[ArenaSizeHistory::table_size];
+
+ArenaSizeHistory::Entry* ArenaSizeHistory::entry_for(const void* key) {
+  const uintptr_t k = (uintptr_t)key;
+  return &_table[((k >> LogBytesPerWord) ^ (k >> 12)) % table_size];
+}
+
+void ArenaSizeHistory::record(const void* key, bool is_class, size_t used_words) {
+  Entry* e = entry_for(key);
+  if (Atomic::load(&e->_key) != key) {
+    Atomic::store(&e->_used_words[0], (size_t)0);
+    Atomic::store(&e->_used_words[1], (size_t)0);
+  }
+  Atomic::store(&e->_used_words[is_class ? 1 : 0], used_words);
+  Atomic::release_store(&e->_key, key);
+}
+
+chunklevel_t ArenaSizeHistory::predicted_first_level(const void* key, bool is_class) {
+  const Entry* e = entry_for(key);
+  if (Atomic::load_acquire(&e->_key) != key) {
+    return chunklevel::INVALID_CHUNK_LEVEL;
+  }
+  const size_t used_words = Atomic::load(&e->_used_words[is_class ? 1 : 0]);
+  if (used_words == 0) {
+    return chunklevel::INVALID_CHUNK_LEVEL;
+  }
+  return chunklevel::level_fitting_word_size(used_words);
+}
+
 } // namespace
 
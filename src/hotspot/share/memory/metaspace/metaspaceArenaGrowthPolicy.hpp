@@ -74,6 +74,36 @@ class ArenaGrowthPolicy {
 
 };
 
+// ArenaSizeHistory remembers how much space the arenas of recently unloaded
+// class loaders used, keyed by the class of the loader. Applications with many
+// short-lived loaders of the same class (one per script or plugin) can then
+// start new arenas with a first chunk that fits, rather than the one dictated
+// by the growth policy (see -XX:+MetaspaceArenaSizePrediction).
+//
+// The table is small and lossy: colliding keys overwrite each other, and racing
+// updates may mix up entries. Either only leads to a less fitting first chunk.
+class ArenaSizeHistory : public AllStatic {
+
+  static const int table_size = 64;
+
+  struct Entry {
+    const void* volatile _key;
+    volatile size_t _used_words[2]; // non-class, class
+  };
+  static Entry _table[table_size];
+
+  static Entry* entry_for(const void* key);
+
+public:
+
+  static void record(const void* key, bool is_class, size_t used_words);
+
+  // Returns the level of a chunk able to hold what the last arena with this key
+  // used, or INVALID_CHUNK_LEVEL if nothing is known.
+  static chunklevel_t predicted_first_level(const void* key, bool is_class);
+
+};
+
 } // namespace metaspace
 
 #endif // SHARE_MEMORY_METASPACE_METASPACEARENAGROWTHPOLICY_HPP
@@ -75,8 +75,8 @@
 #include "runtime/java.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/threads.hpp"
-#include "runtime/timerTrace.hpp"
 #include "sanitizers/leak.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/align.hpp"
@@ -856,7 +856,7 @@ jint universe_init() {
   guarantee(sizeof(oop) % sizeof(HeapWord) == 0,
             "oop size is not not a multiple of HeapWord size");
 
-  TraceTime timer("Genesis", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("Genesis");
 
   initialize_global_behaviours();
 
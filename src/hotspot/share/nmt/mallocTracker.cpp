@@ -66,7 +66,6 @@ void MallocMemorySnapshot::copy_to(MallocMemorySnapshot* s) {
   // copy is going on, because their size is adjusted using this
   // buffer in make_adjustment().
   ThreadCritical tc;
-  s->_all_mallocs = _all_mallocs;
   size_t total_size = 0;
   size_t total_count = 0;
   for (int index = 0; index < mt_number_of_tags; index ++) {
@@ -74,8 +73,38 @@ void MallocMemorySnapshot::copy_to(MallocMemorySnapshot* s) {
     total_size += s->_malloc[index].malloc_size();
     total_count += s->_malloc[index].malloc_count();
   }
-  // malloc counters may be updated concurrently
-  s->_all_mallocs.set_size_and_count(total_size, total_count);
+  if (total_size > _total_peak) {
+    _total_peak = total_size;
+    _total_peak_count = total_count;
+  }
+  s->_total_peak = _total_peak;
+  s->_total_peak_count = _total_peak_count;
+}
+
+size_t MallocMemorySnapshot::total() const {
+  size_t amount = 0;
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_tags; index ++) {
+    amount += _malloc[index].malloc_size() + _malloc[index].arena_size();
+    count += _malloc[index].malloc_count();
+  }
+  return amount + count * MallocHeader::malloc_overhead();
+}
+
+size_t MallocMemorySnapshot::total_malloc_size() const {
+  size_t amount = 0;
+  for (int index = 0; index < mt_number_of_tags; index ++) {
+    amount += _malloc[index].malloc_size();
+  }
+  return amount;
+}
+
+size_t MallocMemorySnapshot::total_count() const {
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_tags; index ++) {
+    count += _malloc[index].malloc_count();
+  }
+  return count;
 }
 
 // Total malloc'd memory used by arenas
@@ -93,7 +122,6 @@ void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
   int chunk_idx = NMTUtil::tag_to_index(mtChunk);
   _malloc[chunk_idx].record_free(arena_size);
-  _all_mallocs.deallocate(arena_size);
 }
 
 void MallocMemorySummary::initialize() {
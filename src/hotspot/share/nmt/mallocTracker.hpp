@@ -55,12 +55,6 @@ class MemoryCounter {
  public:
   MemoryCounter() : _count(0), _size(0), _peak_count(0), _peak_size(0) {}
 
-  inline void set_size_and_count(size_t size, size_t count) {
-    _size = size;
-    _count = count;
-    update_peak(size, count);
-  }
-
   inline void allocate(size_t sz) {
     size_t cnt = Atomic::add(&_count, size_t(1), memory_order_relaxed);
     if (sz > 0) {
@@ -150,11 +144,21 @@ class MallocMemorySnapshot {
   friend class MallocMemorySummary;
 
  private:
+  // The malloc totals are summed over the tags on demand: updating one
+  // counter shared by all tags on every malloc and free makes it a contended
+  // cache line.
   MallocMemory      _malloc[mt_number_of_tags];
-  MemoryCounter     _all_mallocs;
+  // Peak of the malloc totals, sampled whenever a snapshot is taken.
+  // Protected by ThreadCritical.
+  size_t            _total_peak;
+  size_t            _total_peak_count;
 
+  // Total malloc'd memory amount, excluding the malloc headers
+  size_t total_malloc_size() const;
 
  public:
+  MallocMemorySnapshot() : _total_peak(0), _total_peak_count(0) { }
+
   inline MallocMemory* by_type(MemTag mem_tag) {
     int index = NMTUtil::tag_to_index(mem_tag);
     return &_malloc[index];
@@ -166,27 +170,24 @@ class MallocMemorySnapshot {
   }
 
   inline size_t malloc_overhead() const {
-    return _all_mallocs.count() * MallocHeader::malloc_overhead();
+    return total_count() * MallocHeader::malloc_overhead();
   }
 
   // Total malloc invocation count
-  size_t total_count() const {
-    return _all_mallocs.count();
-  }
+  size_t total_count() const;
 
-  // Total malloc'd memory amount
-  size_t total() const {
-    return _all_mallocs.size() + malloc_overhead() + total_arena();
-  }
+  // Total malloc'd memory amount, summed in a single pass over the tags
+  size_t total() const;
 
-  // Total peak malloc
+  // Highest total malloc'd memory amount seen by a snapshot, excluding the
+  // malloc headers. Peaks between snapshots are missed.
   size_t total_peak() const {
-    return _all_mallocs.peak_size();
+    return _total_peak;
   }
 
-  // Total peak count
+  // Total malloc count at the time of the total peak
   size_t total_peak_count() const {
-    return _all_mallocs.peak_count();
+    return _total_peak_count;
   }
 
   // Total malloc'd memory used by arenas
@@ -221,12 +222,10 @@ class MallocMemorySummary : AllStatic {
 
    static inline void record_malloc(size_t size, MemTag mem_tag) {
      as_snapshot()->by_type(mem_tag)->record_malloc(size);
-     as_snapshot()->_all_mallocs.allocate(size);
    }
 
    static inline void record_free(size_t size, MemTag mem_tag) {
      as_snapshot()->by_type(mem_tag)->record_free(size);
-     as_snapshot()->_all_mallocs.deallocate(size);
    }
 
    static inline void record_new_arena(MemTag mem_tag) {
@@ -37,7 +37,7 @@ inline bool MallocMemorySummary::check_exceeds_limit(size_t s, MemTag mem_tag) {
   // Note: checks are ordered to have as little impact as possible on the standard code path,
   // when MallocLimit is unset, resp. it is set but we have reached no limit yet.
   // Somewhat expensive are:
-  // - as_snapshot()->total(), total malloc load (requires iteration over arena types)
+  // - as_snapshot()->total(), total malloc load (requires one iteration over the tags)
   // - VMError::is_error_reported() is a load from a volatile.
   if (MallocLimitHandler::have_limit()) {
 
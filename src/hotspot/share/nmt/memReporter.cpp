@@ -28,6 +28,7 @@
 #include "nmt/mallocTracker.hpp"
 #include "nmt/memTag.hpp"
 #include "nmt/memReporter.hpp"
+#include "nmt/memTracker.hpp"
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
@@ -70,13 +71,13 @@ void MemReporterBase::print_total(size_t reserved, size_t committed, size_t peak
   }
 }
 
-void MemReporterBase::print_malloc(const MemoryCounter* c, MemTag mem_tag) const {
+void MemReporterBase::print_malloc(const MemoryCounter* c, MemTag mem_tag, size_t sample_factor) const {
   const char* scale = current_scale();
   outputStream* out = output();
   const char* alloc_type = (mem_tag == mtThreadStack) ? "" : "malloc=";
 
-  const size_t amount = c->size();
-  const size_t count = c->count();
+  const size_t amount = c->size() * sample_factor;
+  const size_t count = c->count() * sample_factor;
 
   if (mem_tag != mtNone) {
     out->print("(%s" SIZE_FORMAT "%s type=%s", alloc_type,
@@ -93,11 +94,11 @@ void MemReporterBase::print_malloc(const MemoryCounter* c, MemTag mem_tag) const
 
   out->print(")");
 
-  size_t pk_amount = c->peak_size();
+  size_t pk_amount = c->peak_size() * sample_factor;
   if (pk_amount == amount) {
     out->print_raw(" (at peak)");
   } else if (pk_amount > amount) {
-    size_t pk_count = c->peak_count();
+    size_t pk_count = c->peak_count() * sample_factor;
     out->print(" (peak=" SIZE_FORMAT "%s #" SIZE_FORMAT ")",
         amount_in_current_scale(pk_amount), scale, pk_count);
   }
@@ -328,22 +329,34 @@ int MemDetailReporter::report_malloc_sites() {
 
   outputStream* out = output();
 
+  // With sampled call stacks, each site stands for sample_factor times what it
+  // recorded, and the unsampled remainder sits on the empty call stack.
+  const size_t sample_factor = MemTracker::malloc_stack_sample_interval();
+  if (sample_factor > 1) {
+    out->print_cr("(Malloc call stacks sampled 1 in " SIZE_FORMAT ", malloc site figures are estimates)",
+                  sample_factor);
+    out->cr();
+  }
+
   const MallocSite* malloc_site;
   int num_omitted = 0;
   while ((malloc_site = malloc_itr.next()) != nullptr) {
+    const NativeCallStack* stack = malloc_site->call_stack();
+    if (sample_factor > 1 && stack->is_empty()) {
+      continue;
+    }
     // Omit printing if the current value and the historic peak value both fall below the reporting scale threshold
-    if (amount_in_current_scale(MAX2(malloc_site->size(), malloc_site->peak_size())) == 0) {
+    if (amount_in_current_scale(MAX2(malloc_site->size(), malloc_site->peak_size()) * sample_factor) == 0) {
       num_omitted ++;
       continue;
     }
-    const NativeCallStack* stack = malloc_site->call_stack();
     _stackprinter.print_stack(stack);
     MemTag mem_tag = malloc_site->mem_tag();
     assert(NMTUtil::tag_is_valid(mem_tag) && mem_tag != mtNone,
       "Must have a valid memory tag");
     INDENT_BY(29,
       out->print("(");
-      print_malloc(malloc_site->counter(), mem_tag);
+      print_malloc(malloc_site->counter(), mem_tag, sample_factor);
       out->print_cr(")");
     )
     out->cr();
@@ -893,6 +906,18 @@ void MemDetailDiffReporter::diff_malloc_site(const NativeCallStack* stack, size_
 
   assert(stack != nullptr, "null stack");
 
+  // Scale sampled sites as in MemDetailReporter::report_malloc_sites()
+  const size_t sample_factor = MemTracker::malloc_stack_sample_interval();
+  if (sample_factor > 1) {
+    if (stack->is_empty()) {
+      return;
+    }
+    current_size *= sample_factor;
+    current_count *= sample_factor;
+    early_size *= sample_factor;
+    early_count *= sample_factor;
+  }
+
   if (diff_in_current_scale(current_size, early_size) == 0) {
       return;
   }
@@ -108,7 +108,8 @@ class MemReporterBase : public StackObj {
 
   // Print summary total, malloc and virtual memory
   void print_total(size_t reserved, size_t committed, size_t peak = 0) const;
-  void print_malloc(const MemoryCounter* c, MemTag mem_tag = mtNone) const;
+  // sample_factor scales the figures of a sampled malloc site into estimates.
+  void print_malloc(const MemoryCounter* c, MemTag mem_tag = mtNone, size_t sample_factor = 1) const;
   void print_virtual_memory(size_t reserved, size_t committed, size_t peak) const;
   void print_arena(const MemoryCounter* c) const;
 
@@ -49,6 +49,11 @@
 #endif
 
 NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
+#ifdef USE_LIBRARY_BASED_TLS_ONLY
+uint MemTracker::_malloc_stack_sample_counter = 0;
+#else
+THREAD_LOCAL uint MemTracker::_malloc_stack_sample_counter = 0;
+#endif
 
 MemBaseline MemTracker::_baseline;
 
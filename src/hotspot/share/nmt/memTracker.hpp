@@ -30,6 +30,7 @@
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "utilities/debug.hpp"
@@ -39,6 +40,11 @@
                     NativeCallStack(0) : FAKE_CALLSTACK)
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
+// Like CALLER_PC, but for malloc paths: in detail mode only sampled calls
+// pay for the stack walk (see NativeMemoryTrackingStackSampleInterval).
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail &&  \
+                           MemTracker::should_sample_malloc_stack()) ?    \
+                          NativeCallStack(1) : FAKE_CALLSTACK)
 
 class MemBaseline;
 
@@ -70,6 +76,23 @@ class MemTracker : AllStatic {
     return _tracking_level > NMT_off;
   }
 
+  // In detail mode, decides whether the current malloc captures its call
+  // stack. Unsampled allocations are still recorded, against the empty call
+  // stack, so summary accounting and frees stay exact.
+  static inline bool should_sample_malloc_stack() {
+    const uint interval = NativeMemoryTrackingStackSampleInterval;
+    if (interval <= 1) {
+      return true;
+    }
+    const uint n = ++_malloc_stack_sample_counter;
+    return (n % interval) == 0;
+  }
+
+  // Factor by which per-site malloc figures in detail reports are scaled.
+  static inline uint malloc_stack_sample_interval() {
+    return NativeMemoryTrackingStackSampleInterval;
+  }
+
   // Per-malloc overhead incurred by NMT, depending on the current NMT level
   static size_t overhead_per_malloc() {
     return enabled() ? MallocTracker::overhead_per_malloc() : 0;
@@ -275,6 +298,15 @@ class MemTracker : AllStatic {
  private:
   // Tracking level
   static NMT_TrackingLevel   _tracking_level;
+  // Counts malloc calls for call stack sampling in detail mode
+#ifdef USE_LIBRARY_BASED_TLS_ONLY
+  // Updated racily; lost updates only perturb the sampling rate.
+  static uint             _malloc_stack_sample_counter;
+#else
+  // A shared counter would be contended by all allocating threads. If
+  // built-in TLS is available, count per thread.
+  static THREAD_LOCAL uint _malloc_stack_sample_counter;
+#endif
   // Stored baseline
   static MemBaseline      _baseline;
   // Query lock
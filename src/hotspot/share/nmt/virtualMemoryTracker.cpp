@@ -160,8 +160,13 @@ bool ReservedMemoryRegion::add_committed_region(address addr, size_t size, const
     return true;
   }
 
-  // Couldn't merge with any regions - create a new region.
-  return add_committed_region(CommittedMemoryRegion(addr, size, stack));
+  // Couldn't merge with any regions - create a new region. It goes right
+  // after prev, so link it there rather than searching the sorted list again.
+  CommittedMemoryRegion rgn(addr, size, stack);
+  LinkedListNode<CommittedMemoryRegion>* node = (prev != nullptr) ?
+    _committed_regions.insert_after(rgn, prev) :
+    _committed_regions.insert_before(rgn, _committed_regions.head());
+  return node != nullptr;
 }
 
 bool ReservedMemoryRegion::remove_uncommitted_region(LinkedListNode<CommittedMemoryRegion>* node,
@@ -211,6 +216,11 @@ bool ReservedMemoryRegion::remove_uncommitted_region(address addr, size_t sz) {
   while (head != nullptr) {
     crgn = head->data();
 
+    // The list is sorted, nothing beyond this point overlaps del_rgn.
+    if (crgn->base() >= end) {
+      break;
+    }
+
     if (crgn->same_region(addr, sz)) {
       VirtualMemorySummary::record_uncommitted_memory(crgn->size(), mem_tag());
       _committed_regions.remove_after(prev);
@@ -504,9 +504,12 @@ bool ConstantPoolCache::can_archive_resolved_method(ResolvedMethodEntry* method_
     return false;
   }
 
-  if (CDSConfig::is_dumping_dynamic_archive()) {
-    // InstanceKlass::methods() has been resorted. We need to
-    // update the vtable_index in method_entry (not implemented)
+  if (CDSConfig::is_dumping_dynamic_archive() &&
+      method_entry->is_resolved(Bytecodes::_invokevirtual) && !method_entry->is_vfinal()) {
+    // InstanceKlass::methods() has been resorted, which may re-layout the vtable.
+    // We need to update the vtable_index in method_entry (not implemented).
+    // Entries that only refer to a Method* (invokespecial, invokeinterface and
+    // final invokevirtual) are not affected by the resorting.
     return false;
   }
 
@@ -31,6 +31,8 @@
 #include "compiler/compileLog.hpp"
 #include "interpreter/linkResolver.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "opto/callGenerator.hpp"
 #include "opto/parse.hpp"
@@ -57,6 +59,7 @@ InlineTree::InlineTree(Compile* c,
   _count_inlines = 0;
   _forced_inline = false;
 #endif
+  _uses_hot_inline_budget = false;
   if (caller_jvms != nullptr) {
     // Keep a private copy of the caller_jvms:
     _caller_jvms = new (C) JVMState(caller_jvms->method(), caller_tree->caller_jvms());
@@ -112,6 +115,13 @@ static bool is_unboxing_method(ciMethod* callee_method, Compile* C) {
   return C->eliminate_boxing() && callee_method->is_unboxing_method();
 }
 
+// Is the call site frequent relative to the invocations of its caller?
+static bool is_frequent_call_site(ciMethod* caller_method, ciCallProfile& profile) {
+  int call_site_count  = caller_method->scale_count(profile.count());
+  int invoke_count     = caller_method->interpreter_invocation_count();
+  return invoke_count > 0 && (double)call_site_count / (double)invoke_count >= InlineFrequencyRatio;
+}
+
 // positive filter: should callee be inlined?
 bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
                                int caller_bci, bool& should_delay, ciCallProfile& profile) {
@@ -185,6 +195,13 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   }
   if (size > max_inline_size) {
     if (max_inline_size > default_max_inline_size) {
+      if (freq >= InlineFrequencyRatio && size <= C->hot_inline_budget()) {
+        // Inline late, so that the call sites of the hot path get parsed first.
+        set_msg("hot method too big, inline budget");
+        _uses_hot_inline_budget = true;
+        should_delay = true;
+        return true;
+      }
       set_msg("hot method too big");
     } else {
       set_msg("too big");
@@ -375,6 +392,7 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
   }
 
   _forced_inline = false; // Reset
+  _uses_hot_inline_budget = false;
 
   // 'should_delay' can be overridden during replay compilation
   if (!should_inline(callee_method, caller_method, caller_bci, should_delay, profile)) {
@@ -430,11 +448,18 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     return false;
   }
   if (inline_level() > _max_inline_level) {
-    if (!callee_method->force_inline() || !IncrementalInline) {
+    if (callee_method->force_inline() && IncrementalInline) {
+      if (!C->inlining_incrementally()) {
+        should_delay = true;
+      }
+    } else if (is_frequent_call_site(caller_method, profile) &&
+               callee_method->code_size_for_inlining() <= C->hot_inline_budget()) {
+      set_msg("inlining too deep, inline budget");
+      _uses_hot_inline_budget = true;
+      should_delay = true;
+    } else {
       set_msg("inlining too deep");
       return false;
-    } else if (!C->inlining_incrementally()) {
-      should_delay = true;
     }
   }
 
@@ -482,6 +507,10 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     }
   }
 
+  if (_uses_hot_inline_budget) {
+    C->spend_hot_inline_budget(size);
+  }
+
   // ok, inline this method
   return true;
 }
@@ -548,6 +577,18 @@ void InlineTree::print_inlining(ciMethod* callee_method, int caller_bci,
   }
   CompileTask::print_inlining_ul(callee_method, inline_level(),
                                  caller_bci, inlining_result_of(success), inline_msg);
+  // One key=value record per decision, for tools that post-process inlining.
+  LogTarget(Trace, jit, inlining) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("inline_decision compile_id=%d caller=", C->compile_id());
+    caller_method->print_short_name(&ls);
+    ls.print(" bci=%d callee=", caller_bci);
+    callee_method->print_short_name(&ls);
+    ls.print_cr(" level=%d size=%d result=%s reason=\"%s\" hot_inline_budget=%d",
+                inline_level(), callee_method->is_loaded() ? callee_method->code_size() : -1, success ? "success" : "failure",
+                inline_msg, C->hot_inline_budget());
+  }
   if (C->print_inlining()) {
     C->print_inlining(callee_method, inline_level(), caller_bci, inlining_result_of(success), inline_msg);
     guarantee(callee_method != nullptr, "would crash in CompilerEvent::InlineEvent::post");
@@ -338,6 +338,13 @@
   develop(bool, TraceLoopUnswitching, false,                                \
           "Trace loop unswitching")                                         \
                                                                             \
+  product(uint, LoopUnswitchingNodeLimit, 0, EXPERIMENTAL,                  \
+          "Do not unswitch a loop on another invariant condition if all "   \
+          "its unswitched versions together would exceed this many nodes, " \
+          "or if the profile shows the loop version is rarely entered. "    \
+          "0 means no limit")                                               \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally suppress vectorization set in VectorizeMethod")         \
                                                                             \
@@ -347,6 +354,11 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(bool, SuperWordOrderedFPReductions, true, DIAGNOSTIC,             \
+          "Enable superword for float and double add and mul reductions, "  \
+          "which must be computed in strict order. Can be set per method "  \
+          "with CompileCommand or compiler directives.")                    \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -399,6 +411,12 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(intx, PolymorphicInlineWidth, 2, EXPERIMENTAL,                    \
+          "Profiling based inlining for up to this many receivers at "      \
+          "polymorphic call sites; other receivers use a virtual call. "    \
+          "Receivers beyond TypeProfileWidth are not profiled")             \
+          range(2, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -673,6 +691,12 @@
           "The maximum bytecode size of a frequent method to be inlined")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, HotCallSiteInlineBudget, 0, EXPERIMENTAL,                   \
+          "Bytecode budget per compilation for late inlining of frequent "  \
+          "call sites that are over FreqInlineSize or MaxInlineLevel. "     \
+          "0 disables")                                                     \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MaxTrivialSize, 6,                                          \
           "The maximum bytecode size of a trivial method to be inlined by " \
           "high tier compiler")                                             \
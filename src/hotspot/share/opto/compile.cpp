@@ -41,6 +41,7 @@
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm_io.h"
+#include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
@@ -679,6 +680,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _java_calls(0),
                   _inner_loops(0),
                   _interpreter_frame_size(0),
+                  _current_phase_name(nullptr),
                   _output(nullptr)
 #ifndef PRODUCT
                   , _in_dump_cnt(0)
@@ -947,6 +949,7 @@ Compile::Compile( ciEnv* ci_env,
     _java_calls(0),
     _inner_loops(0),
     _interpreter_frame_size(0),
+    _current_phase_name(nullptr),
     _output(nullptr),
 #ifndef PRODUCT
     _in_dump_cnt(0),
@@ -1057,6 +1060,7 @@ void Compile::Init(bool aliasing) {
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
+  _hot_inline_budget = IncrementalInline ? (int)HotCallSiteInlineBudget : 0;
   set_do_scheduling(OptoScheduling);
 
   set_do_vector_loop(false);
@@ -2921,6 +2925,14 @@ void Compile::Code_Gen() {
   // nodes.  Mapping is only valid at the root of each matched subtree.
   NOT_PRODUCT( verify_graph_edges(); )
 
+  // Wall time of the expensive backend phases for this compilation.  The
+  // accumulated timers above only tell how much time all compilations
+  // spent in a phase, not which methods paid for it.
+  const bool log_backend = log_is_enabled(Debug, jit, compilation);
+  elapsedTimer gcm_timer;
+  elapsedTimer regalloc_timer;
+  elapsedTimer output_timer;
+
   Matcher matcher;
   _matcher = &matcher;
   {
@@ -2947,7 +2959,9 @@ void Compile::Code_Gen() {
   _cfg = &cfg;
   {
     TracePhase tp("scheduler", &timers[_t_scheduler]);
+    if (log_backend) gcm_timer.start();
     bool success = cfg.do_global_code_motion();
+    if (log_backend) gcm_timer.stop();
     if (!success) {
       return;
     }
@@ -2964,7 +2978,9 @@ void Compile::Code_Gen() {
     // Perform register allocation.  After Chaitin, use-def chains are
     // no longer accurate (at spill code) and so must be ignored.
     // Node->LRG->reg mappings are still accurate.
+    if (log_backend) regalloc_timer.start();
     _regalloc->Register_Allocate();
+    if (log_backend) regalloc_timer.stop();
 
     // Bail out if the allocator builds too many nodes
     if (failing()) {
@@ -3010,13 +3026,23 @@ void Compile::Code_Gen() {
   // Convert Nodes to instruction bits in a buffer
   {
     TracePhase tp("output", &timers[_t_output]);
+    if (log_backend) output_timer.start();
     PhaseOutput output;
     output.Output();
     if (failing())  return;
     output.install();
+    if (log_backend) output_timer.stop();
     print_method(PHASE_FINAL_CODE, 1); // Compile::_output is not null here
   }
 
+  if (log_backend) {
+    log_debug(jit, compilation)("%d: backend nodes=%u blocks=%u gcm=%.3fms regalloc=%.3fms output=%.3fms",
+                                compile_id(), unique(), cfg.number_of_blocks(),
+                                gcm_timer.seconds() * MILLIUNITS,
+                                regalloc_timer.seconds() * MILLIUNITS,
+                                output_timer.seconds() * MILLIUNITS);
+  }
+
   // He's dead, Jim.
   _cfg     = (PhaseCFG*)((intptr_t)0xdeadbeef);
   _regalloc = (PhaseChaitin*)((intptr_t)0xdeadbeef);
@@ -4352,9 +4378,14 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
     _compile(Compile::current()),
     _log(nullptr),
     _phase_name(name),
+    _prior_phase_name(nullptr),
     _dolog(CITimeVerbose)
 {
   assert(_compile != nullptr, "sanity check");
+  // Remember the phase so that the compilation memory statistic can attribute
+  // the arena peak to it.
+  _prior_phase_name = _compile->current_phase_name();
+  _compile->set_current_phase_name(_phase_name);
   if (_dolog) {
     _log = _compile->log();
   }
@@ -4366,6 +4397,7 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
 }
 
 Compile::TracePhase::~TracePhase() {
+  _compile->set_current_phase_name(_prior_phase_name);
   if (_compile->failing()) return;
 #ifdef ASSERT
   if (PrintIdealNodeCount) {
@@ -240,6 +240,7 @@ class Compile : public Phase {
     Compile*    _compile;
     CompileLog* _log;
     const char* _phase_name;
+    const char* _prior_phase_name;
     bool _dolog;
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
@@ -313,6 +314,7 @@ class Compile : public Phase {
   // Control of this compilation.
   int                   _max_inline_size;       // Max inline size for this compilation
   int                   _freq_inline_size;      // Max hot method inline size for this compilation
+  int                   _hot_inline_budget;     // Remaining bytecodes for inlining hot call sites over the limits
   int                   _fixed_slots;           // count of frame slots not allocated by the register
                                                 // allocator i.e. locks, original deopt pc, etc.
   uintx                 _max_node_limit;        // Max unique node count during a single compilation.
@@ -560,6 +562,7 @@ class Compile : public Phase {
   Arena*                _indexSet_arena;        // control IndexSet allocation within PhaseChaitin
   void*                 _indexSet_free_block_list; // free list of IndexSet bit blocks
   int                   _interpreter_frame_size;
+  const char*           _current_phase_name;    // Innermost TracePhase in effect, or null
 
   PhaseOutput*          _output;
 
@@ -573,6 +576,9 @@ class Compile : public Phase {
 
   int interpreter_frame_size() const            { return _interpreter_frame_size; }
 
+  const char*       current_phase_name() const  { return _current_phase_name; }
+  void              set_current_phase_name(const char* n) { _current_phase_name = n; }
+
   PhaseOutput*      output() const              { return _output; }
   void              set_output(PhaseOutput* o)  { _output = o; }
 
@@ -627,6 +633,11 @@ class Compile : public Phase {
   void          set_freq_inline_size(int n)     { _freq_inline_size = n; }
   int               freq_inline_size() const    { return _freq_inline_size; }
   void          set_max_inline_size(int n)      { _max_inline_size = n; }
+  int               hot_inline_budget() const   { return _hot_inline_budget; }
+  void        spend_hot_inline_budget(int size) {
+    assert(size <= _hot_inline_budget, "over budget");
+    _hot_inline_budget -= size;
+  }
   bool              has_loops() const           { return _has_loops; }
   void          set_has_loops(bool z)           { _has_loops = z; }
   bool              has_split_ifs() const       { return _has_split_ifs; }
@@ -104,7 +104,7 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   // Note: When we get profiling during stage-1 compiles, we want to pull
   // from more specific profile data which pertains to this inlining.
   // Right now, ignore the information in jvms->caller(), and do method[bci].
-  ciCallProfile profile = caller->call_profile_at_bci(bci);
+  ciCallProfile profile = caller->call_profile_at_bci(bci, (int)PolymorphicInlineWidth);
 
   // See how many times this site has been invoked.
   int site_count = profile.count();
@@ -245,9 +245,16 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      // Polymorphic site with more hot receivers than bimorphic inlining handles:
+      // chain type checks for the profiled receivers and use a virtual call
+      // for the rest.
+      bool polymorphic_inline = PolymorphicInlineWidth > 2 &&
+                                speculative_receiver_type == nullptr &&
+                                morphism != 1 && morphism != 2 &&
+                                profile.has_receiver(2);
       if (receiver_method == nullptr &&
           (have_major_receiver || morphism == 1 ||
-           (morphism == 2 && UseBimorphicInlining))) {
+           (morphism == 2 && UseBimorphicInlining) || polymorphic_inline)) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
@@ -299,6 +306,38 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
               // We don't need to record dependency on a receiver here and below.
               // Whenever we inline, the dependency is added by Parse::Parse().
               miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, PROB_MAX);
+            } else if (polymorphic_inline) {
+              // Build the chain inside out so that the most frequent receivers are
+              // tested first. Each check is taken with the probability of its
+              // receiver among the calls that missed all previous checks.
+              int remaining_count = site_count;
+              for (int i = 0; i < profile.morphism_limit() && profile.has_receiver(i); i++) {
+                remaining_count -= profile.receiver_count(i);
+              }
+              for (int i = profile.morphism_limit() - 1; i >= 1 && miss_cg != nullptr; i--) {
+                if (!profile.has_receiver(i)) {
+                  continue;
+                }
+                int rcount = profile.receiver_count(i);
+                remaining_count += rcount;
+                ciMethod* poly_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                                        profile.receiver(i));
+                if (poly_receiver_method == nullptr) {
+                  continue;
+                }
+                CallGenerator* poly_hit_cg = this->call_generator(poly_receiver_method,
+                                                                  vtable_index, !call_does_dispatch, jvms,
+                                                                  allow_inline, prof_factor);
+                if (poly_hit_cg == nullptr || !poly_hit_cg->is_inline()) {
+                  // A type check in front of an out-of-line call buys nothing
+                  // over the virtual call.
+                  continue;
+                }
+                trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), poly_receiver_method, profile.receiver(i), site_count, rcount);
+                float poly_prob = (remaining_count > 0) ? (float)rcount / (float)remaining_count : PROB_FAIR;
+                poly_prob = MIN2(MAX2(poly_prob, PROB_MIN), PROB_MAX);
+                miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, poly_hit_cg, poly_prob);
+              }
             }
             if (miss_cg != nullptr) {
               ciKlass* k = speculative_receiver_type != nullptr ? speculative_receiver_type : profile.receiver(0);
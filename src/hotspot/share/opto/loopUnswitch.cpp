@@ -88,6 +88,42 @@
 //    Endloop                           Endloop
 
 
+// Estimate how often an unswitched loop version is entered, relative to the loop before it was unswitched, from the
+// profile of the loop selector Ifs above it. Gives up (and assumes the version is hot) if the chain of loop selectors
+// cannot be followed.
+static float unswitched_loop_version_probability(LoopNode* head) {
+  float prob = 1.0f;
+  Node* entry = head->skip_strip_mined()->in(LoopNode::EntryControl);
+  for (int i = 0; i < head->unswitch_count(); i++) {
+    const Predicates predicates(entry);
+    Node* proj = predicates.entry();
+    if (!proj->is_IfProj() || !proj->in(0)->is_If()) {
+      return 1.0f;
+    }
+    IfNode* selector = proj->in(0)->as_If();
+    if (selector->_prob == PROB_UNKNOWN) {
+      return 1.0f;
+    }
+    prob *= proj->is_IfTrue() ? selector->_prob : (1.0f - selector->_prob);
+    entry = selector->in(0);
+  }
+  return prob;
+}
+
+// With several invariant conditions, each unswitching doubles the number of loop versions. Only unswitch (again) if the
+// versions stay within LoopUnswitchingNodeLimit and if this version is entered often enough to be worth it.
+static bool should_unswitch_again(const IdealLoopTree* loop, LoopNode* head) {
+  if (LoopUnswitchingNodeLimit == 0) {
+    return true;
+  }
+  const uint versions = 1u << (head->unswitch_count() + 1);
+  if ((julong)loop->_body.size() * versions > LoopUnswitchingNodeLimit) {
+    return false;
+  }
+  return head->unswitch_count() == 0 ||
+         unswitched_loop_version_probability(head) >= PROB_UNLIKELY_MAG(2);
+}
+
 // Return true if the loop should be unswitched or false otherwise.
 bool IdealLoopTree::policy_unswitching(PhaseIdealLoop* phase) const {
   if (!LoopUnswitching) {
@@ -109,6 +145,9 @@ bool IdealLoopTree::policy_unswitching(PhaseIdealLoop* phase) const {
   if (head->unswitch_count() + 1 > head->unswitch_max()) {
     return false;
   }
+  if (!should_unswitch_again(this, head)) {
+    return false;
+  }
   if (phase->find_unswitch_candidate(this) == nullptr) {
     return false;
   }
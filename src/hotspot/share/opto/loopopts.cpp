@@ -680,6 +680,15 @@ Node *PhaseIdealLoop::convert_add_to_muladd(Node* n) {
   return nn;
 }
 
+#ifndef PRODUCT
+static void trace_if_conversion(IdealLoopTree* loop, const char* result) {
+  if (Compile::current()->directive()->trace_auto_vectorization_tags().at(TraceAutoVectorizationTag::IF_CONVERSION)) {
+    tty->print("IfConversion %s: ", result);
+    loop->dump_head();
+  }
+}
+#endif
+
 //------------------------------conditional_move-------------------------------
 // Attempt to replace a Phi with a conditional move.  We have some pretty
 // strict profitability requirements.  All Phis at the merge point must
@@ -688,6 +697,12 @@ Node *PhaseIdealLoop::convert_add_to_muladd(Node* n) {
 // of the CFG diamond is now speculatively executed.  This code has to be
 // "cheap enough".  We are pretty much limited to CFG diamonds that merge
 // 1 or 2 items with a total of 1 or 2 ops executed speculatively.
+//
+// With UseVectorCmov, diamonds in innermost counted loops are if-converted
+// regardless of branch probability and with a higher cost limit, so that
+// SuperWord can vectorize the loop with VectorBlends.  Diamonds that merge
+// memory (conditional stores) are never converted: that would need masked
+// vector stores.
 Node *PhaseIdealLoop::conditional_move( Node *region ) {
 
   assert(region->is_Region(), "sanity check");
@@ -710,6 +725,10 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   assert(r_loop == get_loop(iff), "sanity");
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
+  // If-convert for vectorization, with relaxed profitability checks.
+  // Oops are not blended by SuperWord; see the T_OBJECT case below.
+  bool for_vectorization = UseSuperWord && UseVectorCmov && !used_inside_loop &&
+                           r_loop->is_innermost() && r_loop->_head->is_CountedLoop();
 
   // Check profitability
   int cost = 0;
@@ -750,10 +769,12 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
       // Just Say No to Conditionally-Moved Derived Pointers.
       if (tp && tp->offset() != 0)
         return nullptr;
+      for_vectorization = false;
       cost++;
       break;
     }
     default:
+      NOT_PRODUCT(if (for_vectorization) trace_if_conversion(r_loop, "rejected (merges memory or I/O)");)
       return nullptr;              // In particular, can't do memory or I/O
     }
     // Add in cost any speculative ops
@@ -796,15 +817,27 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   assert(bol->Opcode() == Op_Bool, "Unexpected node");
   int cmp_op = bol->in(1)->Opcode();
   if (cmp_op == Op_SubTypeCheck) { // SubTypeCheck expansion expects an IfNode
+    NOT_PRODUCT(if (for_vectorization) trace_if_conversion(r_loop, "rejected (SubTypeCheck)");)
     return nullptr;
   }
   // It is expensive to generate flags from a float compare.
   // Avoid duplicated float compare.
-  if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return nullptr;
+  if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
+    NOT_PRODUCT(if (for_vectorization) trace_if_conversion(r_loop, "rejected (duplicated float compare)");)
+    return nullptr;
+  }
 
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
-  if (used_inside_loop) {
+  if (for_vectorization) {
+    // The speculative ops run once per vector rather than once per element,
+    // so allow more of them than for a scalar CMove.
+    if (cost >= 2 * ConditionalMoveLimit) {
+      NOT_PRODUCT(trace_if_conversion(r_loop, "rejected (too costly)");)
+      return nullptr;
+    }
+    NOT_PRODUCT(trace_if_conversion(r_loop, "accepted");)
+  } else if (used_inside_loop) {
     if (cost >= ConditionalMoveLimit) return nullptr; // Too much goo
 
     // BlockLayoutByFrequency optimization moves infrequent branch
@@ -816,7 +849,7 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   }
   // Check for highly predictable branch.  No point in CMOV'ing if
   // we are going to predict accurately all the time.
-  if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
+  if (for_vectorization || (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD))) {
     //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
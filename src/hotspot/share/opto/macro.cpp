@@ -27,6 +27,8 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
 #include "libadt/vectset.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/universe.hpp"
 #include "opto/addnode.hpp"
 #include "opto/arraycopynode.hpp"
@@ -1108,6 +1110,22 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
 
   process_users_of_allocation(alloc);
 
+  // Report the allocation site, so that eliminated allocations can be
+  // matched against allocation profiles (e.g. JFR ObjectAllocationSample).
+  LogTarget(Debug, jit, compilation) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("%d: eliminated %s ", C->compile_id(), alloc->is_AllocateArray() ? "array allocation" : "allocation");
+    tklass->exact_klass()->print_name_on(&ls);
+    JVMState* jvms = alloc->jvms();
+    if (jvms != nullptr) {
+      ls.print(" at ");
+      jvms->method()->print_short_name(&ls);
+      ls.print("@%d", jvms->bci());
+    }
+    ls.cr();
+  }
+
 #ifndef PRODUCT
   if (PrintEliminateAllocations) {
     if (alloc->is_AllocateArray())
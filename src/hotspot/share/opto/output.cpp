@@ -34,6 +34,7 @@
 #include "compiler/oopMap.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/c2/barrierSetC2.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/allocation.hpp"
 #include "opto/ad.hpp"
@@ -1827,6 +1828,24 @@ void PhaseOutput::fill_buffer(C2_MacroAssembler* masm, uint* blk_starts) {
   } // End of for all blocks
   blk_starts[nblocks] = current_offset;
 
+  // Report how much of the code is in the trailing run of uncommon blocks
+  // (uncommon traps, slow paths, exception handlers) which block layout
+  // moved to the end, i.e. code that rarely shares the i-cache with the
+  // hot part of the method.
+  if (log_is_enabled(Debug, jit, compilation)) {
+    uint cold_start = nblocks;
+    while (cold_start > 0) {
+      Block* block = C->cfg()->get_block(cold_start - 1);
+      if (!(block->is_connector() || C->cfg()->is_uncommon(block))) {
+        break;
+      }
+      cold_start--;
+    }
+    log_debug(jit, compilation)("%d: code layout hot=%u cold=%u bytes",
+                                C->compile_id(), blk_starts[cold_start],
+                                blk_starts[nblocks] - blk_starts[cold_start]);
+  }
+
   non_safepoints.flush_at_end();
 
   // Offset too large?
@@ -138,6 +138,7 @@ class InlineTree : public AnyObj {
 
   bool        _forced_inline;     // Inlining was forced by CompilerOracle, ciReplay or annotation
   bool        forced_inline()     const { return _forced_inline; }
+  bool        _uses_hot_inline_budget; // Inlining is paid for by Compile::hot_inline_budget()
   // Count number of nodes in this subtree
   int         count() const;
   // Dump inlining replay data to the stream.
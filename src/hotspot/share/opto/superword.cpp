@@ -1567,6 +1567,11 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
       // Length 2 reductions of INT/LONG do not offer performance benefits
       if (((arith_type->basic_type() == T_INT) || (arith_type->basic_type() == T_LONG)) && (size == 2)) {
         retValue = false;
+      } else if (is_ordered_fp_reduction_opcode(opc) &&
+                 !phase()->C->directive()->SuperWordOrderedFPReductionsOption) {
+        // Auto-vectorized float/double add/mul reductions are computed in
+        // strict order, which may not pay off. This can be disabled per method.
+        retValue = false;
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
       }
@@ -1595,6 +1600,12 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
   return retValue;
 }
 
+// Float/double add and mul reductions are not associative, so their vector
+// forms must keep the sequential order of the scalar loop.
+bool SuperWord::is_ordered_fp_reduction_opcode(int opc) {
+  return opc == Op_AddF || opc == Op_AddD || opc == Op_MulF || opc == Op_MulD;
+}
+
 // Find the maximal implemented size smaller or equal to the packs size
 uint SuperWord::max_implemented_size(const Node_List* pack) {
   uint size = round_down_power_of_2(pack->size());
@@ -606,6 +606,8 @@ class SuperWord : public ResourceObj {
 
   // Can code be generated for the pack, restricted to size nodes?
   bool implemented(const Node_List* pack, const uint size) const;
+  // Is opc a float/double reduction that must be computed in strict order?
+  static bool is_ordered_fp_reduction_opcode(int opc);
   // Find the maximal implemented size smaller or equal to the packs size
   uint max_implemented_size(const Node_List* pack);
 
@@ -37,6 +37,7 @@
   flags(TYPES,                "Trace VLoopTypes") \
   flags(POINTERS,             "Trace VLoopPointers") \
   flags(DEPENDENCY_GRAPH,     "Trace VLoopDependencyGraph") \
+  flags(ALIASING,             "Trace dependencies between memops on possibly aliasing bases") \
   flags(SW_ADJACENT_MEMOPS,   "Trace SuperWord::find_adjacent_memop_pairs") \
   flags(SW_REJECTIONS,        "Trace SuperWord rejections (non vectorizations)") \
   flags(SW_PACKSET,           "Trace SuperWord packset at different stages") \
@@ -44,6 +45,7 @@
   flags(SW_VERBOSE,           "Trace SuperWord verbose (all SW tags enabled)") \
   flags(ALIGN_VECTOR,         "Trace AlignVector") \
   flags(VTRANSFORM,           "Trace VTransform Graph") \
+  flags(IF_CONVERSION,        "Trace if-conversion of loop diamonds for vectorization") \
   flags(ALL,                  "Trace everything (very verbose)")
 
 #define table_entry(name, description) name,
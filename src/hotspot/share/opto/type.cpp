@@ -3267,7 +3267,7 @@ TypeInterfaces::TypeInterfaces(ciInstanceKlass** interfaces_base, int nb_interfa
   initialize();
 }
 
-const TypeInterfaces* TypeInterfaces::make(GrowableArray<ciInstanceKlass*>* interfaces) {
+const TypeInterfaces* TypeInterfaces::make(const GrowableArrayView<ciInstanceKlass*>* interfaces) {
   // hashcons() can only delete the last thing that was allocated: to
   // make sure all memory for the newly created TypeInterfaces can be
   // freed if an identical one exists, allocate space for the array of
@@ -3390,7 +3390,8 @@ void TypeInterfaces::verify() const {
 #endif
 
 const TypeInterfaces* TypeInterfaces::union_with(const TypeInterfaces* other) const {
-  GrowableArray<ciInstanceKlass*> result_list;
+  // Types rarely have more than a few interfaces, keep them off the resource area.
+  InlineGrowableArray<ciInstanceKlass*, 8> result_list;
   int i = 0;
   int j = 0;
   while (i < _interfaces.length() || j < other->_interfaces.length()) {
@@ -3431,7 +3432,7 @@ const TypeInterfaces* TypeInterfaces::union_with(const TypeInterfaces* other) co
 }
 
 const TypeInterfaces* TypeInterfaces::intersection_with(const TypeInterfaces* other) const {
-  GrowableArray<ciInstanceKlass*> result_list;
+  InlineGrowableArray<ciInstanceKlass*, 8> result_list;
   int i = 0;
   int j = 0;
   while (i < _interfaces.length() || j < other->_interfaces.length()) {
@@ -892,7 +892,7 @@ class TypeInterfaces : public Type {
 
   NONCOPYABLE(TypeInterfaces);
 public:
-  static const TypeInterfaces* make(GrowableArray<ciInstanceKlass*>* interfaces = nullptr);
+  static const TypeInterfaces* make(const GrowableArrayView<ciInstanceKlass*>* interfaces = nullptr);
   bool eq(const Type* other) const;
   bool eq(ciInstanceKlass* k) const;
   uint hash() const;
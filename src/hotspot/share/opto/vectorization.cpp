@@ -268,6 +268,15 @@ void VLoopDependencyGraph::construct() {
         if (!VPointer::not_equal(p1.cmp(p2))) {
           // Possibly overlapping memory
           memory_pred_edges.append(_body.bb_idx(n2));
+#ifndef PRODUCT
+          if (_vloop.is_trace_aliasing() && p1.base() != p2.base()) {
+            // Different bases (e.g. two int[] parameters) may be the same
+            // object at runtime, so the memops are conservatively ordered.
+            tty->print_cr("VLoopDependencyGraph::construct: possible aliasing between N%d %s (base N%d) and N%d %s (base N%d)",
+                          n1->_idx, n1->Name(), p1.base() == nullptr ? -1 : (int)p1.base()->_idx,
+                          n2->_idx, n2->Name(), p2.base() == nullptr ? -1 : (int)p2.base()->_idx);
+          }
+#endif
         }
       }
       if (memory_pred_edges.is_nonempty()) {
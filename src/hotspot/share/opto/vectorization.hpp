@@ -159,6 +159,10 @@ class VLoop : public StackObj {
     return _vtrace.is_trace(TraceAutoVectorizationTag::DEPENDENCY_GRAPH);
   }
 
+  bool is_trace_aliasing() const {
+    return _vtrace.is_trace(TraceAutoVectorizationTag::ALIASING);
+  }
+
   bool is_trace_vpointers() const {
     return _vtrace.is_trace(TraceAutoVectorizationTag::POINTERS);
   }
@@ -2581,6 +2581,19 @@ DEFINE_GETSCALARARRAYREGION(T_DOUBLE,  jdouble, Double,  double
                             , HOTSPOT_JNI_GETDOUBLEARRAYREGION_ENTRY(env, array, start, len, (double *) buf),
                             HOTSPOT_JNI_GETDOUBLEARRAYREGION_RETURN());
 
+address jni_GetArrayRegion_addr(BasicType type) {
+  switch (type) {
+    case T_BOOLEAN: return (address)jni_GetBooleanArrayRegion;
+    case T_BYTE:    return (address)jni_GetByteArrayRegion;
+    case T_CHAR:    return (address)jni_GetCharArrayRegion;
+    case T_SHORT:   return (address)jni_GetShortArrayRegion;
+    case T_INT:     return (address)jni_GetIntArrayRegion;
+    case T_LONG:    return (address)jni_GetLongArrayRegion;
+    case T_FLOAT:   return (address)jni_GetFloatArrayRegion;
+    case T_DOUBLE:  return (address)jni_GetDoubleArrayRegion;
+    default:        ShouldNotReachHere(); return nullptr;
+  }
+}
 
 #define DEFINE_SETSCALARARRAYREGION(ElementTag,ElementType,Result, Tag \
                                     , EntryProbe, ReturnProbe); \
@@ -3468,6 +3481,28 @@ void quicken_jni_functions() {
       jni_NativeInterface.GetDoubleField = (GetDoubleField_t)func;
     }
   }
+#ifdef AMD64
+  // Replace Get<Primitive>ArrayRegion with fast versions
+  if (UseFastJNIArrayAccessors && !CheckJNICalls) {
+#define QUICKEN_GET_ARRAY_REGION(Result, Tag)                                  \
+    {                                                                          \
+      address func = JNI_FastGetField::generate_fast_get_array_region(Tag);    \
+      if (func != (address)-1) {                                               \
+        jni_NativeInterface.Get##Result##ArrayRegion =                         \
+          (decltype(jni_NativeInterface.Get##Result##ArrayRegion))func;        \
+      }                                                                        \
+    }
+    QUICKEN_GET_ARRAY_REGION(Boolean, T_BOOLEAN)
+    QUICKEN_GET_ARRAY_REGION(Byte,    T_BYTE)
+    QUICKEN_GET_ARRAY_REGION(Char,    T_CHAR)
+    QUICKEN_GET_ARRAY_REGION(Short,   T_SHORT)
+    QUICKEN_GET_ARRAY_REGION(Int,     T_INT)
+    QUICKEN_GET_ARRAY_REGION(Long,    T_LONG)
+    QUICKEN_GET_ARRAY_REGION(Float,   T_FLOAT)
+    QUICKEN_GET_ARRAY_REGION(Double,  T_DOUBLE)
+#undef QUICKEN_GET_ARRAY_REGION
+  }
+#endif // AMD64
 }
 
 // Returns the function structure
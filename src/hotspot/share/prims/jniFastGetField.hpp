@@ -53,6 +53,12 @@
 //
 // There is a hypothetical safepoint counter wraparound. But it's not
 // a practical concern.
+//
+// The fast versions of jni_Get<Primitive>ArrayRegion (AMD64 only) follow
+// the same protocol, with the speculative load replaced by a bounds check
+// and a copy loop into the native buffer. The buffer is only written, so
+// a copy that is invalidated by a safepoint is simply redone by the slow
+// version.
 
 class JNI_FastGetField : AllStatic {
  private:
@@ -90,6 +96,9 @@ class JNI_FastGetField : AllStatic {
   static address generate_fast_get_long_field();
   static address generate_fast_get_float_field();
   static address generate_fast_get_double_field();
+#ifdef AMD64
+  static address generate_fast_get_array_region(BasicType type);
+#endif // AMD64
 
   // If pc is in speculative_load_pclist, return the corresponding
   // slow case entry pc. Otherwise, return -1.
@@ -77,5 +77,6 @@ address jni_GetIntField_addr();
 address jni_GetLongField_addr();
 address jni_GetFloatField_addr();
 address jni_GetDoubleField_addr();
+address jni_GetArrayRegion_addr(BasicType type);
 
 #endif // SHARE_PRIMS_JVM_MISC_HPP
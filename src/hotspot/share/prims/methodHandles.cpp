@@ -53,10 +53,10 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.inline.hpp"
-#include "runtime/timerTrace.hpp"
 #include "runtime/reflection.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/signature.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "sanitizers/leak.hpp"
 #include "utilities/exceptions.hpp"
@@ -88,7 +88,7 @@ void MethodHandles::generate_adapters() {
   assert(_adapter_code == nullptr, "generate only once");
 
   ResourceMark rm;
-  TraceTime timer("MethodHandles adapters generation", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("MethodHandles adapters generation");
   // The adapter entry is required to be aligned to CodeEntryAlignment.
   // So we need additional bytes due to alignment.
   int adapter_num = (int)Interpreter::method_handle_invoke_LAST - (int)Interpreter::method_handle_invoke_FIRST + 1;
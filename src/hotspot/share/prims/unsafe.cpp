@@ -61,6 +61,9 @@
 #include "utilities/copy.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeMemoryAllocationSample.hpp"
+#endif
 
 /**
  * Implementation of the jdk.internal.misc.Unsafe class
@@ -364,6 +367,7 @@ UNSAFE_LEAF(jlong, Unsafe_AllocateMemory0(JNIEnv *env, jobject unsafe, jlong siz
   assert(is_aligned(sz, HeapWordSize), "sz not aligned");
 
   void* x = os::malloc(sz, mtOther);
+  JFR_ONLY(JfrNativeMemoryAllocationSample::send_event(x, sz, env);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -375,6 +379,7 @@ UNSAFE_LEAF(jlong, Unsafe_ReallocateMemory0(JNIEnv *env, jobject unsafe, jlong a
   assert(is_aligned(sz, HeapWordSize), "sz not aligned");
 
   void* x = os::realloc(p, sz, mtOther);
+  JFR_ONLY(JfrNativeMemoryAllocationSample::send_event(x, sz, env);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -344,7 +344,7 @@ static void set_anchor_to_entry(JavaThread* thread, ContinuationEntry* entry) {
 
 #if CONT_JFR
 class FreezeThawJfrInfo : public StackObj {
-  short _e_size;
+  int _e_size;
   short _e_num_interpreted_frames;
  public:
 
@@ -360,7 +360,8 @@ template<typename Event> void FreezeThawJfrInfo::post_jfr_event(Event* e, oop co
     e->set_carrierThread(JFR_JVM_THREAD_ID(jt));
     e->set_continuationClass(continuation->klass());
     e->set_interpretedFrames(_e_num_interpreted_frames);
-    e->set_size(_e_size);
+    // The event field is a ushort; saturate rather than wrap for deep stacks.
+    e->set_size((u2)MIN2(_e_size, (int)max_jushort));
     e->commit();
   }
 }
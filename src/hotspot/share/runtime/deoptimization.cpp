@@ -1993,6 +1993,36 @@ static void post_deoptimization_event(nmethod* nm,
   }
 }
 
+static void post_repeated_deoptimization_event(nmethod* nm,
+                                               const Method* method,
+                                               int trap_bci,
+                                               Deoptimization::DeoptReason reason,
+                                               uint trap_count,
+                                               uint decompile_count,
+                                               uint recompile_count,
+                                               bool not_compilable) {
+  assert(nm != nullptr, "invariant");
+  assert(method != nullptr, "invariant");
+  if (EventRepeatedDeoptimization::is_enabled()) {
+    static bool serializers_registered = false;
+    if (!serializers_registered) {
+      register_serializers();
+      serializers_registered = true;
+    }
+    EventRepeatedDeoptimization event;
+    event.set_compileId(nm->compile_id());
+    event.set_method(method);
+    event.set_lineNumber(method->line_number_from_bci(trap_bci));
+    event.set_bci(trap_bci);
+    event.set_reason(reason);
+    event.set_trapCount(trap_count);
+    event.set_decompileCount(decompile_count);
+    event.set_recompileCount(recompile_count);
+    event.set_notCompilable(not_compilable);
+    event.commit();
+  }
+}
+
 #endif // INCLUDE_JFR
 
 static void log_deopt(nmethod* nm, Method* tm, intptr_t pc, frame& fr, int trap_bci,
@@ -2347,6 +2377,13 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
     // aggressive optimization.
     bool inc_recompile_count = false;
 
+    // Repeated deoptimization state, reported once the MDO lock is released
+    bool report_repeated = false;
+    bool gave_up = false;
+    uint repeated_trap_count = 0;
+    uint repeated_decompile_count = 0;
+    uint repeated_recompile_count = 0;
+
     // Lock to read ProfileData, and ensure lock is not broken by a safepoint
     ConditionalMutexLocker ml((trap_mdo != nullptr) ? trap_mdo->extra_data_lock() : nullptr,
                               (trap_mdo != nullptr),
@@ -2454,6 +2491,7 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
       if ((uint)trap_mdo->overflow_recompile_count() >
           (uint)PerBytecodeRecompilationCutoff) {
         // Give up on the method containing the bad BCI.
+        gave_up = true;
         if (trap_method() == nm->method()) {
           make_not_compilable = true;
         } else {
@@ -2461,6 +2499,11 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
           // But give grace to the enclosing nm->method().
         }
       }
+      // The same speculation failed again after a recompile: report the trap history of the method.
+      report_repeated = true;
+      repeated_trap_count = trap_mdo->trap_count(reason);
+      repeated_decompile_count = trap_mdo->decompile_count();
+      repeated_recompile_count = trap_mdo->overflow_recompile_count();
     }
 
     // Reprofile
@@ -2485,6 +2528,18 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
       }
     }
 
+    if (report_repeated) {
+      // Post the event and log without holding the MDO extra data lock.
+      MutexUnlocker mu(trap_mdo->extra_data_lock(), Mutex::_no_safepoint_check_flag);
+      JFR_ONLY(post_repeated_deoptimization_event(nm, trap_method(), trap_bci, reason,
+                                                  repeated_trap_count, repeated_decompile_count,
+                                                  repeated_recompile_count, gave_up);)
+      log_info(deoptimization)("Repeated deoptimization: method=%s reason=%s bci=%d trap_count=%u decompile_count=%u recompile_count=%u%s",
+                               trap_method->name_and_sig_as_C_string(), trap_reason_name(reason), trap_bci,
+                               repeated_trap_count, repeated_decompile_count, repeated_recompile_count,
+                               gave_up ? " not_compilable" : "");
+    }
+
   } // Free marked resources
 
 }
@@ -570,6 +570,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uint, NativeMemoryTrackingStackSampleInterval, 1, DIAGNOSTIC,     \
+          "In NMT detail mode, capture the call stack of only one in this " \
+          "many malloc calls. Summary accounting stays exact; per-site "    \
+          "figures in the detail report are scaled estimates")              \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -781,6 +787,9 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
+  product(bool, UseFastJNIArrayAccessors, false, EXPERIMENTAL,              \
+          "Use optimized versions of Get<Primitive>ArrayRegion")            \
+                                                                            \
   product(intx, MaxJNILocalCapacity, 65536,                                 \
           "Maximum allowable local JNI handle capacity to "                 \
           "EnsureLocalCapacity() and PushLocalFrame(), "                    \
@@ -813,6 +822,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, EnableContended, true,                                      \
           "Enable @Contended annotation support")                           \
                                                                             \
+  product(ccstrlist, HotInstanceFields, "", EXPERIMENTAL,                   \
+          "Comma-separated list of instance fields, given as "              \
+          "<internal class name>.<field name>, that are laid out first "    \
+          "in their class so that they share cache lines")                  \
+                                                                            \
   product(bool, RestrictContended, true,                                    \
           "Restrict @Contended to trusted classes")                         \
                                                                             \
@@ -921,6 +935,10 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(bool, LimitCompilerThreadsToActiveProcessors, false, EXPERIMENTAL,\
+             "Do not add dynamic compiler threads beyond the number of "    \
+             "active processors, which honors container CPU quotas")        \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1401,6 +1419,10 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintMetaspaceStatisticsAtExit, false, DIAGNOSTIC,          \
           "Print metaspace statistics upon VM exit.")                       \
                                                                             \
+  product(bool, MetaspaceArenaSizePrediction, false, EXPERIMENTAL,          \
+          "Size the first metaspace chunk of a class loader after the "     \
+          "usage of recently unloaded loaders of the same class")           \
+                                                                            \
   product(uintx, MinHeapFreeRatio, 40, MANAGEABLE,                          \
           "The minimum percentage of heap free after GC to avoid expansion."\
           " For most GCs this applies to the old generation. In G1 and"     \
@@ -1812,6 +1834,11 @@ const int ObjectAlignmentInBytes = 8;
           "(will be rounded to nearest higher power of 2)")                 \
           range(minimumStringTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(uint, StringTableCleanupThreads, 1, EXPERIMENTAL,                 \
+          "Number of worker threads used to remove dead entries from the "  \
+          "interned String table; 1 does the work on the service thread")   \
+          range(1, 64)                                                      \
+                                                                            \
   product(uintx, SymbolTableSize, defaultSymbolTableSize, EXPERIMENTAL,     \
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
@@ -1847,6 +1874,10 @@ const int ObjectAlignmentInBytes = 8;
           "Minimum percentage of dead table entries for cleaning the table") \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, StringDeduplicationThreads, 1, EXPERIMENTAL,                \
+          "Number of threads processing deduplication requests")            \
+          range(1, 64)                                                      \
+                                                                            \
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
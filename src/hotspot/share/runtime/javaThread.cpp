@@ -509,6 +509,10 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _om_cache(this) {
   set_jni_functions(jni_functions());
 
+  for (int i = 0; i < symbol_cache_size; i++) {
+    _symbol_cache[i] = nullptr;
+  }
+
 #if INCLUDE_JVMCI
   assert(_jvmci._implicit_exception_pc == nullptr, "must be");
   if (JVMCICounterSize > 0) {
@@ -660,6 +664,9 @@ JavaThread::~JavaThread() {
   // Enqueue OopHandles for release by the service thread.
   add_oop_handles_for_release();
 
+  // Return unused cached JNI global handle entries.
+  JNIHandles::flush_allocation_caches(this);
+
   // Return the sleep event to the free list
   ParkEvent::Release(_SleepEvent);
   _SleepEvent = nullptr;
@@ -26,6 +26,7 @@
 #ifndef SHARE_RUNTIME_JAVATHREAD_HPP
 #define SHARE_RUNTIME_JAVATHREAD_HPP
 
+#include "gc/shared/oopStorage.hpp"
 #include "jni.h"
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
@@ -65,6 +66,7 @@ class ObjectMonitor;
 class OopHandleList;
 class OopStorage;
 class OSThread;
+class Symbol;
 
 class ThreadsList;
 class ThreadSafepointState;
@@ -159,6 +161,11 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Entries of the JNI global and weak global handle storages, allocated in
+  // bulk to reduce contention on the storages' allocation locks.
+  OopStorageAllocationCache _jni_global_handles_cache;
+  OopStorageAllocationCache _jni_weak_global_handles_cache;
+
  public:
   // For tracking the heavyweight monitor the thread is pending on.
   ObjectMonitor* current_pending_monitor() {
@@ -190,6 +197,9 @@ class JavaThread: public Thread {
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
+  OopStorageAllocationCache* jni_global_handles_cache()      { return &_jni_global_handles_cache; }
+  OopStorageAllocationCache* jni_weak_global_handles_cache() { return &_jni_weak_global_handles_cache; }
+
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
@@ -1176,7 +1186,15 @@ class JavaThread: public Thread {
   LockStack _lock_stack;
   OMCache _om_cache;
 
+  // Permanent Symbols recently found by SymbolTable lookups on this thread,
+  // indexed by their hash. Permanent Symbols are never freed, so the
+  // entries hold no reference counts. See SymbolTable::lookup_common().
+  static const int symbol_cache_size = 16;
+  Symbol* _symbol_cache[symbol_cache_size];
+
 public:
+  Symbol** symbol_cache_at(unsigned int hash) { return &_symbol_cache[hash % symbol_cache_size]; }
+
   LockStack& lock_stack() { return _lock_stack; }
 
   static ByteSize lock_stack_offset()      { return byte_offset_of(JavaThread, _lock_stack); }
@@ -82,6 +82,27 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandles::allocate_entry(OopStorage* storage) {
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return storage->allocate();
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  OopStorageAllocationCache* cache = (storage == global_handles())
+                                     ? jt->jni_global_handles_cache()
+                                     : jt->jni_weak_global_handles_cache();
+  return cache->allocate(storage);
+}
+
+void JNIHandles::flush_allocation_caches(JavaThread* thread) {
+  if (thread->jni_global_handles_cache()->count() > 0) {
+    thread->jni_global_handles_cache()->flush(global_handles());
+  }
+  if (thread->jni_weak_global_handles_cache()->count() > 0) {
+    thread->jni_weak_global_handles_cache()->flush(weak_global_handles());
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +110,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_entry(global_handles());
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +132,7 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_entry(weak_global_handles());
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
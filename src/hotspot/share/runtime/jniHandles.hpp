@@ -45,6 +45,10 @@ class JNIHandles : AllStatic {
   static OopStorage* global_handles();
   static OopStorage* weak_global_handles();
 
+  // Allocate an entry from storage, through the current thread's allocation
+  // cache for storage if it is a JavaThread.
+  static oop* allocate_entry(OopStorage* storage);
+
   inline static bool is_local_tagged(jobject handle);
   inline static bool is_weak_global_tagged(jobject handle);
   inline static bool is_global_tagged(jobject handle);
@@ -108,6 +112,9 @@ class JNIHandles : AllStatic {
   static void destroy_weak_global(jweak handle);
   static bool is_weak_global_cleared(jweak handle); // Test jweak without resolution
 
+  // Release the global and weak global entries cached by the exiting thread.
+  static void flush_allocation_caches(JavaThread* thread);
+
   // Debugging
   static void print_on(outputStream* st);
   static void print();
@@ -2081,11 +2081,11 @@ inline void ObjectMonitor::DequeueSpecificWaiter(ObjectWaiter* node) {
 
 // -----------------------------------------------------------------------------
 // PerfData support
-PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = nullptr;
-PerfCounter * ObjectMonitor::_sync_FutileWakeups               = nullptr;
-PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
-PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
-PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
+PerfShardedCounter * ObjectMonitor::_sync_ContendedLockAttempts = nullptr;
+PerfShardedCounter * ObjectMonitor::_sync_FutileWakeups        = nullptr;
+PerfShardedCounter * ObjectMonitor::_sync_Parks                = nullptr;
+PerfShardedCounter * ObjectMonitor::_sync_Notifications        = nullptr;
+PerfShardedCounter * ObjectMonitor::_sync_Inflations           = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 
@@ -2098,7 +2098,10 @@ PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 void ObjectMonitor::Initialize() {
   assert(!InitDone, "invariant");
 
-  if (!os::is_MP()) {
+  // Spinning only pays off if the owner can run while we spin. Besides
+  // uniprocessors, that is also not the case when the process is limited
+  // to a single CPU, e.g. by a container CPU quota or an affinity mask.
+  if (!os::is_MP() || os::active_processor_count() < 2) {
     Knob_SpinLimit = 0;
     Knob_PreSpin   = 0;
     Knob_FixedSpin = -1;
@@ -2116,15 +2119,22 @@ void ObjectMonitor::Initialize() {
     n = PerfDataManager::create_variable(SUN_RT, #n, PerfData::U_Events,  \
                                          CHECK);                          \
   }
-    NEWPERFCOUNTER(_sync_Inflations);
+#define NEWPERFSHARDEDCOUNTER(n)                                         \
+  {                                                                      \
+    n = PerfShardedCounter::create(SUN_RT, #n, PerfData::U_Events,       \
+                                   CHECK);                               \
+  }
+    // Counters updated on contended paths are sharded to avoid false sharing.
+    NEWPERFSHARDEDCOUNTER(_sync_Inflations);
     NEWPERFCOUNTER(_sync_Deflations);
-    NEWPERFCOUNTER(_sync_ContendedLockAttempts);
-    NEWPERFCOUNTER(_sync_FutileWakeups);
-    NEWPERFCOUNTER(_sync_Parks);
-    NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFSHARDEDCOUNTER(_sync_ContendedLockAttempts);
+    NEWPERFSHARDEDCOUNTER(_sync_FutileWakeups);
+    NEWPERFSHARDEDCOUNTER(_sync_Parks);
+    NEWPERFSHARDEDCOUNTER(_sync_Notifications);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
+#undef NEWPERFSHARDEDCOUNTER
   }
 
   _oop_storage = OopStorageSet::create_weak("ObjectSynchronizer Weak", mtSynchronizer);
@@ -207,11 +207,11 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
       }                                             \
     } while (0)
 
-  static PerfCounter * _sync_ContendedLockAttempts;
-  static PerfCounter * _sync_FutileWakeups;
-  static PerfCounter * _sync_Parks;
-  static PerfCounter * _sync_Notifications;
-  static PerfCounter * _sync_Inflations;
+  static PerfShardedCounter * _sync_ContendedLockAttempts;
+  static PerfShardedCounter * _sync_FutileWakeups;
+  static PerfShardedCounter * _sync_Parks;
+  static PerfShardedCounter * _sync_Notifications;
+  static PerfShardedCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
 
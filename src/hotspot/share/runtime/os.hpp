@@ -485,6 +485,15 @@ class os: AllStatic {
   struct size_change_t { size_t before; size_t after; };
   static bool trim_native_heap(size_change_t* rss_change = nullptr);
 
+  // Memory pressure of the environment (e.g. container) the VM runs in.
+  // stall_percent is the percentage of recent wall time in which some tasks
+  // were stalled waiting for memory, or -1. throttle_limit is the memory usage
+  // at which the environment starts throttling and reclaiming memory, and
+  // usage the current memory usage, both in bytes, or -1 if not known.
+  struct memory_pressure_t { double stall_percent; jlong throttle_limit; jlong usage; };
+  // Returns false if no memory pressure information is available.
+  static bool memory_pressure(memory_pressure_t* info);
+
   // A diagnostic function to print memory mappings in the given range.
   static void print_memory_mappings(char* addr, size_t bytes, outputStream* st);
   // Prints all mappings
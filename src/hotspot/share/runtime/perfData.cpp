@@ -212,6 +212,41 @@ void PerfLongVariant::sample() {
   }
 }
 
+PerfShardedCounter::PerfShardedCounter() {
+  for (int i = 0; i < nof_shards; i++) {
+    _shards[i]._value = 0;
+  }
+}
+
+PerfShardedCounter::Shard& PerfShardedCounter::current_shard() {
+  // Thread objects are large, so the low bits of their addresses carry
+  // little information; mix in some higher bits.
+  uintptr_t t = (uintptr_t)Thread::current_or_null();
+  return _shards[((t >> 6) ^ (t >> 12)) % nof_shards];
+}
+
+jlong PerfShardedCounter::take_sample() {
+  jlong sum = 0;
+  for (int i = 0; i < nof_shards; i++) {
+    sum += _shards[i]._value;
+  }
+  return sum;
+}
+
+PerfShardedCounter* PerfShardedCounter::create(CounterNS ns, const char* name,
+                                               PerfData::Units u, TRAPS) {
+  // Sampled counters not supported if UsePerfData is false
+  if (!UsePerfData) return nullptr;
+
+  PerfShardedCounter* counter = new PerfShardedCounter();
+  PerfDataManager::create_long_counter(ns, name, u, counter, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    delete counter;
+    return nullptr;
+  }
+  return counter;
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
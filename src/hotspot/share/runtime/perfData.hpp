@@ -26,6 +26,7 @@
 #define SHARE_RUNTIME_PERFDATA_HPP
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/perfDataTypes.hpp"
 #include "runtime/perfMemory.hpp"
 #include "runtime/timer.hpp"
@@ -806,6 +807,45 @@ class PerfDataManager : AllStatic {
 
 // Utility Classes
 
+/*
+ * PerfShardedCounter is an event counter for events that are counted by
+ * many threads at once. A PerfCounter is a single word in the shared
+ * PerfData memory region next to other counters, so hot counters suffer
+ * from false sharing. Increments of a PerfShardedCounter go to one of
+ * several cache line sized slots selected by the current thread instead,
+ * and the StatSampler publishes their sum to the PerfData memory region.
+ * Readers of the hsperfdata file see an ordinary sampled counter.
+ *
+ * Like PerfCounter::inc(), increments are not atomic; concurrent
+ * increments of the same slot may be lost.
+ */
+class PerfShardedCounter : public PerfLongSampleHelper {
+  static const int nof_shards = 16;
+
+  struct Shard {
+    volatile jlong _value;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(jlong));
+  };
+  Shard _shards[nof_shards];
+
+  Shard& current_shard();
+
+  PerfShardedCounter();
+
+ public:
+  inline void inc() { inc(1); }
+  inline void inc(jlong val) {
+    Shard& s = current_shard();
+    s._value = s._value + val;
+  }
+
+  jlong take_sample();
+
+  // Returns null if UsePerfData is off.
+  static PerfShardedCounter* create(CounterNS ns, const char* name,
+                                    PerfData::Units u, TRAPS);
+};
+
 /*
  * this class will administer a PerfCounter used as a time accumulator
  * for a basic block much like the TraceTime class.
@@ -35,6 +35,7 @@ class PerfLongSampleHelper;
 class PerfLongConstant;
 class PerfLongCounter;
 class PerfLongVariable;
+class PerfShardedCounter;
 class PerfStringVariable;
 
 typedef PerfLongSampleHelper PerfSampleHelper;
@@ -63,6 +63,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -195,7 +196,7 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running, JavaThread** straggler)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -247,6 +248,9 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (still_running == 0) {
+          *straggler = cur_tss->thread();
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -272,6 +276,55 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   return iterations;
 }
 
+// Attribute the time to reach the safepoint to the last thread that had to
+// be waited for, and the method it was executing when it finally stopped.
+// The thread is stopped and Threads_lock is held, so it cannot exit.
+static void report_straggler(JavaThread* straggler, EventSafepointStraggler& event) {
+  LogTarget(Debug, safepoint) lt;
+  if (!lt.is_enabled() && !event.should_commit()) {
+    return;
+  }
+
+  ResourceMark rm;
+  Method* method = nullptr;
+  int bci = -1;
+  if (straggler->has_last_Java_frame()) {
+    // A compiled thread stopped at a poll has the safepoint blob as its last
+    // frame, so walk to the first Java frame. The thread is safepoint safe
+    // here, and only the method and bci are read.
+    RegisterMap reg_map(straggler,
+                        RegisterMap::UpdateMap::skip,
+                        RegisterMap::ProcessFrames::skip,
+                        RegisterMap::WalkContinuation::skip);
+    javaVFrame* jvf = straggler->last_java_vframe(&reg_map);
+    if (jvf != nullptr) {
+      method = jvf->method();
+      bci = jvf->bci();
+    }
+  }
+
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Last thread to reach safepoint: %s after " JLONG_FORMAT " ns",
+             straggler->name(), os::javaTimeNanos() - SafepointTracing::start_of_safepoint());
+    if (method != nullptr) {
+      ls.print(" in ");
+      method->print_short_name(&ls);
+      ls.print(" @ %d", bci);
+    }
+    ls.cr();
+  }
+
+  if (event.should_commit()) {
+    // The safepoint id is only incremented after synchronization.
+    event.set_safepointId(SafepointSynchronize::safepoint_id() + 1);
+    event.set_straggler(JFR_JVM_THREAD_ID(straggler));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.commit();
+  }
+}
+
 void SafepointSynchronize::arm_safepoint() {
   // Begin the process of bringing the system to a safepoint.
   // Java threads can be in several different states and are
@@ -364,15 +417,21 @@ void SafepointSynchronize::begin() {
   }
 
   EventSafepointStateSynchronization sync_event;
+  EventSafepointStraggler straggler_event;
   int initial_running = 0;
+  JavaThread* straggler = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &straggler);
   assert(_waiting_to_block == 0, "No thread should be running");
 
+  if (straggler != nullptr) {
+    report_straggler(straggler, straggler_event);
+  }
+
 #ifndef PRODUCT
   // Mark all threads
   if (VerifyCrossModifyFence) {
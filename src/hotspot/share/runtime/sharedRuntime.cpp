@@ -69,9 +69,9 @@
 #include "runtime/perfData.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stackWatermarkSet.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.inline.hpp"
-#include "runtime/timerTrace.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "runtime/vframeArray.hpp"
 #include "runtime/vm_version.hpp"
@@ -175,7 +175,7 @@ void SharedRuntime::generate_stubs() {
 void SharedRuntime::generate_jfr_stubs() {
   ResourceMark rm;
   const char* timer_msg = "SharedRuntime generate_jfr_stubs";
-  TraceTime timer(timer_msg, TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer(timer_msg);
 
   _jfr_write_checkpoint_blob = generate_jfr_write_checkpoint();
   _jfr_return_lease_blob = generate_jfr_return_lease();
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/startupTimeline.hpp"
+#include "utilities/ostream.hpp"
+
+StartupTimeline::Phase StartupTimeline::_phases[StartupTimeline::MaxPhases];
+volatile int StartupTimeline::_count = 0;
+
+jlong StartupTimeline::to_micros(jlong counter) {
+  return (jlong)((double)counter * MICROUNITS / os::elapsed_frequency());
+}
+
+jlong StartupTimeline::to_nanos(jlong counter) {
+  return (jlong)((double)counter * NANOUNITS / os::elapsed_frequency());
+}
+
+int StartupTimeline::depth_of(int phase) {
+  const Phase* p = &_phases[phase];
+  jlong end = Atomic::load_acquire(&p->_end);
+  // A phase is nested in every earlier phase whose interval encloses it
+  int depth = 0;
+  for (int j = 0; j < phase; j++) {
+    if (Atomic::load_acquire(&_phases[j]._name) == nullptr) {
+      continue;
+    }
+    jlong outer_end = Atomic::load_acquire(&_phases[j]._end);
+    if (_phases[j]._start <= p->_start && (outer_end == 0 || (end != 0 && end <= outer_end))) {
+      depth++;
+    }
+  }
+  return depth;
+}
+
+int StartupTimeline::begin(const char* name) {
+  int phase = Atomic::fetch_then_add(&_count, 1);
+  if (phase >= MaxPhases) {
+    return -1;
+  }
+  _phases[phase]._start = os::elapsed_counter();
+  _phases[phase]._end = 0;
+  // Publish last, printing skips phases without a name
+  Atomic::release_store(&_phases[phase]._name, name);
+  return phase;
+}
+
+void StartupTimeline::end(int phase) {
+  if (phase >= 0) {
+    Atomic::release_store(&_phases[phase]._end, os::elapsed_counter());
+  }
+}
+
+void StartupTimeline::print_json_on(outputStream* st) {
+  int count = MIN2(Atomic::load_acquire(&_count), MaxPhases);
+  st->print_cr("{");
+  st->print_cr("  \"phases\": [");
+  const char* separator = "";
+  for (int i = 0; i < count; i++) {
+    const Phase* p = &_phases[i];
+    const char* name = Atomic::load_acquire(&p->_name);
+    if (name == nullptr) {
+      continue;
+    }
+    jlong end = Atomic::load_acquire(&p->_end);
+    int depth = depth_of(i);
+
+    st->print("%s    {\"name\": \"%s\", \"depth\": %d, \"start_us\": " JLONG_FORMAT ", \"duration_us\": ",
+              separator, name, depth, to_micros(p->_start));
+    if (end != 0) {
+      st->print(JLONG_FORMAT, to_micros(end - p->_start));
+    } else {
+      st->print("null");
+    }
+    st->print("}");
+    separator = ",\n";
+  }
+  st->cr();
+  st->print_cr("  ]");
+  st->print_cr("}");
+}
+
+void StartupTimeline::send_events() {
+  int count = MIN2(Atomic::load_acquire(&_count), MaxPhases);
+  for (int i = 0; i < count; i++) {
+    const Phase* p = &_phases[i];
+    const char* name = Atomic::load_acquire(&p->_name);
+    jlong end = Atomic::load_acquire(&p->_end);
+    if (name == nullptr || end == 0) {
+      continue;
+    }
+    EventStartupPhase event;
+    event.set_name(name);
+    event.set_depth(depth_of(i));
+    event.set_start(to_nanos(p->_start));
+    event.set_duration(to_nanos(end - p->_start));
+    event.commit();
+  }
+}
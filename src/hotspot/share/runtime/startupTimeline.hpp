@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_STARTUPTIMELINE_HPP
+#define SHARE_RUNTIME_STARTUPTIMELINE_HPP
+
+#include "memory/allStatic.hpp"
+#include "runtime/timerTrace.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+
+// Records the VM startup phases with their start and end times, so they
+// can be inspected together (VM.startup_timeline, StartupPhase JFR events)
+// rather than as separate -Xlog:startuptime lines. Phase names must be
+// string literals.
+class StartupTimeline : AllStatic {
+  static const int MaxPhases = 64;
+
+  struct Phase {
+    const char* volatile _name;
+    jlong                _start;
+    volatile jlong       _end;
+  };
+
+  static Phase _phases[MaxPhases];
+  static volatile int _count;
+
+  static jlong to_micros(jlong counter);
+  static jlong to_nanos(jlong counter);
+  // Number of earlier phases whose interval encloses the given phase.
+  static int depth_of(int phase);
+
+public:
+  // Returns a handle to pass to end(), or -1 if the timeline is full.
+  static int begin(const char* name);
+  static void end(int phase);
+
+  // Prints the phases as JSON, times in microseconds since VM start.
+  // Nesting is derived from the recorded intervals.
+  static void print_json_on(outputStream* st);
+
+  // Sends one StartupPhase event per completed phase.
+  static void send_events();
+};
+
+// TraceTime for -Xlog:startuptime that also records the phase in the
+// StartupTimeline.
+class TraceStartupTime : public StackObj {
+  TraceTime _timer;
+  int _phase;
+
+public:
+  explicit TraceStartupTime(const char* title) :
+    _timer(title, TRACETIME_LOG(Info, startuptime)),
+    _phase(StartupTimeline::begin(title)) {}
+
+  ~TraceStartupTime() {
+    StartupTimeline::end(_phase);
+  }
+};
+
+#endif // SHARE_RUNTIME_STARTUPTIMELINE_HPP
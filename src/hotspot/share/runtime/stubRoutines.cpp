@@ -32,8 +32,8 @@
 #include "prims/vectorSupport.hpp"
 #include "runtime/continuation.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
-#include "runtime/timerTrace.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -100,6 +100,8 @@ address StubRoutines::_arrayof_oop_disjoint_arraycopy_uninit  = CAST_FROM_FN_PTR
 address StubRoutines::_data_cache_writeback              = nullptr;
 address StubRoutines::_data_cache_writeback_sync         = nullptr;
 
+address StubRoutines::_zero_words_nontemporal           = nullptr;
+
 address StubRoutines::_checkcast_arraycopy               = nullptr;
 address StubRoutines::_checkcast_arraycopy_uninit        = nullptr;
 address StubRoutines::_unsafe_arraycopy                  = nullptr;
@@ -234,7 +236,7 @@ static BufferBlob* initialize_stubs(StubCodeGenerator::StubsKind kind,
                                     const char* buffer_name,
                                     const char* assert_msg) {
   ResourceMark rm;
-  TraceTime timer(timer_msg, TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer(timer_msg);
   // Add extra space for large CodeEntryAlignment
   int size = code_size + CodeEntryAlignment * max_aligned_stubs;
   BufferBlob* stubs_code = BufferBlob::create(buffer_name, size);
@@ -211,6 +211,9 @@ class StubRoutines: AllStatic {
   static address _data_cache_writeback;
   static address _data_cache_writeback_sync;
 
+  // zeroing of large blocks with non-temporal stores
+  static address _zero_words_nontemporal;
+
   // these are recommended but optional:
   static address _checkcast_arraycopy, _checkcast_arraycopy_uninit;
   static address _unsafe_arraycopy;
@@ -396,6 +399,12 @@ class StubRoutines: AllStatic {
   typedef void (*DataCacheWritebackSyncStub)(bool);
   static DataCacheWritebackSyncStub DataCacheWritebackSync_stub() { return CAST_TO_FN_PTR(DataCacheWritebackSyncStub,  _data_cache_writeback_sync); }
 
+  static address zero_words_nontemporal() { return _zero_words_nontemporal; }
+  // Zeroes count HeapWords starting at the HeapWord aligned to, bypassing
+  // the caches where possible.  The stores are complete on return.
+  typedef void (*ZeroWordsNonTemporalStub)(HeapWord* to, size_t count);
+  static ZeroWordsNonTemporalStub ZeroWordsNonTemporal_stub()     { return CAST_TO_FN_PTR(ZeroWordsNonTemporalStub, _zero_words_nontemporal); }
+
   static address checkcast_arraycopy(bool dest_uninitialized = false) {
     return dest_uninitialized ? _checkcast_arraycopy_uninit : _checkcast_arraycopy;
   }
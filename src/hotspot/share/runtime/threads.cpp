@@ -84,13 +84,13 @@
 #include "runtime/serviceThread.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/timer.hpp"
-#include "runtime/timerTrace.hpp"
 #include "runtime/trimNativeHeap.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
@@ -302,7 +302,7 @@ static void call_initPhase1(TRAPS) {
 //
 //     After phase 2, The VM will begin search classes from -Xbootclasspath/a.
 static void call_initPhase2(TRAPS) {
-  TraceTime timer("Initialize module system", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("Initialize module system");
 
   Klass* klass = vmClasses::System_klass();
 
@@ -333,7 +333,7 @@ static void call_initPhase3(TRAPS) {
 }
 
 void Threads::initialize_java_lang_classes(JavaThread* main_thread, TRAPS) {
-  TraceTime timer("Initialize java.lang classes", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("Initialize java.lang classes");
 
   initialize_class(vmSymbols::java_lang_String(), CHECK);
 
@@ -400,7 +400,7 @@ void Threads::initialize_java_lang_classes(JavaThread* main_thread, TRAPS) {
 }
 
 void Threads::initialize_jsr292_core_classes(TRAPS) {
-  TraceTime timer("Initialize java.lang.invoke classes", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("Initialize java.lang.invoke classes");
 
   initialize_class(vmSymbols::java_lang_invoke_MethodHandle(), CHECK);
   initialize_class(vmSymbols::java_lang_invoke_ResolvedMethodName(), CHECK);
@@ -478,7 +478,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   HOTSPOT_VM_INIT_BEGIN();
 
   // Timing (must come after argument parsing)
-  TraceTime timer("Create VM", TRACETIME_LOG(Info, startuptime));
+  TraceStartupTime timer("Create VM");
 
   // Initialize the os module after parsing the args
   jint os_init_2_result = os::init_2();
@@ -590,7 +590,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   JvmtiExport::transition_pending_onload_raw_monitors();
 
   // Create the VMThread
-  { TraceTime timer("Start VMThread", TRACETIME_LOG(Info, startuptime));
+  { TraceStartupTime timer("Start VMThread");
 
     VMThread::create();
     VMThread* vmthread = VMThread::vm_thread();
@@ -58,6 +58,7 @@
   template(G1CollectFull)                         \
   template(G1PauseRemark)                         \
   template(G1PauseCleanup)                        \
+  template(G1ShrinkHeap)                          \
   template(G1TryInitiateConcMark)                 \
   template(ZMarkEndOld)                           \
   template(ZMarkEndYoung)                         \
@@ -29,6 +29,7 @@
 #include "classfile/classLoaderHierarchyDCmd.hpp"
 #include "classfile/classLoaderStats.hpp"
 #include "classfile/javaClasses.hpp"
+#include "classfile/javaThreadStatus.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
@@ -36,6 +37,7 @@
 #include "compiler/compiler_globals.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
+#include "gc/shared/gcTelemetry.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "jvm.h"
 #include "memory/metaspace/metaspaceDCmd.hpp"
@@ -56,6 +58,8 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/startupTimeline.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -105,10 +109,12 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SetVMFlagDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMStartupTimelineDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<GCTelemetryDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
@@ -134,6 +140,7 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeListDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHotspotsDCmd>(full_export, true, false));
 #ifdef LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfMapDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TrimCLibcHeapDCmd>(full_export, true, false));
@@ -399,6 +406,10 @@ void VMUptimeDCmd::execute(DCmdSource source, TRAPS) {
   output()->print_cr(" s");
 }
 
+void VMStartupTimelineDCmd::execute(DCmdSource source, TRAPS) {
+  StartupTimeline::print_json_on(output());
+}
+
 void VMInfoDCmd::execute(DCmdSource source, TRAPS) {
   VMError::print_vm_info(_output);
 }
@@ -420,6 +431,21 @@ void HeapInfoDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->print_on(output());
 }
 
+GCTelemetryDCmd::GCTelemetryDCmd(outputStream* output, bool heap) :
+                                 DCmdWithParser(output, heap),
+  _histogram("-histogram", "Also print the non-empty histogram buckets", "BOOLEAN", false, "false"),
+  _reset("-reset", "Clear the histograms after printing", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_histogram);
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void GCTelemetryDCmd::execute(DCmdSource source, TRAPS) {
+  GCTelemetry::print_on(output(), _histogram.value());
+  if (_reset.value()) {
+    GCTelemetry::reset();
+  }
+}
+
 void FinalizerInfoDCmd::execute(DCmdSource source, TRAPS) {
   ResourceMark rm(THREAD);
 
@@ -560,12 +586,72 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _summary("-s", "print only the number of threads in each state, without a safepoint",
+           "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_summary);
+}
+
+// Counts the Java threads by java.lang.Thread state. Only the status field of
+// each thread object is read, so no safepoint is needed, but the counts are
+// a racy view of threads that keep running.
+static void print_thread_state_summary(outputStream* out) {
+  static const struct {
+    JavaThreadStatus status;
+    const char* name;
+  } states[] = {
+    { JavaThreadStatus::NEW,                      "NEW" },
+    { JavaThreadStatus::RUNNABLE,                 "RUNNABLE" },
+    { JavaThreadStatus::SLEEPING,                 "TIMED_WAITING (sleeping)" },
+    { JavaThreadStatus::IN_OBJECT_WAIT,           "WAITING (on object monitor)" },
+    { JavaThreadStatus::IN_OBJECT_WAIT_TIMED,     "TIMED_WAITING (on object monitor)" },
+    { JavaThreadStatus::PARKED,                   "WAITING (parking)" },
+    { JavaThreadStatus::PARKED_TIMED,             "TIMED_WAITING (parking)" },
+    { JavaThreadStatus::BLOCKED_ON_MONITOR_ENTER, "BLOCKED (on object monitor)" },
+    { JavaThreadStatus::TERMINATED,               "TERMINATED" }
+  };
+  const int num_states = ARRAY_SIZE(states);
+  int counts[num_states] = {};
+  int total = 0;
+  int unknown = 0;
+
+  for (JavaThread* jt : ThreadsListHandle()) {
+    oop thread_oop = jt->threadObj();
+    if (thread_oop == nullptr) {
+      continue;
+    }
+    total++;
+    const JavaThreadStatus status = java_lang_Thread::get_thread_status(thread_oop);
+    int i = 0;
+    while (i < num_states && states[i].status != status) {
+      i++;
+    }
+    if (i == num_states) {
+      unknown++;
+    } else {
+      counts[i]++;
+    }
+  }
+
+  out->print_cr("Java threads: %d", total);
+  for (int i = 0; i < num_states; i++) {
+    if (counts[i] > 0) {
+      out->print_cr("  %-34s %d", states[i].name, counts[i]);
+    }
+  }
+  if (unknown > 0) {
+    out->print_cr("  %-34s %d", "UNKNOWN", unknown);
+  }
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_summary.value()) {
+    print_thread_state_summary(output());
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
@@ -853,6 +939,22 @@ void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_layout(output());
 }
 
+CodeHotspotsDCmd::CodeHotspotsDCmd(outputStream* output, bool heap) :
+                                   DCmdWithParser(output, heap),
+  _count("count", "Number of methods to print", "INT", false, "20") {
+  _dcmdparser.add_dcmd_argument(&_count);
+}
+
+void CodeHotspotsDCmd::execute(DCmdSource source, TRAPS) {
+  jlong count = _count.value();
+  if (count < 1) {
+    Exceptions::fthrow(THREAD_AND_LOCATION, vmSymbols::java_lang_IllegalArgumentException(),
+                       "Invalid count value " JLONG_FORMAT  ". Should be positive.\n", count);
+    return;
+  }
+  CodeCache::print_hotspots(output(), (int)MIN2(count, (jlong)max_jint));
+}
+
 #ifdef LINUX
 PerfMapDCmd::PerfMapDCmd(outputStream* output, bool heap) :
              DCmdWithParser(output, heap),
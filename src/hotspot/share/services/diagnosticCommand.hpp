@@ -232,6 +232,22 @@ class VMUptimeDCmd : public DCmdWithParser {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VMStartupTimelineDCmd : public DCmd {
+public:
+  VMStartupTimelineDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.startup_timeline"; }
+  static const char* description() {
+    return "Print the timeline of VM startup phases as JSON.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMInfoDCmd : public DCmd {
 public:
   VMInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -293,6 +309,29 @@ class HeapInfoDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class GCTelemetryDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _histogram;
+  DCmdArgument<bool> _reset;
+public:
+  static int num_arguments() { return 2; }
+  GCTelemetryDCmd(outputStream* output, bool heap);
+  static const char* name() { return "GC.telemetry"; }
+  static const char* description() {
+    return "Print latency percentiles of GC pauses and concurrent phases.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class FinalizerInfoDCmd : public DCmd {
 public:
   FinalizerInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -426,8 +465,9 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _summary;
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
   static const char* description() {
@@ -641,6 +681,30 @@ class CodeCacheDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CodeHotspotsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _count;
+public:
+  static int num_arguments() { return 1; }
+  CodeHotspotsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.hotspots";
+  }
+  static const char* description() {
+    return "Print the compiled methods with the highest invocation and backedge counts, "
+           "with their size, tier and deoptimization history.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of compiled methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", nullptr};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 //---<  BEGIN  >--- CodeHeap State Analytics.
 class CodeHeapAnalyticsDCmd : public DCmdWithParser {
 protected:
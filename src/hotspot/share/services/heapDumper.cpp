@@ -2148,10 +2148,11 @@ void DumpMerger::merge_file(const char* path) {
 
   // A successful call to sendfile may write fewer bytes than requested; the
   // caller should be prepared to retry the call if there were unsent bytes.
+  // A return of 0 means the file ended early, which would otherwise spin here.
   jlong offset = 0;
   while (offset < st.st_size) {
-    int ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, st.st_size);
-    if (ret == -1) {
+    jlong ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, st.st_size - offset);
+    if (ret <= 0) {
       ::close(segment_fd);
       set_error("Failed to merge segmented heap file");
       return;
@@ -306,6 +306,29 @@ class BitMap {
     return iterate(cl, 0, size());
   }
 
+  // Applies an operation to the index of each set bit in [beg, end), in
+  // increasing order, like iterate(). Each word of the bitmap is loaded
+  // only once, and the set bits in it are then visited without searching
+  // the bitmap again. This is considerably cheaper than iterate() for
+  // densely populated bitmaps.
+  //
+  // Only bits that are also set in mask are visited. The mask is applied
+  // to every word, e.g. 0x55...55 visits only even indices.
+  //
+  // Unlike iterate(), modifications by the operation to bits in the word
+  // currently being visited are not observed, so this must not be used
+  // for bitmaps that are concurrently or recursively updated ahead of
+  // the iteration.
+  //
+  // precondition: beg and end form a valid range for the bitmap.
+  template<typename Function>
+  bool iterate_dense(Function function, idx_t beg, idx_t end, bm_word_t mask = ~(bm_word_t)0) const;
+
+  template<typename Function>
+  bool iterate_dense(Function function) const {
+    return iterate_dense(function, 0, size());
+  }
+
   template<typename Function>
   bool reverse_iterate(Function function, idx_t beg, idx_t end) const;
 
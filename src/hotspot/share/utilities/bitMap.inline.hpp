@@ -351,6 +351,43 @@ inline bool BitMap::iterate(BitMapClosureType* cl, idx_t beg, idx_t end) const {
   return iterate(function, beg, end);
 }
 
+template <typename Function>
+inline bool BitMap::iterate_dense(Function function, idx_t beg, idx_t end, bm_word_t mask) const {
+  verify_range(beg, end);
+  auto invoke = IterateInvoker<decltype(function(beg))>();
+
+  if (beg >= end) {
+    return true;
+  }
+
+  idx_t word_index = to_words_align_down(beg);
+  const idx_t word_limit = to_words_align_up(end);
+
+  // Drop the bits below beg in the first word
+  bm_word_t cword = _map[word_index] & mask & (~(bm_word_t)0 << bit_in_word(beg));
+
+  for (;;) {
+    // Visit all set bits in the current word
+    while (cword != 0) {
+      const idx_t index = bit_index(word_index) + count_trailing_zeros(cword);
+      if (index >= end) {
+        return true;
+      } else if (!invoke(function, index)) {
+        return false;
+      }
+
+      // Clear the lowest set bit
+      cword &= cword - 1;
+    }
+
+    if (++word_index >= word_limit) {
+      return true;
+    }
+
+    cword = _map[word_index] & mask;
+  }
+}
+
 template <typename Function>
 inline bool BitMap::reverse_iterate(Function function, idx_t beg, idx_t end) const {
   auto invoke = IterateInvoker<decltype(function(beg))>();
@@ -30,9 +30,11 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(nullptr), _fd(file), _section(file, shdr) {
+  _next(nullptr), _fd(file), _section(file, shdr),
+  _ranges(nullptr), _range_count(0), _max_range_size(0), _ranges_initialized(false) {
   assert(file != nullptr, "null file handle");
   _status = _section.status();
 
@@ -42,22 +44,27 @@ ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
 }
 
 ElfSymbolTable::~ElfSymbolTable() {
+  if (_ranges != nullptr) {
+    FREE_C_HEAP_ARRAY(SymbolRange, _ranges);
+  }
   if (_next != nullptr) {
     delete _next;
   }
 }
 
+address ElfSymbolTable::symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const {
+  if (funcDescTable != nullptr && funcDescTable->get_index() == sym->st_shndx) {
+    // We need to go another step through the function descriptor table (currently PPC64 only)
+    return funcDescTable->lookup(sym->st_value);
+  }
+  return (address)sym->st_value;
+}
+
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   if (STT_FUNC == ELF_ST_TYPE(sym->st_info)) {
     Elf64_Xword st_size = sym->st_size;
     const Elf_Shdr* shdr = _section.section_header();
-    address sym_addr;
-    if (funcDescTable != nullptr && funcDescTable->get_index() == sym->st_shndx) {
-      // We need to go another step through the function descriptor table (currently PPC64 only)
-      sym_addr = funcDescTable->lookup(sym->st_value);
-    } else {
-      sym_addr = (address)sym->st_value;
-    }
+    address sym_addr = symbol_address(sym, funcDescTable);
     if (sym_addr <= addr && (Elf_Word)(addr - sym_addr) < st_size) {
       *offset = (int)(addr - sym_addr);
       *posIndex = sym->st_name;
@@ -82,6 +89,12 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != nullptr) {
+    if (!_ranges_initialized) {
+      build_ranges(symbols, count, funcDescTable);
+    }
+    if (_ranges != nullptr) {
+      return lookup_ranges(symbols, addr, stringtableIndex, posIndex, offset);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
@@ -110,4 +123,78 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   return false;
 }
 
+int ElfSymbolTable::compare_ranges(const SymbolRange& a, const SymbolRange& b) {
+  if (a._start != b._start) {
+    return a._start < b._start ? -1 : 1;
+  }
+  return a._index - b._index;
+}
+
+void ElfSymbolTable::build_ranges(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable) {
+  _ranges_initialized = true;
+
+  int nfuncs = 0;
+  for (int index = 0; index < count; index ++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      nfuncs ++;
+    }
+  }
+  if (nfuncs == 0) {
+    return;
+  }
+
+  // Falls back to the linear scan if the index cannot be allocated
+  SymbolRange* ranges = NEW_C_HEAP_ARRAY_RETURN_NULL(SymbolRange, nfuncs, mtInternal);
+  if (ranges == nullptr) {
+    return;
+  }
+
+  int n = 0;
+  for (int index = 0; index < count; index ++) {
+    const Elf_Sym* sym = &symbols[index];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size > 0) {
+      ranges[n]._start = symbol_address(sym, funcDescTable);
+      ranges[n]._size = sym->st_size;
+      ranges[n]._index = index;
+      _max_range_size = MAX2(_max_range_size, sym->st_size);
+      n ++;
+    }
+  }
+  assert(n == nfuncs, "must be");
+  QuickSort::sort(ranges, (size_t)n, compare_ranges);
+
+  _ranges = ranges;
+  _range_count = n;
+}
+
+bool ElfSymbolTable::lookup_ranges(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  // Find the last range starting at or below addr
+  int lo = 0;
+  int hi = _range_count;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (_ranges[mid]._start <= addr) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // Symbols may nest or overlap, so walk back over every range that could
+  // still cover addr given the largest symbol size in this table.
+  for (int i = lo - 1; i >= 0; i --) {
+    const SymbolRange& r = _ranges[i];
+    if ((Elf64_Xword)(addr - r._start) >= _max_range_size) {
+      break;
+    }
+    if ((Elf64_Xword)(addr - r._start) < r._size) {
+      *offset = (int)(addr - r._start);
+      *posIndex = symbols[r._index].st_name;
+      *stringtableIndex = _section.section_header()->sh_link;
+      return true;
+    }
+  }
+  return false;
+}
+
 #endif // !_WINDOWS && !__APPLE__
@@ -37,6 +37,10 @@
  * Whenever possible, it will load all symbols from the corresponding section
  * of the elf file into memory. Otherwise, it will walk the section in file
  * to look up the symbol that nearest the given address.
+ *
+ * When the symbols are in memory, the function symbols are also indexed by
+ * start address on first lookup, so that later lookups are a binary search
+ * instead of a scan over the whole section.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -50,6 +54,18 @@ class ElfSymbolTable: public CHeapObj<mtInternal> {
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // Function symbols sorted by start address, built lazily by lookup()
+  struct SymbolRange {
+    address     _start;
+    Elf64_Xword _size;
+    int         _index;
+  };
+  SymbolRange*     _ranges;
+  int              _range_count;
+  Elf64_Xword      _max_range_size;
+  bool             _ranges_initialized;
+
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -63,6 +79,11 @@ class ElfSymbolTable: public CHeapObj<mtInternal> {
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  address symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) const;
+  void build_ranges(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable);
+  bool lookup_ranges(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset);
+  static int compare_ranges(const SymbolRange& a, const SymbolRange& b);
 };
 
 #endif // !_WINDOWS and !__APPLE__
@@ -851,6 +851,44 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
   }
 };
 
+// GrowableArray with inline storage for its first N elements. The data array
+// starts out in the object itself and only moves to the resource area when it
+// grows beyond N, so the many short-lived arrays that stay small never
+// allocate. Because the inline storage moves with the object, it must only be
+// used as a local (stack) variable. Functions that operate on it accept a
+// GrowableArrayView<E>.
+template <typename E, int N>
+class InlineGrowableArray : public GrowableArrayWithAllocator<E, InlineGrowableArray<E, N> > {
+  friend class GrowableArrayWithAllocator<E, InlineGrowableArray<E, N> >;
+
+  STATIC_ASSERT(N > 0);
+
+  alignas(E) char _inline_data[N * sizeof(E)];
+
+  E* inline_data() const {
+    return reinterpret_cast<E*>(const_cast<char*>(_inline_data));
+  }
+
+  E* allocate() {
+    return (E*)GrowableArrayResourceAllocator::allocate(this->_capacity, sizeof(E));
+  }
+
+  void deallocate(E* mem) {
+    // Neither the inline storage nor resource area memory is freed explicitly
+  }
+
+  NONCOPYABLE(InlineGrowableArray);
+
+public:
+  InlineGrowableArray() :
+      GrowableArrayWithAllocator<E, InlineGrowableArray<E, N> >(inline_data(), N) {}
+
+  // Returns true while the elements are still held in the inline storage.
+  bool is_inline() const {
+    return this->_data == inline_data();
+  }
+};
+
 // Custom STL-style iterator to iterate over GrowableArrays
 // It is constructed by invoking GrowableArray::begin() and GrowableArray::end()
 template <typename E>
@@ -160,35 +160,38 @@ ImageModuleData::~ImageModuleData() {
 
 
 // Return the module in which a package resides.    Returns NULL if not found.
+// Called for every class loaded from the image, so the common case works
+// from stack buffers without any heap allocation.
 const char* ImageModuleData::package_to_module(const char* package_name) {
-    // replace all '/' by '.'
-    char* replaced = new char[(int) strlen(package_name) + 1];
-    assert(replaced != NULL && "allocation failed");
+    // build path /packages/<package_name> with all '/' replaced by '.'
+    const char* radical = "/packages/";
+    size_t radical_len = strlen(radical);
+    size_t path_len = radical_len + strlen(package_name) + 1;
+    char path_buffer[256];
+    char* path = path_len <= sizeof(path_buffer) ? path_buffer : new char[path_len];
+    assert(path != NULL && "allocation failed");
+    memcpy(path, radical, radical_len);
     int i;
     for (i = 0; package_name[i] != '\0'; i++) {
-      replaced[i] = package_name[i] == '/' ? '.' : package_name[i];
+      path[radical_len + i] = package_name[i] == '/' ? '.' : package_name[i];
     }
-    replaced[i] = '\0';
-
-    // build path /packages/<package_name>
-    const char* radical = "/packages/";
-    char* path = new char[(int) strlen(radical) + (int) strlen(package_name) + 1];
-    assert(path != NULL && "allocation failed");
-    strcpy(path, radical);
-    strcat(path, replaced);
-    delete[] replaced;
+    path[radical_len + i] = '\0';
 
     // retrieve package location
     ImageLocation location;
     bool found = _image_file->find_location(path, location);
-    delete[] path;
+    if (path != path_buffer) {
+        delete[] path;
+    }
     if (!found) {
         return NULL;
     }
 
     // retrieve offsets to module name
     int size = (int)location.get_attribute(ImageLocation::ATTRIBUTE_UNCOMPRESSED);
-    u1* content = new u1[size];
+    // u4 elements keep the buffer aligned for the u4 reads below
+    u4 content_buffer[32];
+    u1* content = size <= (int)sizeof(content_buffer) ? (u1*)content_buffer : new u1[size];
     assert(content != NULL && "allocation failed");
     _image_file->get_resource(location, content);
     u1* ptr = content;
@@ -203,7 +206,9 @@ const char* ImageModuleData::package_to_module(const char* package_name) {
         }
         ptr += 4;
     }
-    delete[] content;
+    if (content != (u1*)content_buffer) {
+        delete[] content;
+    }
     return _image_file->get_strings().get(offset);
 }
 
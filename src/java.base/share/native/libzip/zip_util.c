@@ -659,6 +659,9 @@ readCEN(jzfile *zip, jint knownTotal)
                 jio_fprintf(stderr, "mmap failed for CEN and END part of zip file\n");
                 goto Catch;
             }
+            /* The whole CEN is walked right below, so ask for it to be
+             * read ahead rather than faulting it in page by page. */
+            madvise(zip->maddr, (size_t) zip->mlen, MADV_WILLNEED);
         }
         cenbuf = zip->maddr + cenpos - offset;
     } else
@@ -684,7 +687,7 @@ readCEN(jzfile *zip, jint knownTotal)
      */
     total = (knownTotal != -1) ? knownTotal : total;
     entries  = zip->entries  = calloc(total, sizeof(entries[0]));
-    tablelen = zip->tablelen = ((total/2) | 1); // Odd -> fewer collisions
+    tablelen = zip->tablelen = (total | 1); // Odd -> fewer collisions
     table    = zip->table    = malloc(tablelen * sizeof(table[0]));
     /* According to ISO C it is perfectly legal for malloc to return zero
      * if called with a zero argument. We check this for 'entries' but not
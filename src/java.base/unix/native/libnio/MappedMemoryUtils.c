@@ -40,6 +40,10 @@ typedef unsigned char mincore_vec_t;
 typedef char mincore_vec_t;
 #endif
 
+#if defined(__linux__) && !defined(MADV_POPULATE_READ)
+#define MADV_POPULATE_READ 22
+#endif
+
 jboolean JNICALL MappedMemoryUtils_isLoaded0(JNIEnv *env, jobject obj, jlong address,
                                              jlong len, jlong numPages)
 {
@@ -83,7 +87,17 @@ void JNICALL MappedMemoryUtils_load0(JNIEnv *env, jobject obj, jlong address,
                                      jlong len)
 {
     char *a = (char *)jlong_to_ptr(address);
-    int result = madvise((caddr_t)a, (size_t)len, MADV_WILLNEED);
+    int result;
+#ifdef __linux__
+    /* Populate the page tables up front so that the caller's page touching
+     * loop does not fault on every page. If that fails, e.g. with EINVAL on
+     * kernels before 5.14, fall back to the MADV_WILLNEED hint. */
+    result = madvise((caddr_t)a, (size_t)len, MADV_POPULATE_READ);
+    if (result == 0) {
+        return;
+    }
+#endif
+    result = madvise((caddr_t)a, (size_t)len, MADV_WILLNEED);
     if (result == -1) {
         JNU_ThrowIOExceptionWithMessageAndLastError(env, "madvise with advise MADV_WILLNEED failed");
     }
@@ -251,10 +251,15 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
-     int featureCount = 0;
-     char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
-     char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
+     /* Equivalent to parsing "kern"/"-kern" and "liga"/"-liga", without
+      * allocating and parsing feature strings on every call. */
+     hb_feature_t features[2] = {
+         { HB_TAG('k','e','r','n'), (flags & TYPO_KERN) ? 1 : 0,
+           HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END },
+         { HB_TAG('l','i','g','a'), (flags & TYPO_LIGA) ? 1 : 0,
+           HB_FEATURE_GLOBAL_START, HB_FEATURE_GLOBAL_END }
+     };
+     int featureCount = 2;
      jboolean ret;
      unsigned int buflen;
 
@@ -292,12 +297,6 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
 
      hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
-
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
      glyphInfo = hb_buffer_get_glyph_infos(buffer, 0);
@@ -310,7 +309,6 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
      (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
      return ret;
 }
@@ -33,3 +33,33 @@ TEST_VM(G1Analytics, is_initialized) {
   ASSERT_EQ(a.long_term_pause_time_ratio(), 0.0);
   ASSERT_EQ(a.short_term_pause_time_ratio(), 0.0);
 }
+
+TEST_VM(G1Analytics, copy_cost_by_source) {
+  // No confidence factor so that predictions equal the sample averages.
+  G1Predictions p(0.0);
+  G1Analytics a(&p);
+
+  const size_t bytes = 1000000;
+  // Without samples the per-source predictions fall back to the global one.
+  for (uint i = 0; i < G1Analytics::NumCopySources; i++) {
+    G1Analytics::CopySource source = static_cast<G1Analytics::CopySource>(i);
+    ASSERT_EQ(a.predict_object_copy_time_ms(bytes, true),
+              a.predict_object_copy_time_ms(bytes, source, true));
+  }
+
+  size_t copied[G1Analytics::NumCopySources] = { bytes, 0, 0 };
+  for (uint i = 0; i < 3; i++) {
+    a.report_object_copy_time_ms(10.0, copied, true);
+  }
+  ASSERT_NEAR(10.0, a.predict_object_copy_time_ms(bytes, G1Analytics::CopyFromEden, true), 1e-6);
+  // Sources that did not dominate any pause still use the global prediction.
+  ASSERT_EQ(a.predict_object_copy_time_ms(bytes, true),
+            a.predict_object_copy_time_ms(bytes, G1Analytics::CopyFromOld, true));
+
+  // Mostly old bytes: the time not explained by eden is attributed to old.
+  size_t mixed[G1Analytics::NumCopySources] = { bytes / 4, 0, bytes };
+  for (uint i = 0; i < 3; i++) {
+    a.report_object_copy_time_ms(2.5 + 40.0, mixed, false);
+  }
+  ASSERT_NEAR(40.0, a.predict_object_copy_time_ms(bytes, G1Analytics::CopyFromOld, false), 1e-6);
+}
@@ -78,6 +78,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_coarsen_dense_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -383,6 +384,54 @@ void G1CardSetTest::cardset_basic_test() {
   }
 }
 
+void G1CardSetTest::cardset_coarsen_dense_test() {
+
+  const uint CardsPerRegion = 2048;
+  const double FullCardSetThreshold = 0.8;
+  const double BitmapCoarsenThreshold = 0.9;
+
+  G1CardSetConfiguration config(28,
+                                BitmapCoarsenThreshold,
+                                8,
+                                FullCardSetThreshold,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  // Region 1 gets a Howl container, region 2 stays sparse.
+  const uint NumDenseCards = 200;
+  for (uint i = 0; i < NumDenseCards; i++) {
+    ASSERT_TRUE(card_set.add_card(1, i * 3) == Added);
+  }
+  uint cards2[] = { 5, 700, 1200 };
+  translate_cards(CardsPerRegion, 2, cards2, ARRAY_SIZE(cards2));
+  add_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2), nullptr);
+
+  ASSERT_EQ(G1CardSet::ContainerHowl, G1CardSet::container_type(card_set.get_container(1)->_container));
+  ASSERT_NE(G1CardSet::FullCardSet, card_set.get_container(1)->_container);
+  ASSERT_EQ(NumDenseCards + ARRAY_SIZE(cards2), card_set.occupied());
+
+  // Threshold above the occupancy of region 1: nothing to do.
+  ASSERT_EQ(0u, card_set.coarsen_dense_containers(NumDenseCards + 1));
+  ASSERT_EQ(NumDenseCards + ARRAY_SIZE(cards2), card_set.occupied());
+
+  ASSERT_EQ(1u, card_set.coarsen_dense_containers(NumDenseCards / 2));
+  ASSERT_EQ(G1CardSet::FullCardSet, card_set.get_container(1)->_container);
+  ASSERT_EQ(CardsPerRegion + ARRAY_SIZE(cards2), card_set.occupied());
+
+  // All previously added cards are still contained.
+  for (uint i = 0; i < NumDenseCards; i++) {
+    ASSERT_TRUE(card_set.contains_card(1, i * 3));
+  }
+  contains_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2));
+
+  // Already full containers are not coarsened again.
+  ASSERT_EQ(0u, card_set.coarsen_dense_containers(1));
+}
+
 class G1CardSetMtTestTask : public WorkerTask {
   G1CardSet* _card_set;
 
@@ -486,3 +535,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, coarsen_dense_cardset_test) {
+  G1CardSetTest::cardset_coarsen_dense_test();
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gcTelemetry.hpp"
+#include "unittest.hpp"
+
+TEST(GCLatencyHistogram, buckets) {
+  for (uint b = 0; b < GCLatencyHistogram::NumBuckets; b++) {
+    uint64_t lower = GCLatencyHistogram::bucket_lower_bound(b);
+    EXPECT_EQ(b, GCLatencyHistogram::bucket_for(lower)) << "bucket " << b;
+    if (b > 0) {
+      EXPECT_EQ(b - 1, GCLatencyHistogram::bucket_for(lower - 1)) << "bucket " << b;
+    }
+  }
+  EXPECT_EQ(GCLatencyHistogram::NumBuckets - 1, GCLatencyHistogram::bucket_for(UINT64_MAX));
+}
+
+TEST(GCLatencyHistogram, percentiles) {
+  static GCLatencyHistogram h;
+  h.reset();
+  EXPECT_EQ(0u, h.percentile(50.0));
+
+  for (uint64_t us = 1; us <= 1000; us++) {
+    h.record(us);
+  }
+  EXPECT_EQ(1000u, h.total_count());
+  EXPECT_EQ(1000u, h.max_us());
+  EXPECT_EQ(500500u, h.total_us());
+
+  // Percentiles are bucket upper bounds, within 25% above the exact value
+  uint64_t p50 = h.percentile(50.0);
+  EXPECT_GE(p50, 500u);
+  EXPECT_LE(p50, 625u);
+  uint64_t p99 = h.percentile(99.0);
+  EXPECT_GE(p99, 990u);
+  EXPECT_LE(p99, 1000u);
+  EXPECT_EQ(1000u, h.percentile(100.0));
+
+  h.reset();
+  EXPECT_EQ(0u, h.total_count());
+  EXPECT_EQ(0u, h.max_us());
+}
@@ -530,6 +530,31 @@ TEST_VM_F(OopStorageTest, bulk_allocation) {
   }
 }
 
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t num_entries = 100;
+  oop* entries[num_entries] = {};
+
+  OopStorageAllocationCache cache;
+  for (size_t i = 0; i < num_entries; ++i) {
+    entries[i] = cache.allocate(&storage());
+    ASSERT_NE(nullptr, entries[i]);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, storage().allocation_status(entries[i]));
+    EXPECT_EQ(i + 1, storage().allocation_count());
+  }
+  for (size_t i = 0; i < num_entries; ++i) {
+    for (size_t j = i + 1; j < num_entries; ++j) {
+      EXPECT_NE(entries[i], entries[j]);
+    }
+  }
+
+  storage().release(entries, num_entries);
+  EXPECT_EQ(0u, storage().allocation_count());
+  EXPECT_NE(0u, cache.count());
+  cache.flush(&storage());
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(0u, storage().allocation_count());
+}
+
 TEST_VM_F(OopStorageTest, invalid_malloc_pointer) {
   char* mem = NEW_C_HEAP_ARRAY(char, 1000, mtInternal);
   oop* ptr = reinterpret_cast<oop*>(align_down(mem + 250, sizeof(oop)));
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.hpp"
+#include "testutils.hpp"
+#include "unittest.hpp"
+
+// Baseline single-threaded timings for GenericTaskQueue. Only run with
+// -benchmark.
+
+typedef GenericTaskQueue<uintptr_t, mtTest> BenchTaskQueue;
+
+static const size_t bench_batch = 1024;
+
+TEST_VM(TaskQueueBenchmark, push_pop_local) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  uintptr_t sum = 0;
+  GtestBenchmark::run("GenericTaskQueue, one op = 1024 push + pop_local", 256, [&]() {
+    for (uintptr_t i = 0; i < bench_batch; i++) {
+      queue->push(i);
+    }
+    uintptr_t t;
+    while (queue->pop_local(t)) {
+      sum += t;
+    }
+  });
+  EXPECT_TRUE(queue->is_empty());
+  EXPECT_GT(sum, (uintptr_t)0);
+
+  delete queue;
+}
+
+TEST_VM(TaskQueueBenchmark, push_pop_global) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  BenchTaskQueue* queue = new BenchTaskQueue();
+  uintptr_t sum = 0;
+  GtestBenchmark::run("GenericTaskQueue, one op = 1024 push + pop_global", 256, [&]() {
+    for (uintptr_t i = 0; i < bench_batch; i++) {
+      queue->push(i);
+    }
+    uintptr_t t;
+    while (queue->pop_global(t) == BenchTaskQueue::PopResult::Success) {
+      sum += t;
+    }
+  });
+  EXPECT_TRUE(queue->is_empty());
+  EXPECT_GT(sum, (uintptr_t)0);
+
+  delete queue;
+}
@@ -26,6 +26,7 @@
 #include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "testutils.hpp"
 #include "unittest.hpp"
 
 #include <stdio.h>
@@ -175,6 +176,25 @@ static bool get_spawn_new_main_thread_arg(int argc, char** argv) {
   return DEFAULT_SPAWN_IN_NEW_THREAD;
 }
 
+static int get_benchmark_iterations_arg(int argc, char** argv) {
+  // -benchmark[=<iterations>]
+  for (int i = 0; i < argc; i++) {
+    if (is_prefix("-benchmark", argv[i])) {
+      const char* v = argv[i] + strlen("-benchmark");
+      if (strlen(v) == 0) {
+        return GtestBenchmark::default_iterations;
+      }
+      int iterations = 0;
+      if (v[0] == '=' && sscanf(v + 1, "%d", &iterations) == 1 && iterations > 0) {
+        return iterations;
+      }
+      fprintf(stderr, "Invalid value for -benchmark (%s)\n", v);
+      return GtestBenchmark::default_iterations;
+    }
+  }
+  return 0;
+}
+
 static int num_args_to_skip(char* arg) {
   if (strcmp(arg, "-jdk") == 0) {
     return 2; // skip the argument after -jdk as well
@@ -188,6 +208,9 @@ static int num_args_to_skip(char* arg) {
   if (is_prefix("-new-thread", arg)) {
     return 1;
   }
+  if (is_prefix("-benchmark", arg)) {
+    return 1;
+  }
   return 0;
 }
 
@@ -267,6 +290,7 @@ static void runUnitTestsInner(int argc, char** argv) {
   sprintf_s(envString, len, "%s=%s", java_home_var, java_home);
   _putenv(envString);
 #endif // _WIN32
+  GtestBenchmark::set_iterations(get_benchmark_iterations_arg(argc, argv));
   argv = remove_test_runner_arguments(&argc, argv);
 
 
@@ -31,6 +31,7 @@
 #include "metaspaceGtestCommon.hpp"
 
 using metaspace::ArenaGrowthPolicy;
+using metaspace::ArenaSizeHistory;
 using metaspace::chunklevel_t;
 using namespace metaspace::chunklevel;
 
@@ -70,3 +71,22 @@ DEFINE_GROWTH_POLICY_TEST(StandardMetaspaceType, false)
 DEFINE_GROWTH_POLICY_TEST(BootMetaspaceType, true)
 DEFINE_GROWTH_POLICY_TEST(BootMetaspaceType, false)
 
+TEST_VM(metaspace, arena_size_history) {
+  static int key1, key2;
+
+  // Nothing recorded yet for this key
+  ASSERT_EQ(ArenaSizeHistory::predicted_first_level(&key2, false), INVALID_CHUNK_LEVEL);
+
+  ArenaSizeHistory::record(&key1, false, 100);
+  ArenaSizeHistory::record(&key1, true, word_size_for_level(CHUNK_LEVEL_2K) + 1);
+  ASSERT_EQ(ArenaSizeHistory::predicted_first_level(&key1, false), CHUNK_LEVEL_1K);
+  ASSERT_EQ(ArenaSizeHistory::predicted_first_level(&key1, true), CHUNK_LEVEL_4K);
+
+  // A later arena of the same key replaces the prediction
+  ArenaSizeHistory::record(&key1, false, word_size_for_level(CHUNK_LEVEL_8K));
+  ASSERT_EQ(ArenaSizeHistory::predicted_first_level(&key1, false), CHUNK_LEVEL_8K);
+
+  // An empty arena gives no prediction
+  ArenaSizeHistory::record(&key1, true, 0);
+  ASSERT_EQ(ArenaSizeHistory::predicted_first_level(&key1, true), INVALID_CHUNK_LEVEL);
+}
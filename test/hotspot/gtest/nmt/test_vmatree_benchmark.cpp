@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "nmt/memTag.hpp"
+#include "nmt/nmtNativeCallStackStorage.hpp"
+#include "nmt/vmatree.hpp"
+#include "testutils.hpp"
+#include "unittest.hpp"
+
+// Baseline timings for VMATree mapping operations. Only run with -benchmark.
+
+static const size_t bench_regions = 16 * K;
+static const VMATree::position bench_region_size = 64 * K;
+
+TEST_VM(VMATreeBenchmark, reserve_commit_release) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  VMATree::RegionData rd(NativeCallStackStorage::StackIndex(), mtTest);
+  VMATree::RegionData rd_other(NativeCallStackStorage::StackIndex(), mtThreadStack);
+
+  GtestBenchmark::run("VMATree reserve, commit half and release, 16K regions", 1, [&]() {
+    VMATree tree;
+    // Alternate tags so that neighbouring reservations are not merged.
+    for (size_t i = 0; i < bench_regions; i++) {
+      tree.reserve_mapping(i * bench_region_size, bench_region_size, (i & 1) ? rd : rd_other);
+    }
+    for (size_t i = 0; i < bench_regions; i++) {
+      tree.commit_mapping(i * bench_region_size, bench_region_size / 2, (i & 1) ? rd : rd_other);
+    }
+    for (size_t i = 0; i < bench_regions; i++) {
+      tree.release_mapping(i * bench_region_size, bench_region_size);
+    }
+  });
+}
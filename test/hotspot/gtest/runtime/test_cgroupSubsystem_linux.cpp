@@ -421,6 +421,32 @@ TEST(cgroupTest, read_numerical_key_file_not_exist) {
   EXPECT_EQ((julong)0xBAD, a) << "Expected untouched scan value";
 }
 
+TEST(cgroupTest, parse_memory_pressure_some_avg10) {
+  double result = -1.0;
+  bool ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("some avg10=0.00 avg60=0.00 avg300=0.00 total=0", &result);
+  EXPECT_TRUE(ok) << "Pressure parsing should have been successful";
+  EXPECT_EQ(0.0, result);
+
+  ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("some avg10=12.50 avg60=3.10 avg300=0.80 total=123456\n", &result);
+  EXPECT_TRUE(ok) << "Pressure parsing should have been successful";
+  EXPECT_EQ(12.5, result);
+
+  result = -1.0;
+  ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("full avg10=1.00 avg60=0.00 avg300=0.00 total=0", &result);
+  EXPECT_FALSE(ok) << "Only the 'some' line should be accepted";
+  EXPECT_EQ(-1.0, result);
+
+  ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("some avg10=abc", &result);
+  EXPECT_FALSE(ok) << "Non-numeric value should fail";
+
+  ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("some avg10=101.00 avg60=0.00 avg300=0.00 total=0", &result);
+  EXPECT_FALSE(ok) << "Percentages above 100 should fail";
+
+  ok = CgroupV2MemoryController::parse_memory_pressure_some_avg10("", &result);
+  EXPECT_FALSE(ok) << "Empty line should fail";
+  EXPECT_EQ(-1.0, result);
+}
+
 TEST(cgroupTest, set_cgroupv1_subsystem_path) {
   TestCase host = {
     "/sys/fs/cgroup/memory",                                             // mount_path
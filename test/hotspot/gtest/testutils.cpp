@@ -67,3 +67,18 @@ bool GtestUtils::is_range_marked(const void* p, size_t s, uint8_t expected) {
 
   return first_wrong == nullptr;
 }
+
+int GtestBenchmark::_iterations = 0;
+
+jlong GtestBenchmark::now() {
+  return os::javaTimeNanos();
+}
+
+void GtestBenchmark::report(const char* name, size_t ops, jlong min_ns, jlong total_ns, jlong max_ns) {
+  assert(_iterations > 0 && ops > 0, "must have measured something");
+  tty->print_cr("benchmark %s: " SIZE_FORMAT " ops x %d iterations, ns/op min %.2f avg %.2f max %.2f",
+                name, ops, _iterations,
+                (double)min_ns / ops,
+                (double)total_ns / _iterations / ops,
+                (double)max_ns / ops);
+}
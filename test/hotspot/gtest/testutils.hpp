@@ -47,6 +47,52 @@ class GtestUtils : public AllStatic {
 
 };
 
+// Timing support for benchmark-style tests. Benchmarks only run when the
+// launcher is started with -benchmark[=<iterations>]; otherwise they skip
+// themselves so that regular test runs are not slowed down.
+class GtestBenchmark : public AllStatic {
+  static int _iterations;
+
+  static jlong now();
+  static void report(const char* name, size_t ops, jlong min_ns, jlong total_ns, jlong max_ns);
+
+public:
+  static const int default_iterations = 5;
+
+  static void set_iterations(int iterations) { _iterations = iterations; }
+  static bool is_enabled()                    { return _iterations > 0; }
+  static int iterations()                     { return _iterations; }
+
+  // Runs one warmup iteration, then the configured number of measured
+  // iterations, each calling op() ops_per_iteration times. Prints the
+  // minimum, average and maximum time per operation over the iterations.
+  template <typename F>
+  static void run(const char* name, size_t ops_per_iteration, F op) {
+    for (size_t i = 0; i < ops_per_iteration; i++) {
+      op();
+    }
+    jlong min_ns = max_jlong;
+    jlong max_ns = 0;
+    jlong total_ns = 0;
+    for (int it = 0; it < _iterations; it++) {
+      jlong start = now();
+      for (size_t i = 0; i < ops_per_iteration; i++) {
+        op();
+      }
+      jlong elapsed = now() - start;
+      min_ns = MIN2(min_ns, elapsed);
+      max_ns = MAX2(max_ns, elapsed);
+      total_ns += elapsed;
+    }
+    report(name, ops_per_iteration, min_ns, total_ns, max_ns);
+  }
+};
+
+#define SKIP_UNLESS_BENCHMARKING()                                      \
+  if (!GtestBenchmark::is_enabled()) {                                  \
+    GTEST_SKIP() << "Benchmarks only run with -benchmark";              \
+  }
+
 #define ASSERT_RANGE_IS_MARKED_WITH(p, size, mark)  ASSERT_TRUE(GtestUtils::is_range_marked(p, size, mark))
 #define ASSERT_RANGE_IS_MARKED(p, size)             ASSERT_TRUE(GtestUtils::is_range_marked(p, size))
 #define EXPECT_RANGE_IS_MARKED_WITH(p, size, mark)  EXPECT_TRUE(GtestUtils::is_range_marked(p, size, mark))
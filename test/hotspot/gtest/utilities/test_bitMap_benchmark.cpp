@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "testutils.hpp"
+#include "unittest.hpp"
+
+// Baseline timings for common BitMap operations. Only run with -benchmark.
+
+static const BitMap::idx_t bench_bits = 1 * M;
+static volatile size_t bench_sink = 0;
+
+TEST_VM(BitMapBenchmark, iterate_and_count) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  CHeapBitMap map(bench_bits, mtTest);
+  for (BitMap::idx_t i = 0; i < bench_bits; i += 7) {
+    map.set_bit(i);
+  }
+
+  size_t found = 0;
+  GtestBenchmark::run("BitMap::iterate, 1M bits, every 7th set", 16, [&]() {
+    map.iterate([&](BitMap::idx_t index) {
+      found++;
+      return true;
+    });
+  });
+  EXPECT_GT(found, (size_t)0);
+
+  GtestBenchmark::run("BitMap::count_one_bits, 1M bits", 16, [&]() {
+    bench_sink += map.count_one_bits();
+  });
+}
+
+TEST_VM(BitMapBenchmark, set_and_par_set) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  CHeapBitMap map(bench_bits, mtTest);
+  BitMap::idx_t next = 0;
+  GtestBenchmark::run("BitMap::set_bit", bench_bits, [&]() {
+    map.set_bit(next);
+    next = (next + 1) & (bench_bits - 1);
+  });
+
+  map.clear_range(0, bench_bits);
+  GtestBenchmark::run("BitMap::par_set_bit", bench_bits, [&]() {
+    bench_sink += map.par_set_bit(next) ? 1 : 0;
+    next = (next + 1) & (bench_bits - 1);
+  });
+}
@@ -27,6 +27,7 @@
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "testutils.hpp"
 #include "unittest.hpp"
 
 using idx_t = BitMap::idx_t;
@@ -59,6 +60,18 @@ static void test_iterate_lambda(const BitMap& map,
   ASSERT_EQ(positions_index, positions_size);
 }
 
+static void test_iterate_dense_lambda(const BitMap& map,
+                                      const idx_t* positions,
+                                      size_t positions_size) {
+  SCOPED_TRACE("iterate dense with lambda");
+  size_t positions_index = 0;
+  auto f = [&](idx_t i) {
+    test_iterate_step(map, i, positions, positions_index++, positions_size);
+  };
+  ASSERT_TRUE(map.iterate_dense(f));
+  ASSERT_EQ(positions_index, positions_size);
+}
+
 static void test_reverse_iterate_lambda(const BitMap& map,
                                         const idx_t* positions,
                                         size_t positions_size) {
@@ -234,6 +247,7 @@ static void test_iterate(BitMap& map,
   fill_iterate_map(map, positions, positions_size);
 
   test_iterate_lambda(map, positions, positions_size);
+  test_iterate_dense_lambda(map, positions, positions_size);
   test_iterate_closure(map, positions, positions_size);
   test_iterate_non_closure(map, positions, positions_size);
 
@@ -300,6 +314,11 @@ TEST(BitMap, iterate_early_termination) {
   ASSERT_LT(positions_index, positions_size);
   ASSERT_EQ(positions[positions_index], stop_at);
 
+  positions_index = 0;
+  ASSERT_FALSE(test_map.iterate_dense(f));
+  ASSERT_LT(positions_index, positions_size);
+  ASSERT_EQ(positions[positions_index], stop_at);
+
   struct Closure : public BitMapClosure {
     const BitMap& _map;
     const idx_t* _positions;
@@ -329,3 +348,54 @@ TEST(BitMap, iterate_early_termination) {
   ASSERT_LT(closure._positions_index, positions_size);
   ASSERT_EQ(positions[closure._positions_index], stop_at);
 }
+
+TEST(BitMap, iterate_dense_range_and_mask) {
+  bm_word_t test_data[BITMAP_WORD_SIZE];
+  BitMapView test_map{test_data, BITMAP_SIZE};
+  test_map.set_range(0, BITMAP_SIZE);
+
+  const bm_word_t even_bits = ~(bm_word_t)0 / 3;
+
+  for (idx_t beg = 0; beg < 3 * BitsPerWord; beg += 7) {
+    for (idx_t end = beg; end < BITMAP_SIZE; end += 61) {
+      idx_t expected = beg;
+      test_map.iterate_dense([&](idx_t i) {
+        EXPECT_EQ(expected, i);
+        expected = i + 1;
+      }, beg, end);
+      ASSERT_EQ(expected, end);
+
+      idx_t expected_even = align_up(beg, 2);
+      test_map.iterate_dense([&](idx_t i) {
+        EXPECT_EQ(expected_even, i);
+        expected_even = i + 2;
+      }, beg, end, even_bits);
+      ASSERT_EQ(expected_even, align_up(end, 2));
+    }
+  }
+}
+
+// Compare the cost of iterate and iterate_dense over a densely populated
+// bitmap, the common case for remembered sets of old pages. Only run with
+// -benchmark.
+TEST_VM(BitMap, iterate_dense_benchmark) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  const idx_t size = 4 * M;
+  CHeapBitMap map(size, mtTest);
+  for (idx_t i = 0; i < size; i += 3) {
+    map.set_bit(i);
+  }
+
+  idx_t sum_iterate = 0;
+  GtestBenchmark::run("BitMap::iterate, 4M bits, every 3rd set", 1, [&]() {
+    map.iterate([&](idx_t i) { sum_iterate += i; });
+  });
+
+  idx_t sum_dense = 0;
+  GtestBenchmark::run("BitMap::iterate_dense, 4M bits, every 3rd set", 1, [&]() {
+    map.iterate_dense([&](idx_t i) { sum_dense += i; });
+  });
+
+  ASSERT_EQ(sum_iterate, sum_dense);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "testutils.hpp"
+#include "unittest.hpp"
+
+// Baseline single-threaded timings for ConcurrentHashTable. Only run with
+// -benchmark.
+
+struct BenchCHTConfig : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    // Spread consecutive keys over the buckets.
+    return (uintx)(value * 0x9E3779B97F4A7C15ull);
+  }
+  static void* allocate_node(void* context, size_t size, const Value& value) {
+    return AllocateHeap(size, mtTest);
+  }
+  static void free_node(void* context, void* memory, const Value& value) {
+    FreeHeap(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchCHTConfig, mtTest> BenchCHT;
+
+struct BenchCHTLookup {
+  uintptr_t _val;
+  BenchCHTLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    return BenchCHTConfig::get_hash(_val, nullptr);
+  }
+  bool equals(const uintptr_t* value) {
+    return _val == *value;
+  }
+  bool is_dead(const uintptr_t* value) {
+    return false;
+  }
+};
+
+struct BenchCHTFound {
+  uintptr_t _found;
+  BenchCHTFound() : _found(0) {}
+  void operator()(uintptr_t* value) {
+    _found = *value;
+  }
+};
+
+static const uintptr_t bench_entries = 64 * K;
+
+TEST_VM(ConcurrentHashTableBenchmark, get) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  Thread* thr = Thread::current();
+  BenchCHT* cht = new BenchCHT(16);
+  for (uintptr_t i = 0; i < bench_entries; i++) {
+    BenchCHTLookup lookup(i);
+    cht->insert(thr, lookup, i);
+  }
+
+  uintptr_t next = 0;
+  uintptr_t hits = 0;
+  GtestBenchmark::run("ConcurrentHashTable::get, 64K entries", bench_entries, [&]() {
+    BenchCHTLookup lookup(next);
+    BenchCHTFound found;
+    if (cht->get(thr, lookup, found)) {
+      hits++;
+    }
+    next = (next + 1) % bench_entries;
+  });
+  EXPECT_EQ(hits, (uintptr_t)(GtestBenchmark::iterations() + 1) * bench_entries);
+
+  delete cht;
+}
+
+TEST_VM(ConcurrentHashTableBenchmark, insert_remove) {
+  SKIP_UNLESS_BENCHMARKING();
+
+  Thread* thr = Thread::current();
+  BenchCHT* cht = new BenchCHT(16);
+  uintptr_t next = 0;
+  GtestBenchmark::run("ConcurrentHashTable::insert + remove", bench_entries, [&]() {
+    BenchCHTLookup lookup(next);
+    cht->insert(thr, lookup, next);
+    cht->remove(thr, lookup);
+    next++;
+  });
+
+  delete cht;
+}
@@ -690,3 +690,28 @@ TEST(GrowableArrayCHeap, returning_references_works_as_expected) {
   EXPECT_EQ(5, first);
   EXPECT_EQ(5, last);
 }
+
+TEST_VM(InlineGrowableArray, grows_out_of_inline_storage) {
+  ResourceMark rm;
+  InlineGrowableArray<int, 4> arr;
+  EXPECT_TRUE(arr.is_inline());
+  EXPECT_EQ(4, arr.capacity());
+
+  for (int i = 0; i < 4; i++) {
+    arr.append(i);
+  }
+  EXPECT_TRUE(arr.is_inline());
+
+  for (int i = 4; i < 20; i++) {
+    arr.append(i);
+  }
+  EXPECT_FALSE(arr.is_inline());
+  EXPECT_EQ(20, arr.length());
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(i, arr.at(i));
+  }
+
+  // Usable through the common view type
+  const GrowableArrayView<int>* view = &arr;
+  EXPECT_EQ(19, view->last());
+}
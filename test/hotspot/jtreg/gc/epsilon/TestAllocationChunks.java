@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.epsilon;
+
+/*
+ * @test TestAllocationChunks
+ * @summary Allocate from many threads with TLABs carved from per-CPU or per-NUMA-node
+ * chunks, and walk the heap while chunks are in use.
+ * @requires vm.gc.Epsilon
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -Xmx1g
+ *                   -XX:EpsilonAllocationChunkSize=1m
+ *                   gc.epsilon.TestAllocationChunks
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -Xmx1g
+ *                   -XX:EpsilonAllocationChunkSize=1m -XX:+UseNUMA
+ *                   gc.epsilon.TestAllocationChunks
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -Xmx1g
+ *                   -XX:EpsilonAllocationChunkSize=1m -XX:-EpsilonElasticTLAB -XX:EpsilonMaxTLABSize=4k
+ *                   gc.epsilon.TestAllocationChunks
+ */
+
+import java.io.File;
+import java.lang.management.ManagementFactory;
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+public class TestAllocationChunks {
+    private static final int NUM_THREADS = 8;
+    private static final int NUM_OBJECTS = 100_000;
+
+    static class Node {
+        final int id;
+        final Node next;
+
+        Node(int id, Node next) {
+            this.id = id;
+            this.next = next;
+        }
+    }
+
+    static void allocate() {
+        Node head = null;
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            head = new Node(i, head);
+        }
+        for (int i = NUM_OBJECTS - 1; i >= 0; i--) {
+            if (head.id != i) {
+                throw new RuntimeException("Unexpected id " + head.id + ", expected " + i);
+            }
+            head = head.next;
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        HotSpotDiagnosticMXBean bean = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        for (int round = 0; round < 3; round++) {
+            Thread[] threads = new Thread[NUM_THREADS];
+            for (int t = 0; t < NUM_THREADS; t++) {
+                threads[t] = new Thread(TestAllocationChunks::allocate);
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            // Walks the heap, which needs the partially used chunks to be parsable.
+            File dump = new File("TestAllocationChunks-" + round + ".hprof");
+            bean.dumpHeap(dump.getPath(), false);
+            dump.delete();
+        }
+    }
+}
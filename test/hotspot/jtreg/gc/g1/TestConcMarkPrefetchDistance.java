@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestConcMarkPrefetchDistance
+ * @summary Run concurrent marking with prefetching of mark queue entries and verify the marking results.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:G1ConcMarkPrefetchDistance=1
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyDuringGC -XX:+ExplicitGCInvokesConcurrent
+ *                   -Xmx128m -Xlog:gc+stats=debug gc.g1.TestConcMarkPrefetchDistance
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:G1ConcMarkPrefetchDistance=7
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyDuringGC -XX:+ExplicitGCInvokesConcurrent
+ *                   -Xmx128m gc.g1.TestConcMarkPrefetchDistance
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:G1ConcMarkPrefetchDistance=16
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyDuringGC -XX:+ExplicitGCInvokesConcurrent
+ *                   -Xmx128m gc.g1.TestConcMarkPrefetchDistance
+ */
+
+import java.util.ArrayList;
+import java.util.Random;
+
+public class TestConcMarkPrefetchDistance {
+    static class Node {
+        Node left;
+        Node right;
+        Object[] payload;
+    }
+
+    static Node build(Random r, int depth) {
+        if (depth == 0) {
+            return null;
+        }
+        Node n = new Node();
+        n.left = build(r, depth - 1);
+        n.right = build(r, depth - 1);
+        if (r.nextInt(16) == 0) {
+            n.payload = new Object[r.nextInt(1024)];
+        }
+        return n;
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        ArrayList<Node> roots = new ArrayList<>();
+        for (int i = 0; i < 20; i++) {
+            roots.add(build(r, 14));
+            if (roots.size() > 8) {
+                roots.remove(r.nextInt(roots.size()));
+            }
+            System.gc();
+        }
+        System.out.println(roots.size());
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Test to make sure that eager reclaim of humongous object arrays works. We simply try to
+ * fill up the heap with humongous object arrays referencing young objects that should be eagerly
+ * reclaimable to avoid Full GC, while keeping some of the referenced objects alive.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArrays
+ */
+
+import java.util.regex.Pattern;
+import java.util.regex.Matcher;
+import java.util.LinkedList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.Asserts;
+
+class TestEagerReclaimHumongousObjArraysReclaimRegionFast {
+    public static final int M = 1024*1024;
+
+    public static LinkedList<Object> garbageList = new LinkedList<Object>();
+
+    public static void genGarbage() {
+        for (int i = 0; i < 32*1024; i++) {
+            garbageList.add(new int[100]);
+        }
+        garbageList.clear();
+    }
+
+    // Objects referenced from the humongous object arrays that must stay alive.
+    static Object[] survivors = new Object[100];
+
+    public static void main(String[] args) {
+
+        Object[] large = new Object[M];
+
+        Object ref_from_stack = large;
+
+        for (int i = 0; i < 100; i++) {
+            // A large object array that will be reclaimed eagerly.
+            large = new Object[3*M/2];
+            for (int j = 0; j < large.length; j += 1024) {
+                large[j] = new int[4];
+            }
+            survivors[i] = large[i * 1024];
+            genGarbage();
+            // Make sure that the compiler cannot completely remove
+            // the allocation of the large object until here.
+            System.out.println(large);
+        }
+
+        for (Object o : survivors) {
+            Asserts.assertEquals(((int[])o).length, 4);
+        }
+
+        // Keep the reference to the first object alive.
+        System.out.println(ref_from_stack);
+    }
+}
+
+public class TestEagerReclaimHumongousObjArrays {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseG1GC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+G1EagerReclaimHumongousObjArrays",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+VerifyAfterGC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-Xmn16M",
+            "-Xlog:gc",
+            TestEagerReclaimHumongousObjArraysReclaimRegionFast.class.getName());
+
+        Pattern p = Pattern.compile("Full GC");
+
+        int found = 0;
+        Matcher m = p.matcher(output.getStdout());
+        while (m.find()) { found++; }
+        System.out.println("Issued " + found + " Full GCs");
+        Asserts.assertLT(found, 10, "Found that " + found + " Full GCs were issued. This is larger than the bound. Eager reclaim of object arrays seems to not work at all");
+
+        output.shouldHaveExitValue(0);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPostBarrierCardCache
+ * @summary Stress reference stores from old into young objects with the post-write barrier
+ * card cache enabled, and verify the remembered sets after every GC.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:+G1UsePostBarrierCardCache
+ *                   -XX:+ExplicitGCInvokesConcurrent -XX:MaxTenuringThreshold=0
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC -XX:+VerifyDuringGC
+ *                   -Xms64m -Xmx64m -Xmn8m -XX:G1UpdateBufferSize=16
+ *                   gc.g1.TestPostBarrierCardCache
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:+G1UsePostBarrierCardCache
+ *                   -XX:+ExplicitGCInvokesConcurrent -XX:MaxTenuringThreshold=0
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyAfterGC -XX:+VerifyDuringGC
+ *                   -Xms64m -Xmx64m -Xmn8m -Xint
+ *                   gc.g1.TestPostBarrierCardCache
+ */
+
+public class TestPostBarrierCardCache {
+    // Number of references per card with compressed oops.
+    private static final int REFS_PER_CARD = 512 / 4;
+    private static final int NUM_ARRAYS = 16;
+    private static final int ARRAY_LENGTH = 64 * REFS_PER_CARD;
+
+    static Object[][] oldArrays = new Object[NUM_ARRAYS][];
+
+    static class Value {
+        final int id;
+        Value(int id) { this.id = id; }
+    }
+
+    static void fill(Object[] a, int round) {
+        // Repeatedly store into the same card before moving to the next one,
+        // then store across cards in a round-robin fashion.
+        for (int i = 0; i < a.length; i++) {
+            a[i] = new Value(round + i);
+        }
+        for (int i = 0; i < REFS_PER_CARD; i++) {
+            for (int c = 0; c < a.length / REFS_PER_CARD; c++) {
+                int idx = c * REFS_PER_CARD + i;
+                a[idx] = new Value(round + idx);
+            }
+        }
+    }
+
+    static void check(Object[] a, int round) {
+        for (int i = 0; i < a.length; i++) {
+            if (((Value)a[i]).id != round + i) {
+                throw new RuntimeException("Unexpected value at index " + i);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < NUM_ARRAYS; i++) {
+            oldArrays[i] = new Object[ARRAY_LENGTH];
+        }
+        // Move the arrays into the old generation.
+        System.gc();
+
+        for (int round = 0; round < 200; round++) {
+            for (Object[] a : oldArrays) {
+                fill(a, round);
+            }
+            if (round % 50 == 49) {
+                // Trigger a concurrent cycle, including a Remark pause.
+                System.gc();
+            }
+            for (Object[] a : oldArrays) {
+                check(a, round);
+            }
+        }
+    }
+}
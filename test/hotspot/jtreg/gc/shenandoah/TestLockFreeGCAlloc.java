@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestLockFreeGCAlloc
+ * @summary Stress concurrent evacuation with GC allocations that bump the current
+ * collector region without the heap lock, and verify the heap after every cycle.
+ * @requires vm.gc.Shenandoah
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive
+ *                   -XX:+ShenandoahLockFreeGCAlloc -XX:+ShenandoahVerify
+ *                   -Xmx256m TestLockFreeGCAlloc
+ *
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive
+ *                   -XX:+ShenandoahLockFreeGCAlloc -XX:+ShenandoahOOMDuringEvacALot
+ *                   -Xmx256m TestLockFreeGCAlloc
+ */
+
+import java.util.concurrent.ThreadLocalRandom;
+
+public class TestLockFreeGCAlloc {
+    private static final int NUM_THREADS = 8;
+    private static final int NUM_OBJECTS = 20_000;
+    private static final long DURATION_MS = 5_000;
+
+    static class Node {
+        final int id;
+        final byte[] payload;
+        Node next;
+
+        Node(int id, int size) {
+            this.id = id;
+            this.payload = new byte[size];
+            this.payload[size - 1] = (byte)id;
+        }
+    }
+
+    static void churn() {
+        // Mutators evacuate the live objects they touch, racing with GC workers for GC allocations.
+        Node[] live = new Node[NUM_OBJECTS];
+        ThreadLocalRandom random = ThreadLocalRandom.current();
+        long end = System.currentTimeMillis() + DURATION_MS;
+        while (System.currentTimeMillis() < end) {
+            for (int i = 0; i < NUM_OBJECTS; i++) {
+                int idx = random.nextInt(NUM_OBJECTS);
+                Node n = live[idx];
+                if (n != null && (n.id != idx || n.payload[n.payload.length - 1] != (byte)idx)) {
+                    throw new RuntimeException("Corrupted object at index " + idx);
+                }
+                Node m = new Node(idx, 1 + random.nextInt(512));
+                m.next = live[random.nextInt(NUM_OBJECTS)];
+                live[idx] = m;
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[NUM_THREADS];
+        for (int t = 0; t < NUM_THREADS; t++) {
+            threads[t] = new Thread(TestLockFreeGCAlloc::churn);
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.stringdedup;
+
+/*
+ * @test TestStringDeduplicationThreads
+ * @summary Stress string deduplication with several deduplication threads while
+ * the table is concurrently grown, shrunk and cleaned of dead entries.
+ * @requires vm.gc.G1
+ * @run main/othervm --add-opens java.base/java.lang=ALL-UNNAMED
+ *                   -XX:+UseG1GC -XX:+UseStringDeduplication -XX:StringDeduplicationAgeThreshold=1
+ *                   -XX:+UnlockExperimentalVMOptions -XX:StringDeduplicationThreads=4
+ *                   -XX:StringDeduplicationInitialTableSize=1
+ *                   -XX:StringDeduplicationCleanupDeadMinimum=1 -XX:StringDeduplicationCleanupDeadPercent=1
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+StringDeduplicationResizeALot -XX:+VerifyAfterGC
+ *                   -Xms64m -Xmx64m
+ *                   gc.stringdedup.TestStringDeduplicationThreads
+ */
+
+import java.lang.reflect.Field;
+
+public class TestStringDeduplicationThreads {
+    private static final int NUM_THREADS = 4;
+    private static final int NUM_STRINGS = 2000;
+    private static final int NUM_ROUNDS = 40;
+    private static final long TIMEOUT_MS = 60_000;
+
+    private static Field valueField;
+
+    static String[][] retained = new String[NUM_THREADS][];
+
+    static String newString(int round, int i) {
+        // Distinct value arrays for equal strings, so they can be deduplicated.
+        return new String(("dedup-" + round + "-" + i).toCharArray());
+    }
+
+    static void churn(int id, int round) {
+        String[] strings = new String[NUM_STRINGS];
+        for (int i = 0; i < NUM_STRINGS; i++) {
+            strings[i] = newString(round, i);
+            // Short-lived duplicates that leave dead entries in the table.
+            for (int j = 0; j < 4; j++) {
+                newString(round - 1, i).hashCode();
+            }
+        }
+        retained[id] = strings;
+    }
+
+    static int countDeduplicated(int round) throws Exception {
+        int count = 0;
+        for (int i = 0; i < NUM_STRINGS; i++) {
+            Object first = valueField.get(retained[0][i]);
+            for (int t = 1; t < NUM_THREADS; t++) {
+                if (!retained[t][i].equals(newString(round, i))) {
+                    throw new RuntimeException("Corrupted string at index " + i + ": " + retained[t][i]);
+                }
+                if (valueField.get(retained[t][i]) == first) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    }
+
+    public static void main(String[] args) throws Exception {
+        valueField = String.class.getDeclaredField("value");
+        valueField.setAccessible(true);
+
+        for (int round = 0; round < NUM_ROUNDS; round++) {
+            final int r = round;
+            Thread[] threads = new Thread[NUM_THREADS];
+            for (int t = 0; t < NUM_THREADS; t++) {
+                final int id = t;
+                threads[t] = new Thread(() -> churn(id, r));
+                threads[t].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+            System.gc();
+        }
+
+        // The last round's strings are retained, so they are deduplicated
+        // against each other eventually.
+        int round = NUM_ROUNDS - 1;
+        long deadline = System.currentTimeMillis() + TIMEOUT_MS;
+        int count;
+        while ((count = countDeduplicated(round)) == 0) {
+            if (System.currentTimeMillis() > deadline) {
+                throw new RuntimeException("No strings were deduplicated");
+            }
+            System.gc();
+            Thread.sleep(100);
+        }
+        System.out.println("Deduplicated " + count + " strings");
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Resolved method CP entries archived in a dynamic archive must
+ *          dispatch to the same methods when the archive is used.
+ * @requires vm.cds
+ * @requires vm.compMode != "Xcomp"
+ * @library /test/lib
+ * @build ResolvedMethodEntries
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar app.jar
+ *                 ResolvedMethodEntriesApp ResolvedMethodEntriesIntf
+ *                 ResolvedMethodEntriesBase ResolvedMethodEntriesSub
+ * @run driver ResolvedMethodEntries
+ */
+
+import jdk.test.lib.helpers.ClassFileInstaller;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ResolvedMethodEntries {
+    static final String appJar = ClassFileInstaller.getJarPath("app.jar");
+    static final String mainClass = ResolvedMethodEntriesApp.class.getName();
+    static final String topArchive = "ResolvedMethodEntries-top.jsa";
+
+    public static void main(String[] args) throws Exception {
+        // Dump the dynamic archive at exit, after the app has resolved its call sites.
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:ArchiveClassesAtExit=" + topArchive,
+            "-Xlog:cds+resolve=trace",
+            "-cp", appJar, mainClass);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0)
+              .shouldContain("Hello ResolvedMethodEntriesApp")
+              // Entries that refer to a Method* are archived
+              .shouldMatch("cds,resolve.*archived interface method CP entry.*: ResolvedMethodEntriesSub ResolvedMethodEntriesIntf.intfCall:")
+              .shouldMatch("cds,resolve.*archived method CP entry.*: ResolvedMethodEntriesSub ResolvedMethodEntriesBase.finalCall:")
+              .shouldMatch("cds,resolve.*archived method CP entry.*: ResolvedMethodEntriesSub ResolvedMethodEntriesBase.superCall:")
+              .shouldMatch("cds,resolve.*archived method CP entry.*: ResolvedMethodEntriesApp ResolvedMethodEntriesApp.privateCall:")
+              // Entries that store a vtable index are not
+              .shouldMatch("cds,resolve.*reverted method CP entry.*: ResolvedMethodEntriesSub ResolvedMethodEntriesBase.virtualCall:");
+
+        // Run with the archive in the interpreter, which uses the archived
+        // entries as they are. The app checks the result of every call.
+        pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:SharedArchiveFile=" + topArchive,
+            "-Xshare:on", "-Xint",
+            "-Xlog:class+load",
+            "-cp", appJar, mainClass);
+        output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0)
+              .shouldContain("Hello ResolvedMethodEntriesApp")
+              .shouldMatch("ResolvedMethodEntriesSub source: shared objects file \\(top\\)");
+    }
+}
+
+interface ResolvedMethodEntriesIntf {
+    String intfCall();
+}
+
+class ResolvedMethodEntriesBase implements ResolvedMethodEntriesIntf {
+    public String intfCall()          { return "Base.intfCall"; }
+    public String virtualCall()       { return "Base.virtualCall"; }
+    public final String finalCall()   { return "Base.finalCall"; }
+    public String superCall()         { return "Base.superCall"; }
+}
+
+// Method resolution is only archived when the CP holder is a subtype of the
+// resolved class, so the call sites under test live here.
+class ResolvedMethodEntriesSub extends ResolvedMethodEntriesBase {
+    // Named so that sorting the methods in the dynamic archive moves them
+    // around relative to the inherited ones.
+    public String aaaCall()           { return "Sub.aaaCall"; }
+    public String intfCall()          { return "Sub.intfCall"; }
+    public String virtualCall()       { return "Sub.virtualCall"; }
+    public String superCall()         { return super.superCall(); } // invokespecial
+
+    String callIntf(ResolvedMethodEntriesIntf i)     { return i.intfCall(); }
+    String callVirtual(ResolvedMethodEntriesBase b)  { return b.virtualCall(); }
+    String callFinal(ResolvedMethodEntriesBase b)    { return b.finalCall(); }
+}
+
+class ResolvedMethodEntriesApp {
+    public static void main(String[] args) {
+        ResolvedMethodEntriesBase base = new ResolvedMethodEntriesBase();
+        ResolvedMethodEntriesSub sub = new ResolvedMethodEntriesSub();
+
+        check(sub.callIntf(base),    "Base.intfCall");
+        check(sub.callIntf(sub),     "Sub.intfCall");
+        check(sub.callVirtual(base), "Base.virtualCall");
+        check(sub.callVirtual(sub),  "Sub.virtualCall");
+        check(sub.callFinal(base),   "Base.finalCall");
+        check(sub.callFinal(sub),    "Base.finalCall");
+        check(sub.aaaCall(),         "Sub.aaaCall");
+        check(sub.superCall(),       "Base.superCall");
+        check(new ResolvedMethodEntriesApp().privateCall(), "App.privateCall");
+
+        System.out.println("Hello ResolvedMethodEntriesApp");
+    }
+
+    private String privateCall() { return "App.privateCall"; }
+
+    static void check(String actual, String expected) {
+        if (!actual.equals(expected)) {
+            throw new RuntimeException("Expected " + expected + " but got " + actual);
+        }
+    }
+}
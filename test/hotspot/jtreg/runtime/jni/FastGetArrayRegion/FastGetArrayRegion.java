@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Tests that the fast Get<Primitive>ArrayRegion accessors copy the
+ *          same elements and throw the same exceptions as the regular ones.
+ * @run main/othervm/native -XX:+UnlockExperimentalVMOptions -XX:-UseFastJNIArrayAccessors FastGetArrayRegion
+ * @run main/othervm/native -XX:+UnlockExperimentalVMOptions -XX:+UseFastJNIArrayAccessors FastGetArrayRegion
+ * @run main/othervm/native -XX:+UnlockExperimentalVMOptions -XX:+UseFastJNIArrayAccessors -XX:+UnlockDiagnosticVMOptions -XX:+SafepointALot -XX:GuaranteedSafepointInterval=1 FastGetArrayRegion
+ */
+
+import java.util.Arrays;
+
+public class FastGetArrayRegion {
+
+    private static final String lib = "FastGetArrayRegion";
+
+    static {
+        try {
+            System.loadLibrary(lib);
+        } catch (UnsatisfiedLinkError ex) {
+            System.err.println("Failed to load " + lib + " lib");
+            System.err.println("java.library.path: " + System.getProperty("java.library.path"));
+            throw ex;
+        }
+    }
+
+    // Each copies the region into a native buffer with Get<Primitive>ArrayRegion
+    // and returns the buffer contents as a new array.
+    private static native boolean[] getBooleanRegion(boolean[] a, int start, int len);
+    private static native byte[]    getByteRegion(byte[] a, int start, int len);
+    private static native char[]    getCharRegion(char[] a, int start, int len);
+    private static native short[]   getShortRegion(short[] a, int start, int len);
+    private static native int[]     getIntRegion(int[] a, int start, int len);
+    private static native long[]    getLongRegion(long[] a, int start, int len);
+    private static native float[]   getFloatRegion(float[] a, int start, int len);
+    private static native double[]  getDoubleRegion(double[] a, int start, int len);
+
+    interface Region {
+        Object get(int start, int len);
+        Object copy(int from, int to);
+    }
+
+    static final int loop_cnt = 200;
+
+    static final int[] lengths = { 0, 1, 2, 7, 8, 9, 64, 1000 };
+
+    static int[][] regions(int n) {
+        return new int[][] {
+            // Valid regions, including unaligned starts and tails
+            { 0, 0 }, { 0, n }, { 1, n - 1 }, { 1, n - 2 }, { 3, n - 5 },
+            { n / 2, n - n / 2 }, { n - 1, 1 }, { n, 0 },
+            // Out of bounds
+            { -1, 0 }, { -1, 1 }, { 0, -1 }, { n, 1 }, { n + 1, 0 }, { 1, n },
+            { 0, n + 1 }, { Integer.MAX_VALUE, 1 }, { 1, Integer.MAX_VALUE },
+            { Integer.MIN_VALUE, 0 }, { 0, Integer.MIN_VALUE }
+        };
+    }
+
+    static void check(String type, int n, Region r) {
+        for (int[] region : regions(n)) {
+            int start = region[0];
+            int len = region[1];
+            boolean oob = len < 0 || start < 0 || (long)start + len > n;
+            String what = type + "[" + n + "] region " + start + ", " + len;
+            Object actual;
+            try {
+                actual = r.get(start, len);
+            } catch (ArrayIndexOutOfBoundsException e) {
+                if (!oob) {
+                    throw new RuntimeException(what + ": unexpected exception", e);
+                }
+                continue;
+            }
+            if (oob) {
+                throw new RuntimeException(what + ": expected ArrayIndexOutOfBoundsException");
+            }
+            Object expected = r.copy(start, start + len);
+            if (!Arrays.deepEquals(new Object[] { expected }, new Object[] { actual })) {
+                throw new RuntimeException(what + ": wrong elements");
+            }
+        }
+    }
+
+    static void test(int n) {
+        boolean[] z = new boolean[n];
+        byte[]    b = new byte[n];
+        char[]    c = new char[n];
+        short[]   s = new short[n];
+        int[]     i = new int[n];
+        long[]    j = new long[n];
+        float[]   f = new float[n];
+        double[]  d = new double[n];
+        for (int k = 0; k < n; k++) {
+            z[k] = k % 3 == 0;
+            b[k] = (byte)(k * 31 + 7);
+            c[k] = (char)(k * 4099 + 7);
+            s[k] = (short)(k * 4099 + 7);
+            i[k] = k * 0x01000193 + 7;
+            j[k] = k * 0x100000001b3L + 7;
+            f[k] = k * 1.5f - 7;
+            d[k] = k * 1.5 - 7;
+        }
+
+        check("boolean", n, new Region() {
+            public Object get(int start, int len) { return getBooleanRegion(z, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(z, from, to); }
+        });
+        check("byte", n, new Region() {
+            public Object get(int start, int len) { return getByteRegion(b, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(b, from, to); }
+        });
+        check("char", n, new Region() {
+            public Object get(int start, int len) { return getCharRegion(c, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(c, from, to); }
+        });
+        check("short", n, new Region() {
+            public Object get(int start, int len) { return getShortRegion(s, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(s, from, to); }
+        });
+        check("int", n, new Region() {
+            public Object get(int start, int len) { return getIntRegion(i, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(i, from, to); }
+        });
+        check("long", n, new Region() {
+            public Object get(int start, int len) { return getLongRegion(j, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(j, from, to); }
+        });
+        check("float", n, new Region() {
+            public Object get(int start, int len) { return getFloatRegion(f, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(f, from, to); }
+        });
+        check("double", n, new Region() {
+            public Object get(int start, int len) { return getDoubleRegion(d, start, len); }
+            public Object copy(int from, int to)  { return Arrays.copyOfRange(d, from, to); }
+        });
+    }
+
+    public static void main(String[] args) {
+        // Repeat so that some calls overlap a safepoint when run with
+        // SafepointALot and fall back to the regular accessor.
+        for (int c = 0; c < loop_cnt; c++) {
+            for (int n : lengths) {
+                test(n);
+            }
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jni.h"
+
+// Larger than any array the test uses. Out of bounds requests get an
+// empty buffer, which the accessor must not write to.
+#define MAX_LEN 4096
+#define GUARD   0x5A
+
+static void throw_new(JNIEnv* env, const char* class_name, const char* msg) {
+  jclass c = (*env)->FindClass(env, class_name);
+  if (c != NULL) {
+    (*env)->ThrowNew(env, c, msg);
+  }
+}
+
+// Copies the region into a native buffer followed by a guard element, checks
+// that the guard is intact and returns the buffer contents as a new array.
+// Returns NULL with the accessor's exception pending if it threw.
+#define DEFINE_GET_REGION(Result, ElementType)                                       \
+JNIEXPORT ElementType##Array JNICALL                                                 \
+Java_FastGetArrayRegion_get##Result##Region(JNIEnv* env, jclass c,                   \
+                                            ElementType##Array array,                \
+                                            jint start, jint len) {                  \
+  jint n = (len > 0 && len <= MAX_LEN) ? len : 0;                                    \
+  ElementType guard;                                                                 \
+  ElementType* buf = (ElementType*)malloc((n + 1) * sizeof(ElementType));            \
+  ElementType##Array result = NULL;                                                  \
+  if (buf == NULL) {                                                                 \
+    throw_new(env, "java/lang/OutOfMemoryError", "malloc failed");                   \
+    return NULL;                                                                     \
+  }                                                                                  \
+  memset(&guard, GUARD, sizeof(ElementType));                                        \
+  memset(buf, GUARD, (n + 1) * sizeof(ElementType));                                 \
+  (*env)->Get##Result##ArrayRegion(env, array, start, len, buf);                     \
+  if (!(*env)->ExceptionCheck(env)) {                                                \
+    if (memcmp(&buf[n], &guard, sizeof(ElementType)) != 0) {                         \
+      throw_new(env, "java/lang/RuntimeException",                                   \
+                "Get" #Result "ArrayRegion wrote past the end of the region");       \
+    } else {                                                                         \
+      result = (*env)->New##Result##Array(env, n);                                   \
+      if (result != NULL) {                                                          \
+        (*env)->Set##Result##ArrayRegion(env, result, 0, n, buf);                    \
+      }                                                                              \
+    }                                                                                \
+  }                                                                                  \
+  free(buf);                                                                         \
+  return result;                                                                     \
+}
+
+DEFINE_GET_REGION(Boolean, jboolean)
+DEFINE_GET_REGION(Byte,    jbyte)
+DEFINE_GET_REGION(Char,    jchar)
+DEFINE_GET_REGION(Short,   jshort)
+DEFINE_GET_REGION(Int,     jint)
+DEFINE_GET_REGION(Long,    jlong)
+DEFINE_GET_REGION(Float,   jfloat)
+DEFINE_GET_REGION(Double,  jdouble)
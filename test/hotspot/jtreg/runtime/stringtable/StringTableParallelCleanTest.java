@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Clean dead StringTable entries with several worker threads
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver StringTableParallelCleanTest
+ */
+
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class StringTableParallelCleanTest {
+    private static final int NUM_STRINGS = 200_000;
+    private static final int NUM_ROUNDS = 10;
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions", "-XX:StringTableCleanupThreads=4",
+            "-Xlog:stringtable=debug", "-Xmx128m",
+            Interner.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Cleaned \\d+ of \\d+ using 4 workers");
+    }
+
+    static class Interner {
+        public static void main(String[] args) throws Exception {
+            for (int round = 0; round < NUM_ROUNDS; round++) {
+                String[] strings = new String[NUM_STRINGS];
+                for (int i = 0; i < NUM_STRINGS; i++) {
+                    strings[i] = ("StringTableParallelCleanTest-" + round + "-" + i).intern();
+                }
+                strings = null;
+                // Find the now dead strings, which triggers cleaning on the service thread.
+                System.gc();
+                Thread.sleep(200);
+            }
+        }
+    }
+}
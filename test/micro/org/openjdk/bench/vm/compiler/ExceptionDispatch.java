@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.*;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Throws preallocated exceptions from many sites and catches them in the
+ * caller, which exercises the exception handler lookup of compiled frames
+ * without the cost of filling in stack traces.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgs = {"-XX:-OmitStackTraceInFastThrow"})
+public class ExceptionDispatch {
+
+    static class ParseException extends RuntimeException {
+        ParseException() {
+            super(null, null, false, false);
+        }
+    }
+
+    static class OtherException extends RuntimeException {
+        OtherException() {
+            super(null, null, false, false);
+        }
+    }
+
+    static final ParseException PARSE = new ParseException();
+    static final OtherException OTHER = new OtherException();
+
+    private int value;
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    private int parse(int i) {
+        switch (i & 7) {
+            case 0: if (value >= 0) throw PARSE; break;
+            case 1: if (value >= 0) throw PARSE; break;
+            case 2: if (value >= 0) throw PARSE; break;
+            case 3: if (value >= 0) throw OTHER; break;
+            case 4: if (value >= 0) throw PARSE; break;
+            case 5: if (value >= 0) throw OTHER; break;
+            case 6: if (value >= 0) throw PARSE; break;
+            default: break;
+        }
+        return i;
+    }
+
+    @Benchmark
+    public int throwCatch() {
+        int result = 0;
+        for (int i = 0; i < 8; i++) {
+            try {
+                result += parse(i);
+            } catch (ParseException e) {
+                result--;
+            } catch (OtherException e) {
+                result -= 2;
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Float and double add/mul reductions, which the auto-vectorizer must compute
+ * in strict order. The scalar forks disable the vectorized form with
+ * -XX:-SuperWordOrderedFPReductions, which can also be set per method with
+ * CompileCommand or compiler directives.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgs = {"-XX:+UnlockDiagnosticVMOptions"})
+public abstract class OrderedFPReductions {
+
+    @Param({"1024", "65536"})
+    public int size;
+
+    private float[] floats;
+    private double[] doubles;
+
+    @Setup
+    public void setup() {
+        Random r = new Random(42);
+        floats = new float[size];
+        doubles = new double[size];
+        for (int i = 0; i < size; i++) {
+            floats[i] = r.nextFloat() + 0.5f;
+            doubles[i] = r.nextDouble() + 0.5;
+        }
+    }
+
+    @Benchmark
+    public float addFloat() {
+        float sum = 0.0f;
+        for (int i = 0; i < floats.length; i++) {
+            sum += floats[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public float mulFloat() {
+        float prod = 1.0f;
+        for (int i = 0; i < floats.length; i++) {
+            prod *= floats[i];
+        }
+        return prod;
+    }
+
+    @Benchmark
+    public double addDouble() {
+        double sum = 0.0;
+        for (int i = 0; i < doubles.length; i++) {
+            sum += doubles[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public double mulDouble() {
+        double prod = 1.0;
+        for (int i = 0; i < doubles.length; i++) {
+            prod *= doubles[i];
+        }
+        return prod;
+    }
+
+    @Fork(value = 3, jvmArgs = {"-XX:+UnlockDiagnosticVMOptions", "-XX:+SuperWordOrderedFPReductions"})
+    public static class Vectorized extends OrderedFPReductions {}
+
+    @Fork(value = 3, jvmArgs = {"-XX:+UnlockDiagnosticVMOptions", "-XX:-SuperWordOrderedFPReductions"})
+    public static class Scalar extends OrderedFPReductions {}
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Interface and virtual calls at a site that sees a configurable number of
+ * receiver types. The polymorphic forks profile and inline up to six
+ * receivers with -XX:PolymorphicInlineWidth; the baseline forks keep the
+ * default bimorphic inlining and dispatch through vtable/itable stubs.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public abstract class PolymorphicInlining {
+
+    @Param({"2", "4", "6", "8"})
+    public int receivers;
+
+    static final int SIZE = 1024;
+
+    interface Shape {
+        int area();
+    }
+
+    static abstract class AbstractShape implements Shape {
+        abstract int perimeter();
+    }
+
+    static final class S0 extends AbstractShape { public int area() { return 1; } int perimeter() { return 11; } }
+    static final class S1 extends AbstractShape { public int area() { return 2; } int perimeter() { return 12; } }
+    static final class S2 extends AbstractShape { public int area() { return 3; } int perimeter() { return 13; } }
+    static final class S3 extends AbstractShape { public int area() { return 4; } int perimeter() { return 14; } }
+    static final class S4 extends AbstractShape { public int area() { return 5; } int perimeter() { return 15; } }
+    static final class S5 extends AbstractShape { public int area() { return 6; } int perimeter() { return 16; } }
+    static final class S6 extends AbstractShape { public int area() { return 7; } int perimeter() { return 17; } }
+    static final class S7 extends AbstractShape { public int area() { return 8; } int perimeter() { return 18; } }
+
+    private AbstractShape[] shapes;
+
+    @Setup
+    public void setup() {
+        AbstractShape[] all = { new S0(), new S1(), new S2(), new S3(),
+                                new S4(), new S5(), new S6(), new S7() };
+        shapes = new AbstractShape[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            shapes[i] = all[i % receivers];
+        }
+    }
+
+    @Benchmark
+    public int interfaceCall() {
+        int sum = 0;
+        for (Shape s : shapes) {
+            sum += s.area();
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int virtualCall() {
+        int sum = 0;
+        for (AbstractShape s : shapes) {
+            sum += s.perimeter();
+        }
+        return sum;
+    }
+
+    @Fork(value = 3, jvmArgs = {"-XX:+UnlockExperimentalVMOptions", "-XX:TypeProfileWidth=8", "-XX:PolymorphicInlineWidth=6"})
+    public static class Polymorphic extends PolymorphicInlining {}
+
+    @Fork(value = 3, jvmArgs = {"-XX:TypeProfileWidth=8"})
+    public static class Bimorphic extends PolymorphicInlining {}
+}
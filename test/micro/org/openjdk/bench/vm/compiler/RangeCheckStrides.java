@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Range check elimination for strided array accesses. Loops with a
+ * constant stride, and row-pitch accesses whose pitch only enters the
+ * loop-invariant offset, are counted loops and get their range checks
+ * eliminated. Loops with a loop-invariant but non-constant stride, or
+ * an index scaled by an invariant, keep their range checks.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class RangeCheckStrides {
+
+    @Param({"512"})
+    public int width;
+
+    @Param({"512"})
+    public int height;
+
+    @Param({"4"})
+    public int step;
+
+    private int[] pixels;
+
+    @Setup
+    public void setup() {
+        pixels = new int[width * height];
+        for (int i = 0; i < pixels.length; i++) {
+            pixels[i] = i;
+        }
+    }
+
+    @Benchmark
+    public int constantStride() {
+        int sum = 0;
+        for (int i = 0; i < pixels.length; i += 4) {
+            sum += pixels[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int invariantStride() {
+        int sum = 0;
+        for (int i = 0; i < pixels.length; i += step) {
+            sum += pixels[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int rowPitch() {
+        int sum = 0;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                sum += pixels[y * width + x];
+            }
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int columnPitch() {
+        int sum = 0;
+        for (int x = 0; x < width; x++) {
+            for (int y = 0; y < height; y++) {
+                sum += pixels[y * width + x];
+            }
+        }
+        return sum;
+    }
+}
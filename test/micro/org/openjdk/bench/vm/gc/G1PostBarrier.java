@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of the G1 post-write barrier for reference stores from an
+ * old object array into young objects. The stores fall into a configurable
+ * number of distinct cards (0.5k each), so that repeated stores into the same
+ * card exercise -XX:+G1UsePostBarrierCardCache.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+public abstract class G1PostBarrier {
+
+    // Number of references per card with compressed oops.
+    private static final int REFS_PER_CARD = 512 / 4;
+
+    @Param({"1", "16", "256"})
+    public int cards;
+
+    private Object[] oldArray;
+    private Object[] youngValues;
+
+    @Setup
+    public void setup() {
+        oldArray = new Object[256 * REFS_PER_CARD];
+        youngValues = new Object[REFS_PER_CARD];
+        // Move the array into the old generation.
+        System.gc();
+        for (int i = 0; i < youngValues.length; i++) {
+            youngValues[i] = new Object();
+        }
+    }
+
+    @Benchmark
+    public void storeSequential() {
+        Object[] a = oldArray;
+        Object[] v = youngValues;
+        int len = cards * REFS_PER_CARD;
+        for (int i = 0; i < len; i++) {
+            a[i] = v[i & (REFS_PER_CARD - 1)];
+        }
+    }
+
+    @Benchmark
+    public void storeRepeated() {
+        Object[] a = oldArray;
+        Object[] v = youngValues;
+        int numCards = cards;
+        for (int i = 0; i < REFS_PER_CARD; i++) {
+            for (int c = 0; c < numCards; c++) {
+                a[c * REFS_PER_CARD + i] = v[i];
+            }
+        }
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class WithoutCardCache extends G1PostBarrier {
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-XX:+UnlockExperimentalVMOptions", "-XX:+G1UsePostBarrierCardCache"})
+    public static class WithCardCache extends G1PostBarrier {
+    }
+}
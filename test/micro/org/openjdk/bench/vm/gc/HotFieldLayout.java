@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.*;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Walks a large array of objects whose two hot fields are declared far
+ * apart, with and without -XX:HotInstanceFields placing them together at
+ * the start of the object.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class HotFieldLayout {
+
+    static class Wide {
+        long hot1;
+        long c0, c1, c2, c3, c4, c5, c6, c7, c8, c9;
+        long c10, c11, c12, c13, c14, c15, c16, c17, c18, c19;
+        long c20, c21, c22, c23, c24, c25, c26, c27, c28, c29;
+        long c30, c31, c32, c33, c34, c35, c36, c37, c38, c39;
+        long hot2;
+    }
+
+    @Param({"262144"})
+    public int count;
+
+    private Wide[] objects;
+
+    @Setup
+    public void setup() {
+        objects = new Wide[count];
+        for (int i = 0; i < count; i++) {
+            objects[i] = new Wide();
+            objects[i].hot1 = i;
+            objects[i].hot2 = -i;
+        }
+    }
+
+    @Benchmark
+    public long walk() {
+        long sum = 0;
+        for (Wide w : objects) {
+            sum += w.hot1 + w.hot2;
+        }
+        return sum;
+    }
+
+    @Fork(value = 3, jvmArgs = {"-XX:+UnlockExperimentalVMOptions",
+                                "-XX:HotInstanceFields=org/openjdk/bench/vm/gc/HotFieldLayout$Wide.hot1,org/openjdk/bench/vm/gc/HotFieldLayout$Wide.hot2"})
+    @Benchmark
+    public long walkHotFirst() {
+        return walk();
+    }
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.ref.SoftReference;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.SplittableRandom;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Mutator latency on top of large, realistically shaped live sets. Each
+ * benchmark keeps a live set of about {@code liveMB} megabytes and replaces
+ * a small part of it per operation:
+ * <ul>
+ * <li>{@code lruCache}: an access-ordered LinkedHashMap with eviction,</li>
+ * <li>{@code linkedList}: one long singly linked chain, spliced in place,</li>
+ * <li>{@code humongous}: arrays larger than half a G1 region,</li>
+ * <li>{@code softCache}: byte arrays reachable only through SoftReferences.</li>
+ * </ul>
+ * SampleTime mode reports operation latency percentiles, so GC pauses and
+ * allocation stalls show up in the upper percentiles. Run with
+ * {@code -prof gc} for allocation and GC counts, or add {@code -Xlog:gc*}
+ * through {@code -jvmArgsAppend} for per-pause and concurrent phase times.
+ */
+@BenchmarkMode(Mode.SampleTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 4)
+public abstract class ObjectGraphChurn {
+
+    @State(Scope.Thread)
+    public static class LruCache {
+        private static final int VALUE_SIZE = 256;
+
+        @Param({"256"})
+        public int liveMB;
+
+        private Map<Integer, byte[]> cache;
+        private SplittableRandom random;
+        private int keyRange;
+
+        @Setup
+        public void setup() {
+            // Object header, map entry and boxed key add roughly 100 bytes.
+            final int capacity = (int)((long)liveMB * 1024 * 1024 / (VALUE_SIZE + 100));
+            keyRange = capacity * 2;
+            cache = new LinkedHashMap<>(capacity, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<Integer, byte[]> eldest) {
+                    return size() > capacity;
+                }
+            };
+            random = new SplittableRandom(42);
+            for (int i = 0; i < capacity; i++) {
+                cache.put(i, new byte[VALUE_SIZE]);
+            }
+        }
+    }
+
+    @State(Scope.Thread)
+    public static class LinkedList {
+        private static final int SPLICE_LENGTH = 16;
+
+        static final class Node {
+            Node next;
+            long payload;
+        }
+
+        @Param({"256"})
+        public int liveMB;
+
+        private Node head;
+        private Node cursor;
+
+        @Setup
+        public void setup() {
+            // 24 bytes per node with compressed oops.
+            long nodes = (long)liveMB * 1024 * 1024 / 24;
+            head = new Node();
+            Node n = head;
+            for (long i = 1; i < nodes; i++) {
+                n.next = new Node();
+                n.payload = i;
+                n = n.next;
+            }
+            cursor = head;
+        }
+    }
+
+    @State(Scope.Thread)
+    public static class Humongous {
+        @Param({"256"})
+        public int liveMB;
+
+        // Well above half of the 1M G1 region size used for the 2g heaps below.
+        @Param({"3072"})
+        public int arrayKB;
+
+        private byte[][] arrays;
+        private SplittableRandom random;
+
+        @Setup
+        public void setup() {
+            arrays = new byte[Math.max(1, liveMB * 1024 / arrayKB)][];
+            for (int i = 0; i < arrays.length; i++) {
+                arrays[i] = new byte[arrayKB * 1024];
+            }
+            random = new SplittableRandom(42);
+        }
+    }
+
+    @State(Scope.Thread)
+    public static class SoftCache {
+        private static final int VALUE_SIZE = 1024;
+
+        @Param({"256"})
+        public int liveMB;
+
+        private SoftReference<byte[]>[] refs;
+        private SplittableRandom random;
+
+        @Setup
+        @SuppressWarnings("unchecked")
+        public void setup() {
+            refs = (SoftReference<byte[]>[]) new SoftReference<?>[liveMB * 1024 * 1024 / (VALUE_SIZE + 64)];
+            for (int i = 0; i < refs.length; i++) {
+                refs[i] = new SoftReference<>(new byte[VALUE_SIZE]);
+            }
+            random = new SplittableRandom(42);
+        }
+    }
+
+    @Benchmark
+    public byte[] lruCache(LruCache s) {
+        Integer key = s.random.nextInt(s.keyRange);
+        byte[] value = s.cache.get(key);
+        if (value == null) {
+            value = new byte[LruCache.VALUE_SIZE];
+            s.cache.put(key, value);
+        }
+        return value;
+    }
+
+    @Benchmark
+    public long linkedList(LinkedList s) {
+        // Replace the SPLICE_LENGTH nodes after the cursor with fresh ones,
+        // then advance, wrapping around at the end of the chain.
+        LinkedList.Node start = s.cursor;
+        LinkedList.Node old = start.next;
+        LinkedList.Node n = start;
+        for (int i = 0; i < LinkedList.SPLICE_LENGTH && old != null; i++) {
+            LinkedList.Node fresh = new LinkedList.Node();
+            fresh.payload = old.payload;
+            n.next = fresh;
+            n = fresh;
+            old = old.next;
+        }
+        n.next = old;
+        s.cursor = (old != null) ? n : s.head;
+        return n.payload;
+    }
+
+    @Benchmark
+    public byte[] humongous(Humongous s) {
+        byte[] a = new byte[s.arrayKB * 1024];
+        s.arrays[s.random.nextInt(s.arrays.length)] = a;
+        return a;
+    }
+
+    @Benchmark
+    public byte[] softCache(SoftCache s) {
+        int i = s.random.nextInt(s.refs.length);
+        byte[] value = s.refs[i].get();
+        if (value == null) {
+            value = new byte[SoftCache.VALUE_SIZE];
+            s.refs[i] = new SoftReference<>(value);
+        }
+        return value;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xms2g", "-Xmx2g"})
+    public static class G1 extends ObjectGraphChurn {
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC", "-Xms2g", "-Xmx2g"})
+    public static class Parallel extends ObjectGraphChurn {
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-Xms2g", "-Xmx2g"})
+    public static class Z extends ObjectGraphChurn {
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC", "-Xms2g", "-Xmx2g"})
+    public static class Shenandoah extends ObjectGraphChurn {
+    }
+}